@@ -0,0 +1,141 @@
+#include "BenchmarkUtils.hpp"
+#include "VRControllerMock.hpp"
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/DirectInputState.hpp"
+#include "TrickSaber/Native/ThrowModel.hpp"
+#include "TrickSaber/Native/SpinModel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Per-frame cost of the IL2CPP-free core for both hands: velocity tracking,
+// input edges and the throw/spin models, fed by a scripted pair of mock
+// Quest controllers. Mock states are generated up front so only core work
+// is timed.
+//
+//   tricksaber_core_bench [frames]
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    constexpr float FrameRate = 90.0f;
+    constexpr float DeltaTime = 1.0f / FrameRate;
+
+    struct FrameInput {
+        Vec3 position[2];
+        Quat rotation[2];
+        bool trigger[2];
+        float stickX[2];
+    };
+
+    Vec3 ToNative(const UnityEngine::Vector3& v) { return {v.x, v.y, v.z}; }
+    Quat ToNative(const UnityEngine::Quaternion& q) { return {q.x, q.y, q.z, q.w}; }
+
+    // Right hand throws every 2s (0.4s swing, trigger held 1s); left hand
+    // circles and spins with the stick for 1s of every 1.5s.
+    std::vector<FrameInput> RecordSession(int frames) {
+        MockQuest3Controller left(false), right(true);
+        std::vector<FrameInput> session(frames);
+
+        for (int i = 0; i < frames; ++i) {
+            float t = i * DeltaTime;
+            float throwPhase = std::fmod(t, 2.0f);
+            float spinPhase = std::fmod(t, 1.5f);
+
+            if (throwPhase < 0.4f) {
+                right.SimulateThrowMotion(throwPhase / 0.4f);
+            } else {
+                right.SimulateMovement(UnityEngine::Vector3(0.2f, -0.1f, -0.3f), DeltaTime);
+            }
+            right.SetTrigger(throwPhase > 0.3f && throwPhase < 1.3f ? 1.0f : 0.0f);
+
+            left.SimulateMovement(UnityEngine::Vector3(-0.3f + 0.1f * std::cos(t * 3.0f), 0.1f * std::sin(t * 3.0f), -0.2f), DeltaTime);
+            left.SetThumbstick(spinPhase < 1.0f ? -0.9f : 0.0f, 0.0f);
+
+            const auto& l = left.GetState();
+            const auto& r = right.GetState();
+            float yaw = t * 0.7f;
+            session[i] = {
+                {ToNative(l.position), ToNative(r.position)},
+                {AxisAngle({0.0f, 1.0f, 0.0f}, yaw), ToNative(r.rotation)},
+                {l.triggerPressed, r.triggerPressed},
+                {-l.thumbstick.x, r.thumbstick.x}   // outward positive, as SaberTrickManager mirrors it
+            };
+        }
+        return session;
+    }
+
+    struct Core {
+        HandTracker tracker;
+        DirectInputState input[2];
+        ThrowModel throws[2];
+        SpinModel spins[2];
+        ThrowParams throwParams;
+        SpinParams spinParams;
+        int throwsStarted = 0;
+        int spinsStarted = 0;
+
+        Core() {
+            tracker.Configure(VelocityFilterMode::Boxcar, VelocityFilterParams{});
+            spinParams.direction = SpinDir::Forward;
+        }
+
+        void Frame(const FrameInput& frame, double time) {
+            tracker.Update(time, DeltaTime, HandTracker::LeftMask | HandTracker::RightMask, frame.position, frame.rotation);
+
+            for (int hand = 0; hand < 2; ++hand) {
+                auto edges = input[hand].Update(frame.trigger[hand], frame.stickX[hand]);
+                auto& throwModel = throws[hand];
+                auto& spinModel = spins[hand];
+                bool busy = throwModel.Phase() == ThrowPhase::Thrown || throwModel.Phase() == ThrowPhase::Returning ||
+                            spinModel.Phase() == SpinPhase::Spinning || spinModel.Phase() == SpinPhase::Stopping ||
+                            spinModel.Phase() == SpinPhase::Completing;
+
+                if (edges.triggerPressed && !busy) {
+                    auto launch = ComputeThrowLaunch(throwParams, tracker.Velocity(hand), tracker.AngularVelocity(hand), {0.0f, 0.0f, 1.0f});
+                    throwModel.Launch(throwParams, tracker.Position(hand), tracker.Rotation(hand), launch);
+                    throwsStarted++;
+                } else if (edges.triggerReleased) {
+                    throwModel.BeginReturn();
+                }
+
+                if (edges.thumbstickPressed && !busy) {
+                    spinModel.Start(spinParams, IdentityQuat(), edges.thumbstickValue, tracker.AngularVelocity(hand));
+                    spinsStarted++;
+                } else if (edges.thumbstickReleased) {
+                    spinModel.Release();
+                } else if (edges.thumbstickActive) {
+                    spinModel.SetInput(edges.thumbstickValue);
+                }
+
+                throwModel.Step(DeltaTime, tracker.Position(hand), tracker.Rotation(hand));
+                spinModel.Step(DeltaTime, tracker.AngularVelocity(hand));
+            }
+        }
+    };
+}
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 90 * 60;
+    auto session = RecordSession(frames);
+
+    // The clock keeps running across repeats so pose history stays monotonic
+    Core core;
+    int tick = 0;
+    double ns = MeasureNsPerOp([&](int i) {
+        core.Frame(session[i], (tick++) * DeltaTime);
+        DoNotOptimize(core.throws[1].Position());
+        DoNotOptimize(core.spins[0].LocalRotation());
+    }, frames);
+
+    std::printf("[ BENCH    ] %d frames at %.0f Hz, %d throws, %d spins (all repeats)\n",
+        frames, FrameRate, core.throwsStarted, core.spinsStarted);
+    ReportNs("core frame (2 hands: tracking, input, throw, spin)", ns);
+    std::printf("[ BENCH    ] %.4f%% of a %.2f ms frame\n", ns / (1e7 / FrameRate), 1000.0f / FrameRate);
+    return 0;
+}
@@ -0,0 +1,68 @@
+include_guard()
+
+# Host-native build (BUILD_HOST_TESTS=ON): the IL2CPP-free core in
+# src/TrickSaber/Native, its unit tests and the per-frame benchmark.
+# Needs neither the NDK nor qpm dependencies.
+#
+#   cmake -S . -B build-host-tests -DBUILD_HOST_TESTS=ON -DCMAKE_BUILD_TYPE=Release
+#   cmake --build build-host-tests && ctest --test-dir build-host-tests
+#   ./build-host-tests/tricksaber_core_bench
+
+message("Compiling tricksaber_core for the host")
+
+set(CMAKE_CXX_STANDARD 20)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+
+if(NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Release)
+endif()
+
+find_package(Threads REQUIRED)
+
+# Pure C++ core
+file(GLOB_RECURSE core_file_list ${CMAKE_CURRENT_SOURCE_DIR}/src/TrickSaber/Native/*.cpp)
+
+add_library(tricksaber_core STATIC ${core_file_list})
+target_include_directories(tricksaber_core PUBLIC ${CMAKE_CURRENT_SOURCE_DIR}/include)
+target_compile_options(tricksaber_core PRIVATE -Wall -Wextra -Wno-unused-parameter)
+target_link_libraries(tricksaber_core PUBLIC Threads::Threads)
+
+# Per-frame benchmark driven by the mock Quest controllers
+add_executable(
+    tricksaber_core_bench
+    ${CMAKE_CURRENT_SOURCE_DIR}/bench/CoreBench.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/test/VRControllerMock.cpp
+)
+target_include_directories(tricksaber_core_bench PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/test)
+target_compile_definitions(tricksaber_core_bench PRIVATE HOST_TESTS=1)
+target_link_libraries(tricksaber_core_bench PRIVATE tricksaber_core)
+
+# Unit tests (system GTest if present, otherwise fetched)
+find_package(GTest QUIET)
+if(NOT GTest_FOUND)
+    include(FetchContent)
+    FetchContent_Declare(
+        googletest
+        URL https://github.com/google/googletest/archive/03597a01ee50ed33e9dfd640b249b4be3799d395.zip
+    )
+    set(gtest_force_shared_crt ON CACHE BOOL "" FORCE)
+    FetchContent_MakeAvailable(googletest)
+endif()
+
+enable_testing()
+include(GoogleTest)
+
+file(GLOB_RECURSE test_file_list ${CMAKE_CURRENT_SOURCE_DIR}/test/*.cpp)
+
+add_executable(tricksaber_core_test ${test_file_list})
+target_include_directories(tricksaber_core_test PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/test
+    ${CMAKE_CURRENT_SOURCE_DIR}/src
+)
+target_compile_definitions(tricksaber_core_test PRIVATE
+    HOST_TESTS=1
+    VERSION="${PROJECT_VERSION}"
+    MOD_ID="tricksaber"
+)
+target_link_libraries(tricksaber_core_test PRIVATE tricksaber_core GTest::gtest_main)
+gtest_discover_tests(tricksaber_core_test)
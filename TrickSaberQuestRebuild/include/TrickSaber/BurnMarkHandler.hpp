@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GlobalNamespace/Saber.hpp"
+#include "TrickSaber/Native/EventBus.hpp"
 #include "System/Type.hpp"
 #include "UnityEngine/Object.hpp"
 #include <unordered_map>
@@ -15,6 +16,9 @@ namespace TrickSaber {
         static void Initialize();
         
     private:
+        static void OnTrickStarted(void* context, const Native::TrickStartedEvent& event);
+        static void OnTrickEnded(void* context, const Native::TrickEndedEvent& event);
+        
         static std::unordered_map<Il2CppClass*, FieldInfo*> sabersFieldInfo;
         static std::unordered_map<System::Type*, ArrayW<::UnityW<::UnityEngine::Object>>> disabledBurnmarks;
         static std::vector<System::Type*> burnTypes;
@@ -76,6 +76,25 @@ namespace TrickSaber {
         bool noTricksWhileNotes = false;
         
         int velocityBufferSize = Constants::DEFAULT_VELOCITY_BUFFER_SIZE;
+        float throwVelocityWindowMs = Constants::DEFAULT_THROW_VELOCITY_WINDOW_MS;
+        
+        // Throw on a detected flick peak instead of waiting for the button
+        bool enableFlickThrow = false;
+        float flickMinPeakSpeed = Constants::DEFAULT_FLICK_MIN_PEAK_SPEED;
+        float flickMinPeakJerk = Constants::DEFAULT_FLICK_MIN_PEAK_JERK;
+        float flickCooldown = Constants::DEFAULT_FLICK_COOLDOWN;
+        float flickHoldTime = Constants::DEFAULT_FLICK_HOLD_TIME;
+        
+        // Warm the throw while the trigger is partially pulled; the press only commits
+        bool enableThrowPreArm = true;
+        float throwArmThreshold = Constants::DEFAULT_THROW_ARM_THRESHOLD;
+        
+        // Velocity smoothing (Boxcar uses velocityBufferSize)
+        VelocityFilterMode velocityFilterMode = VelocityFilterMode::Boxcar;
+        float oneEuroMinCutoff = Constants::DEFAULT_ONE_EURO_MIN_CUTOFF;
+        float oneEuroBeta = Constants::DEFAULT_ONE_EURO_BETA;
+        float kalmanProcessNoise = Constants::DEFAULT_KALMAN_PROCESS_NOISE;
+        float kalmanMeasurementNoise = Constants::DEFAULT_KALMAN_MEASUREMENT_NOISE;
         
         // Physics quality settings
         bool useRigidbodyPhysics = true;
@@ -99,6 +118,9 @@ namespace TrickSaber {
         
         // Debug overlay
         bool showDebugOverlay = false;
+        
+        // Per-level pose/input trace (see Native/TraceFormat.hpp)
+        bool enableTraceRecording = false;
     };
     
     extern Config config;
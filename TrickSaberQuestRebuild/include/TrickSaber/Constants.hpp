@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace TrickSaber::Constants {
@@ -25,12 +26,24 @@ namespace TrickSaber::Constants {
     constexpr float SPIN_VELOCITY_SCALE = 180.0f;  // degrees per second (Quest uses deltaTime)
     constexpr float RETURN_SPIN_SCALE = 20.0f;     // lerp speed multiplier (matches Quest code)
     constexpr float SIMPLIFIED_RETURN_SPIN_SCALE = 30.0f;  // min completion speed degrees/sec
+    constexpr float THROW_FIXED_STEP = 1.0f / 240.0f;     // thrown-saber substep, refresh-rate independent
+    constexpr int THROW_MAX_SUBSTEPS = 60;                 // 0.25s per frame; longer hitches drop time
+    constexpr float THROW_MAX_FLIGHT_TIME = 10.0f;         // seconds searched for the snap-back point
+    constexpr float RETURN_ARRIVAL_DISTANCE = 0.002f;      // m, return ends once this close to the hand
+    constexpr float RETURN_ARRIVAL_ANGLE = 1.0f;           // degrees, and this close in rotation
+    constexpr float RETURN_MAX_TIME_SCALE = 1.5f;          // hard bound: returnDuration * this, then snap
+
+    // Thrown-saber note cutting
+    constexpr float SABER_BLADE_LENGTH = 1.0f;             // m along the saber's forward from the handle
+    constexpr float NOTE_LINE_SPACING = 0.6f;              // m between lanes, centred on x = 0
+    constexpr float NOTE_LAYER_HEIGHTS[] = {0.85f, 1.4f, 1.9f};
+    constexpr float NOTE_CUT_RADIUS = 0.3f;                // m from a note's centre
+    constexpr float NOTE_GRID_CELL = 0.5f;                 // m, covers x -2..2 and y -0.5..3.5
+    constexpr float NOTE_GRID_TIME_CELL = 0.1f;            // s of arrival time per bucket
     
     // Performance
     constexpr int CACHE_VALIDATION_INTERVAL_SEC = 20;  // Increased base interval
     constexpr int PERFORMANCE_UPDATE_INTERVAL_FRAMES = 30;
-    constexpr int TRICK_UPDATE_IDLE_INTERVAL = 5;
-    constexpr int TRICK_UPDATE_DEEP_IDLE_INTERVAL = 15;
     constexpr int VELOCITY_UPDATE_IDLE_SKIP = 3;
     constexpr float IDLE_THRESHOLD_SEC = 2.0f;
     constexpr float PERFORMANCE_REPORT_INTERVAL_SEC = 10.0f;
@@ -48,6 +61,35 @@ namespace TrickSaber::Constants {
     constexpr int DEFAULT_VELOCITY_BUFFER_SIZE = 5;
     constexpr int MAX_VELOCITY_BUFFER_SIZE = 20;
     
+    // Velocity Filters
+    constexpr float DEFAULT_ONE_EURO_MIN_CUTOFF = 4.0f;        // Hz
+    constexpr float DEFAULT_ONE_EURO_BETA = 0.5f;
+    constexpr float DEFAULT_ONE_EURO_DERIVATIVE_CUTOFF = 10.0f; // Hz
+    constexpr float DEFAULT_KALMAN_PROCESS_NOISE = 50.0f;    // jerk spectral density
+    constexpr float DEFAULT_KALMAN_MEASUREMENT_NOISE = 0.01f;  // raw velocity variance
+    
+    // Pose History
+    constexpr int POSE_HISTORY_CAPACITY = 64;              // ~0.5s at 120Hz
+    constexpr double POSE_HISTORY_MIN_INTERVAL_SEC = 0.001; // drops repeat fixed steps within one frame
+    constexpr float DEFAULT_THROW_VELOCITY_WINDOW_MS = 50.0f;
+    constexpr float MIN_THROW_VELOCITY_WINDOW_MS = 10.0f;
+    constexpr float MAX_THROW_VELOCITY_WINDOW_MS = 200.0f;
+    
+    // Flick Gestures
+    constexpr float DEFAULT_FLICK_MIN_PEAK_SPEED = 2.5f;   // m/s
+    constexpr float DEFAULT_FLICK_MIN_PEAK_JERK = 120.0f;  // m/s^3, rejects slow sweeps
+    constexpr float DEFAULT_FLICK_COOLDOWN = 0.5f;         // seconds between flicks
+    constexpr float DEFAULT_FLICK_HOLD_TIME = 0.6f;        // seconds a flick throw is held before it returns
+    constexpr float FLICK_VELOCITY_SMOOTHING = 0.6f;       // EMA weight of the newest sample
+    
+    // Pre-armed Throws
+    constexpr float DEFAULT_THROW_ARM_THRESHOLD = 0.35f;   // analog trigger, well below the button point
+    constexpr float THROW_ARM_HYSTERESIS = 0.1f;           // disarm this far below the arm threshold
+    
+    // Trace Recording
+    constexpr const char* TRACE_DIRECTORY = "/sdcard/ModData/com.beatgames.beatsaber/Mods/TrickSaber/Traces";
+    constexpr size_t TRACE_RING_BYTES = 1u << 20;          // ~14k pose records before drops
+    
     // Configuration Limits
     constexpr float MIN_THRESHOLD = 0.1f;
     constexpr float MAX_THRESHOLD = 1.0f;
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "TrickSaber/Native/ChordMatcher.hpp"
+
+namespace TrickSaber::Core {
+    // Chord state change for the current frame
+    struct ChordFrame {
+        uint64_t frame = 0;
+        Native::ChordTransition transition = Native::ChordTransition::None;
+        Native::ChordBinding binding;
+        float value = 0.0f;     // mean of the chord's input values when it started
+    };
+
+    // Matches multi-input chords across both hands once per frame from the
+    // input snapshot. The lookup table is rebuilt only when the configured
+    // actions change.
+    class ChordService {
+    public:
+        static const ChordFrame& Update();
+
+        // Logs the per-scene counters and starts over
+        static void Invalidate();
+
+        static const Native::ChordMatcher& GetMatcher() { return matcher; }
+
+    private:
+        static void RefreshBindings();
+
+        static inline Native::ChordMatcher matcher;
+        static inline ChordFrame current;
+        static inline bool hasFrame = false;
+        static inline uint64_t bindingSignature = ~0ull;
+        static inline uint64_t rebuildCount = 0;
+        static inline uint64_t chordCount = 0;
+    };
+}
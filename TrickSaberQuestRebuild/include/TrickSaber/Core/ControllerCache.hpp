@@ -0,0 +1,37 @@
+#pragma once
+
+#include "GlobalNamespace/SaberManager.hpp"
+#include "GlobalNamespace/Saber.hpp"
+#include "UnityEngine/Transform.hpp"
+#include <cstdint>
+
+namespace TrickSaber::Core {
+    // Controller transforms for the current scene
+    struct ControllerSlots {
+        GlobalNamespace::SaberManager* saberManager = nullptr;
+        UnityEngine::Transform* leftHand = nullptr;
+        UnityEngine::Transform* rightHand = nullptr;
+    };
+
+    // Resolved once in SaberManager_Start and dropped by the scene hooks, so
+    // the physics tick only does pointer loads (no mutex, no component search).
+    class ControllerCache {
+    public:
+        static void Resolve(GlobalNamespace::SaberManager* saberManager);
+        static void Invalidate();
+        
+        static const ControllerSlots& GetSlots() { return slots; }
+        
+        // Per-scene counters, logged on Invalidate
+        static void RecordTick() { tickCount++; }
+        static uint32_t GetLookupCount() { return lookupCount; }
+        static uint32_t GetTickCount() { return tickCount; }
+        
+    private:
+        static UnityEngine::Transform* ResolveHand(GlobalNamespace::Saber* saber);
+        
+        static inline ControllerSlots slots;
+        static inline uint32_t lookupCount = 0;
+        static inline uint32_t tickCount = 0;
+    };
+}
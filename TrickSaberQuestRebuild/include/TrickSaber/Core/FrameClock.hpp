@@ -0,0 +1,46 @@
+#pragma once
+
+#include "TrickSaber/Native/FrameClock.hpp"
+
+namespace TrickSaber::Core {
+    // Time sampled once per Unity frame. BeginFrame is called from the
+    // VRController Update hook, which runs every frame in every scene, and
+    // again at the start of TrickDriver::Update so gameplay never sees the
+    // previous frame; after the first call a frame it is one frameCount
+    // read. Everything else reads the cached values without asking the
+    // engine or the OS clock. Code that runs earlier in a frame than both
+    // sees the previous frame's values.
+    //
+    // A read before the first stamp of a scene samples once on the spot
+    // under frame id 0, so the next BeginFrame replaces it.
+    //
+    // FixedUpdate code must not call BeginFrame or use these values for its
+    // step or timestamps; it reads Time itself.
+    class FrameClock {
+    public:
+        // Update phase only: the frame hook and TrickDriver::Update
+        static void BeginFrame();
+
+        static const Native::FrameTime& Current() {
+            if (!clock.IsValid()) SampleBeforeFirstFrame();
+            return clock.Current();
+        }
+        static double Now() { return Current().now; }
+        static std::chrono::steady_clock::time_point SteadyNow() { return Current().steadyNow; }
+        static float DeltaTime() { return Current().deltaTime; }
+        static float FixedDeltaTime() { return Current().fixedDeltaTime; }
+        static float Time() { return Current().time; }
+        static uint64_t Frame() { return Current().frame; }
+
+        // Logs the per-scene counters and starts over
+        static void Invalidate();
+
+        static uint64_t GetBeginCount() { return clock.GetBeginCount(); }
+        static uint64_t GetFrameCount() { return clock.GetFrameCount(); }
+
+    private:
+        static void SampleBeforeFirstFrame();
+
+        static inline Native::FrameClockState clock;
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "TrickSaber/Native/InputSnapshot.hpp"
+
+namespace TrickSaber::Core {
+    // OVRInput sampled once per Unity frame for both controllers. Every input
+    // consumer reads from here instead of polling the runtime itself.
+    //
+    // Get is a cache read keyed on FrameClock::Frame(), stamped once per
+    // frame in every scene; the only engine calls are the OVRInput reads
+    // counted in GetInteropCallCount. A read before the frame is stamped
+    // gets the previous frame's input.
+    class InputSnapshotService {
+    public:
+        static const Native::InputSnapshot& Get();
+        static const Native::ControllerSample& Get(bool isLeft) {
+            return Get().hands[isLeft ? Native::LeftHand : Native::RightHand];
+        }
+
+        // Logs the per-scene counters and starts over
+        static void Invalidate();
+
+        static uint64_t GetInteropCallCount() { return buffer.GetInteropCallCount(); }
+        static uint64_t GetSampleCount() { return buffer.GetSampleCount(); }
+        static uint64_t GetReadCount() { return buffer.GetReadCount(); }
+
+    private:
+        static inline Native::InputSnapshotBuffer buffer;
+    };
+}
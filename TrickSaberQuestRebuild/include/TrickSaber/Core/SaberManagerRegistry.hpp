@@ -0,0 +1,37 @@
+#pragma once
+
+#include "TrickSaber/Native/HandSlots.hpp"
+
+namespace TrickSaber { class SaberTrickManager; }
+
+namespace TrickSaber::Core {
+    // The live SaberTrickManager for each hand. Managers join at the end of
+    // Initialize and leave in OnDestroy; everything else looks them up here
+    // instead of scanning the scene with FindObjectsOfType.
+    class SaberManagerRegistry {
+    public:
+        static void Join(SaberTrickManager* manager, bool isLeft);
+        static void Leave(SaberTrickManager* manager, bool isLeft);
+
+        static SaberTrickManager* Get(bool isLeft) {
+            return slots.Get(isLeft ? Native::LeftHand : Native::RightHand);
+        }
+        static const std::array<SaberTrickManager*, 2>& All() { return slots.All(); }
+        static int Count() { return slots.Count(); }
+
+        // Counts a FindObject(s)OfType call. Any made while managers are
+        // registered is a gameplay scan: it is logged, and asserts in debug builds.
+        static void RecordObjectScan(const char* site);
+
+        // Logs the per-scene counters and starts over; registrations are kept
+        static void Invalidate();
+
+        static uint64_t GetObjectScanCount() { return objectScans; }
+        static uint64_t GetGameplayScanCount() { return gameplayScans; }
+
+    private:
+        static inline Native::HandSlots<SaberTrickManager> slots;
+        static inline uint64_t objectScans = 0;
+        static inline uint64_t gameplayScans = 0;
+    };
+}
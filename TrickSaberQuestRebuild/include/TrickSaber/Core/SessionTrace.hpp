@@ -0,0 +1,11 @@
+#pragma once
+
+namespace TrickSaber::Core {
+    // Opens a pose/input trace per level when config.enableTraceRecording is
+    // set. Begin runs from SaberManager_Start, End from the scene hooks.
+    class SessionTrace {
+    public:
+        static void Begin();
+        static void End();
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "TrickSaber/Native/EventBus.hpp"
+
+namespace TrickSaber::Core {
+    // Trick lifecycle bus. SaberTrickManager publishes; subsystems subscribe
+    // once when they come up and pay nothing while absent.
+    class TrickEvents {
+    public:
+        template<typename Event>
+        static bool Subscribe(Native::TrickEventBus::Handler<Event> handler, void* context = nullptr) {
+            return bus.Subscribe<Event>(handler, context);
+        }
+
+        template<typename Event>
+        static bool Unsubscribe(Native::TrickEventBus::Handler<Event> handler, void* context = nullptr) {
+            return bus.Unsubscribe<Event>(handler, context);
+        }
+
+        template<typename Event>
+        static void Publish(const Event& event) { bus.Publish(event); }
+
+        // Logs the per-scene counters and starts over; subscriptions are kept
+        static void Invalidate();
+
+        static const Native::TrickEventBus& GetBus() { return bus; }
+
+    private:
+        static inline Native::TrickEventBus bus;
+    };
+}
@@ -41,6 +41,12 @@ namespace TrickSaber {
         Momentum         // Use controller momentum
     };
 
+    enum class VelocityFilterMode {
+        Boxcar,   // Moving average over velocityBufferSize probes (PC parity)
+        OneEuro,  // Adaptive low-pass, less lag during fast motion
+        Kalman    // Constant-acceleration model
+    };
+
     enum class SaberType {
         SaberA,  // Left saber
         SaberB   // Right saber
@@ -4,54 +4,54 @@
 #include "UnityEngine/MonoBehaviour.hpp"
 #include "GlobalNamespace/AudioTimeSyncController.hpp"
 #include "TrickSaber/Enums.hpp"
-#include <vector>
-#include <chrono>
+#include "TrickSaber/Native/TrickStateAggregate.hpp"
+#include "TrickSaber/Native/EventBus.hpp"
 
 namespace TrickSaber { class SaberTrickManager; }
 
 DECLARE_CLASS_CODEGEN(TrickSaber, GlobalTrickManager, UnityEngine::MonoBehaviour,
     DECLARE_INSTANCE_METHOD(void, Awake);
     DECLARE_INSTANCE_METHOD(void, OnDestroy);
-    DECLARE_INSTANCE_METHOD(void, Update);
     
     DECLARE_STATIC_METHOD(GlobalTrickManager*, GetInstance);
     DECLARE_STATIC_METHOD(void, Initialize, GlobalNamespace::AudioTimeSyncController* audioController);
     DECLARE_STATIC_METHOD(void, Cleanup);
     
 public:
-    void OnTrickStarted(TrickAction action);
+    void OnTrickStarted(TrickAction action, bool isLeft);
     void OnTrickEndRequested(TrickAction action);
-    void OnTrickEnded(TrickAction action);
-    bool IsTrickInState(TrickAction action, TrickState state);
-    bool IsDoingTrick();
+    void OnTrickEnded(TrickAction action, bool isLeft);
+    
+    // Answered from the aggregate kept by OnTrickStarted/OnTrickEnded. Tricks
+    // only ever report Started (see Trick::IsTrickInState).
+    bool IsTrickInState(TrickAction action, TrickState state) const {
+        return state == TrickState::Started && trickState.IsActive(action);
+    }
+    bool IsDoingTrick() const { return trickState.Any(); }
     bool CanDoTrick();
     bool CanStartTrick(TrickAction action, int saberType);
     void EndAllTricks();
     void UpdateNoteTimer(float deltaTime);
     void OnNoteSpawned();
-    void UpdateTricks();
     
     // Debug stats
-    int GetActiveThrowCount();
-    int GetActiveSpinCount();
+    int GetActiveThrowCount() const { return trickState.Count(TrickAction::Throw); }
+    int GetActiveSpinCount() const { return trickState.Count(TrickAction::Spin); }
     
 private:
     static inline GlobalTrickManager* instance = nullptr;
     GlobalNamespace::AudioTimeSyncController* audioController = nullptr;
     bool saberClashEnabled = true;
     float timeSinceLastNote = 0.0f;
+    Native::TrickStateAggregate trickState;
     
     // Slowmo support
     bool slowmoApplied = false;
     float originalTimeScale = 1.0f;
     
-    // Performance optimization - cached managers
-    std::vector<TrickSaber::SaberTrickManager*> cachedManagers;
-    std::chrono::steady_clock::time_point lastCacheUpdate;
-    
-    void RefreshManagerCache();
-    void ValidateManagerCache();
-    std::vector<TrickSaber::SaberTrickManager*> GetCachedManagers();
+    // Lifecycle events from the saber managers
+    static void HandleTrickStarted(void* context, const Native::TrickStartedEvent& event);
+    static void HandleTrickEnded(void* context, const Native::TrickEndedEvent& event);
     
     // Slowmo methods
     void StartSlowmo(float targetTimeScale);
@@ -4,9 +4,10 @@
 #include "UnityEngine/MonoBehaviour.hpp"
 #include "GlobalNamespace/VRController.hpp"
 #include "GlobalNamespace/SaberType.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
 
 #include "TrickSaber/Enums.hpp"
+#include "TrickSaber/Native/InputSnapshot.hpp"
+#include "TrickSaber/Native/InputChannels.hpp"
 
 #include <functional>
 #include <chrono>
@@ -33,11 +34,8 @@ private:
         std::chrono::steady_clock::time_point lastChangeTime;
     };
     
-    InputState triggerState;
-    InputState gripState;
-    InputState thumbstickState;
-    
-    GlobalNamespace::OVRInput::Controller ovrController;
+    // Indexed by Native::InputSlot
+    InputState states[Native::InputSlotCount];
     
     // Controller detection state
     bool wasConnected = false;
@@ -47,12 +45,10 @@ private:
     static constexpr float CONNECTION_CHECK_INTERVAL_MS = 1000.0f;
     
     void CheckInputs();
-    void CheckInput(std::function<bool(float&)> getValue, InputState& state, TrickAction action);
-    bool GetTriggerValue(float& value);
-    bool GetGripValue(float& value);
-    bool GetThumbstickValue(float& value);
+    void CheckInput(bool isPressed, float value, InputState& state, TrickAction action);
     bool IsDebounceTimeElapsed(const InputState& state) const;
     bool IsControllerDetected();
+    const Native::ControllerSample& GetSample() const;
     void HandleControllerConnectionChange(bool connected);
     
     // Simplified input methods
@@ -60,25 +56,9 @@ private:
     bool GetTriggerValueSimplified(float& value);
     bool GetThumbstickValueSimplified(float& value);
     
-    // Multi-input combination checking
+    // Multi-input chords from Core::ChordService that involve this hand
     void CheckMultiInputCombinations();
-    bool GetButtonOneValue(float& value);
-    bool GetButtonTwoValue(float& value);
-    
-    // Multi-input state tracking
-    InputState buttonOneState;
-    InputState buttonTwoState;
-    
-    // Combination detection
-    struct CombinationState {
-        bool active = false;
-        TrickAction primaryAction = TrickAction::None;
-        TrickAction secondaryAction = TrickAction::None;
-        std::chrono::steady_clock::time_point startTime;
-    };
-    
-    CombinationState activeCombination;
-    static constexpr float COMBINATION_WINDOW_MS = 200.0f; // Time window for combination detection
     
-    InputState& GetInputState(TrickAction action);
-);
\ No newline at end of file
+    // Action of the chord this hand is holding, None when idle
+    TrickAction activeChordAction = TrickAction::None;
+);
@@ -5,9 +5,11 @@
 #include "UnityEngine/Vector2.hpp"
 #include "GlobalNamespace/VRController.hpp"
 #include "GlobalNamespace/SaberType.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
 
 #include "TrickSaber/Enums.hpp"
+#include "TrickSaber/Native/InputSnapshot.hpp"
+#include "TrickSaber/Native/InputChannels.hpp"
+#include "TrickSaber/Native/TriggerArming.hpp"
 
 #include <functional>
 #include <chrono>
@@ -40,8 +42,7 @@ private:
         int historyIndex = 0;
         
         // Hysteresis thresholds
-        float pressThreshold = 0.8f;
-        float releaseThreshold = 0.6f;
+        Native::HysteresisBand hysteresis{0.8f, 0.6f};
         
         // State validation (require 2 consecutive frames)
         bool pendingState = false;
@@ -52,11 +53,9 @@ private:
         bool ValidateStateChange(bool newState);
     };
     
-    EnhancedInputState triggerState;
-    EnhancedInputState gripState;
-    EnhancedInputState thumbstickState;
+    // Indexed by Native::InputSlot (trigger, grip, thumbstick)
+    EnhancedInputState states[std::size(Native::SmoothedInputChannels)];
     
-    GlobalNamespace::OVRInput::Controller ovrController;
     bool wasConnected = false;
     std::chrono::steady_clock::time_point lastConnectionCheck;
     
@@ -66,12 +65,10 @@ private:
     static constexpr int VALIDATION_FRAMES = 2;
     
     void CheckInputs();
-    void CheckEnhancedInput(std::function<bool(float&)> getValue, EnhancedInputState& state, TrickAction action);
-    bool GetTriggerValue(float& value);
-    bool GetGripValue(float& value);
-    bool GetThumbstickValue(float& value);
+    void CheckEnhancedInput(bool rawPressed, float rawValue, EnhancedInputState& state, TrickAction action);
     bool IsDebounceTimeElapsed(const EnhancedInputState& state) const;
     bool IsControllerDetected() const;
+    const Native::ControllerSample& GetSample() const;
     void HandleControllerConnectionChange(bool connected);
     
 #ifdef DEBUG
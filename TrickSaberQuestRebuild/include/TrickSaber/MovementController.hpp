@@ -3,31 +3,23 @@
 #include "UnityEngine/Vector3.hpp"
 #include "UnityEngine/Quaternion.hpp"
 #include "UnityEngine/Transform.hpp"
-#include <vector>
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/FlickDetector.hpp"
 
 namespace TrickSaber {
     class MovementController {
     private:
-        // Velocity buffers for smoothing (PC parity)
-        static std::vector<UnityEngine::Vector3> leftVelocityBuffer;
-        static std::vector<UnityEngine::Vector3> rightVelocityBuffer;
-        static std::vector<UnityEngine::Vector3> leftAngularVelocityBuffer;
-        static std::vector<UnityEngine::Vector3> rightAngularVelocityBuffer;
-        
-        // Buffer indices
-        static int leftBufferIndex;
-        static int rightBufferIndex;
+        // Both hands' smoothing, pose history and previous pose (IL2CPP-free core)
+        static Native::HandTracker tracker;
         static bool initialized;
         
-        // Previous transform data
-        static UnityEngine::Vector3 prevLeftHandPos;
-        static UnityEngine::Vector3 prevRightHandPos;
-        static UnityEngine::Quaternion prevLeftHandRot;
-        static UnityEngine::Quaternion prevRightHandRot;
+        // Flick peaks per hand when config.enableFlickThrow is set
+        static Native::FlickDetector flickDetectors[2];
+        static Native::FlickEvent pendingFlicks[2];
+        static bool hasPendingFlick[2];
         
-        // Helper methods
-        static UnityEngine::Vector3 CalculateAngularVelocity(UnityEngine::Quaternion prevRot, UnityEngine::Quaternion currentRot, float deltaTime);
-        static void AddVelocityProbe(UnityEngine::Vector3 velocity, UnityEngine::Vector3 angularVelocity, bool isLeft);
+        static void CacheVelocities();
+        static void DetectFlicks(double timestamp, uint32_t handMask, const Native::Vec3 positions[2]);
         
     public:
         // Current velocity values
@@ -46,6 +38,16 @@ namespace TrickSaber {
         static UnityEngine::Vector3 GetAverageVelocity(bool isLeft);
         static UnityEngine::Vector3 GetAverageAngularVelocity(bool isLeft);
         
+        // Monotonic timestamp shared by pose samples and input edges (seconds)
+        static double GetTimestamp();
+        
+        // Velocity over the windowMs before time; false if the history is too short
+        static bool VelocityAt(bool isLeft, double time, float windowMs,
+            UnityEngine::Vector3& velocity, UnityEngine::Vector3& angularVelocity);
+        
+        // Takes the flick detected for this hand since the last call, if any
+        static bool ConsumeFlick(bool isLeft, Native::FlickEvent& flick);
+        
         // Legacy compatibility methods
         static UnityEngine::Vector3 GetLeftVelocity();
         static UnityEngine::Vector3 GetRightVelocity();
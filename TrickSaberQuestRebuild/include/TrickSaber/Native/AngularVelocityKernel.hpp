@@ -0,0 +1,45 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace TrickSaber::Native {
+    // acos(w) / sqrt(1 - w^2) for w in [0, 1], i.e. (theta/2) / sin(theta/2).
+    // Degree-6 Chebyshev fit; max relative error 2.9e-6 over the whole range.
+    // The function is smooth at w = 1 (identity, value 1), so unlike the
+    // acos/sin form there is no 0/0 to guard against near zero rotation.
+    inline float HalfAngleRatio(float w) {
+        constexpr float c0 = 1.5707917f;
+        constexpr float c1 = -0.999542399f;
+        constexpr float c2 = 0.777722417f;
+        constexpr float c3 = -0.616057222f;
+        constexpr float c4 = 0.417915612f;
+        constexpr float c5 = -0.192474865f;
+        constexpr float c6 = 0.0416471676f;
+        return c0 + w * (c1 + w * (c2 + w * (c3 + w * (c4 + w * (c5 + w * c6)))));
+    }
+
+    // Quaternion log-map angular velocity (rad/s, world frame) taking prev to
+    // current over 1/invDeltaTime seconds, for both hands in one pass. No
+    // branches: the shortest-arc sign flip is a copysign and |w| is clamped.
+    inline void AngularVelocity2(const Quat prev[2], const Quat current[2], float invDeltaTime, Vec3 out[2]) {
+        for (int hand = 0; hand < 2; ++hand) {
+            Quat q = current[hand] * Conjugate(prev[hand]);
+            float sign = std::copysign(1.0f, q.w);
+            float w = std::min(std::fabs(q.w), 1.0f);
+            float gain = 2.0f * sign * HalfAngleRatio(w) * invDeltaTime;
+            out[hand] = {q.x * gain, q.y * gain, q.z * gain};
+        }
+    }
+
+    // Single-hand convenience wrapper
+    inline Vec3 AngularVelocity(const Quat& prev, const Quat& current, float deltaTime) {
+        Quat p[2] = {prev, prev};
+        Quat c[2] = {current, current};
+        Vec3 out[2];
+        AngularVelocity2(p, c, 1.0f / deltaTime, out);
+        return out[0];
+    }
+}
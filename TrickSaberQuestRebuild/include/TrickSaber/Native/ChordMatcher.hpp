@@ -0,0 +1,81 @@
+#pragma once
+
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/InputChannels.hpp"
+#include "TrickSaber/Config.hpp"
+#include "TrickSaber/Enums.hpp"
+
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    // One bit per (hand, InputSlot), left hand in the low bits
+    using ChordMask = uint16_t;
+    inline constexpr int ChordBitCount = 2 * InputSlotCount;
+
+    constexpr ChordMask ChordBit(int hand, InputSlot slot) {
+        return static_cast<ChordMask>(1u << (hand * InputSlotCount + slot));
+    }
+
+    constexpr ChordMask HandChordMask(int hand) {
+        return static_cast<ChordMask>(((1u << InputSlotCount) - 1) << (hand * InputSlotCount));
+    }
+
+    // Inputs that must all be held, pressed no more than window seconds apart
+    struct ChordBinding {
+        ChordMask mask = 0;
+        TrickAction action = TrickAction::None;
+        float window = Constants::COMBINATION_WINDOW_MS / 1000.0f;
+    };
+
+    enum class ChordTransition : uint8_t {
+        None,
+        Started,
+        Ended
+    };
+
+    // Matches held inputs against chord bindings through a lookup table built
+    // when the bindings change, so a frame costs one table read however many
+    // chords are bound. A chord starts on a press edge when it is the most
+    // specific binding covered by the held inputs, and ends when any of its
+    // inputs is released. One chord is active at a time.
+    class ChordMatcher {
+    public:
+        static constexpr int MaxBindings = 32;
+
+        // Copies the bindings and rebuilds the table; ends the active chord
+        // without reporting it. Bindings beyond MaxBindings are ignored.
+        void SetBindings(const ChordBinding* bindings, int count);
+        void Reset();
+
+        // Feeds the inputs held this frame. On Started or Ended, binding is the
+        // chord that changed.
+        ChordTransition Update(ChordMask pressed, double time, ChordBinding& binding);
+
+        // Binding the table resolves a held mask to, before the time window
+        const ChordBinding* Lookup(ChordMask pressed) const {
+            uint8_t entry = table[pressed & FullMask];
+            return entry ? &bindings[entry - 1] : nullptr;
+        }
+
+        const ChordBinding* Active() const { return active >= 0 ? &bindings[active] : nullptr; }
+        int BindingCount() const { return bindingCount; }
+        double PressTime(int bit) const { return pressTimes[bit]; }
+
+    private:
+        static constexpr ChordMask FullMask = static_cast<ChordMask>((1u << ChordBitCount) - 1);
+
+        bool WithinWindow(const ChordBinding& binding) const;
+
+        ChordBinding bindings[MaxBindings];
+        int bindingCount = 0;
+        uint8_t table[1u << ChordBitCount] = {};   // binding index + 1, 0 for none
+        double pressTimes[ChordBitCount] = {};
+        ChordMask held = 0;
+        int active = -1;
+    };
+
+    // The two-input combinations InputManager has always offered, for each
+    // hand, from the configured per-input actions. The chord triggers the
+    // first input's action. Returns the number written.
+    int BuildConfigChords(const Config& config, ChordBinding* out, int capacity);
+}
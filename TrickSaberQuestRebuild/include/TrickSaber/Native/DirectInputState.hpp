@@ -0,0 +1,46 @@
+#pragma once
+
+#include "TrickSaber/Constants.hpp"
+
+namespace TrickSaber::Native {
+    // Press/release edges for one controller's direct bindings
+    struct DirectInputEdges {
+        bool triggerDown;
+        bool triggerPressed;
+        bool triggerReleased;
+        bool thumbstickActive;
+        bool thumbstickPressed;
+        bool thumbstickReleased;
+        float thumbstickValue;
+    };
+
+    // Edge detection behind SaberTrickManager::CheckDirectInput. thumbstickValue
+    // is the stick x mirrored so that outward is positive for either hand.
+    class DirectInputState {
+    public:
+        DirectInputEdges Update(bool triggerDown, float thumbstickValue) {
+            bool thumbstickActive = thumbstickValue > Constants::SIMPLIFIED_THUMBSTICK_THRESHOLD;
+            DirectInputEdges edges{
+                triggerDown,
+                triggerDown && !triggerWasDown,
+                !triggerDown && triggerWasDown,
+                thumbstickActive,
+                thumbstickActive && !thumbstickWasActive,
+                !thumbstickActive && thumbstickWasActive,
+                thumbstickValue
+            };
+            triggerWasDown = triggerDown;
+            thumbstickWasActive = thumbstickActive;
+            return edges;
+        }
+
+        void Reset() {
+            triggerWasDown = false;
+            thumbstickWasActive = false;
+        }
+
+    private:
+        bool triggerWasDown = false;
+        bool thumbstickWasActive = false;
+    };
+}
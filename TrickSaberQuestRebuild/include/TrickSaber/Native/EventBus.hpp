@@ -0,0 +1,126 @@
+#pragma once
+
+#include "TrickSaber/Enums.hpp"
+#include "TrickSaber/Native/HandTracker.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+namespace TrickSaber::Native {
+    // Trick lifecycle events, passed by const reference to every subscriber
+    struct TrickStartedEvent {
+        double time;
+        TrickAction action;
+        uint8_t hand;
+    };
+
+    struct TrickEndingEvent {
+        double time;
+        TrickAction action;
+        uint8_t hand;
+    };
+
+    struct TrickEndedEvent {
+        double time;
+        float duration;     // seconds since the matching start
+        TrickAction action;
+        uint8_t hand;
+    };
+
+    // Fixed list of (function, context) subscribers for one event type.
+    // Publish is a loop over plain function pointers: no allocation, no
+    // type erasure. Subscribing from inside a handler is not supported.
+    template<typename Event, std::size_t Capacity>
+    class EventChannel {
+        static_assert(std::is_trivially_copyable_v<Event>, "Events are plain data");
+
+    public:
+        using Handler = void (*)(void* context, const Event& event);
+
+        // False if the list is full; subscribing the same pair twice is a no-op
+        bool Subscribe(Handler handler, void* context) {
+            if (!handler) return false;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (subscribers[i].handler == handler && subscribers[i].context == context) return true;
+            }
+            if (count == Capacity) return false;
+            subscribers[count++] = {handler, context};
+            return true;
+        }
+
+        // Keeps the remaining subscribers in order
+        bool Unsubscribe(Handler handler, void* context) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (subscribers[i].handler != handler || subscribers[i].context != context) continue;
+                for (std::size_t j = i + 1; j < count; ++j) subscribers[j - 1] = subscribers[j];
+                subscribers[--count] = {};
+                return true;
+            }
+            return false;
+        }
+
+        void Publish(const Event& event) {
+            publishCount++;
+            for (std::size_t i = 0; i < count; ++i) {
+                subscribers[i].handler(subscribers[i].context, event);
+            }
+        }
+
+        std::size_t Count() const { return count; }
+        uint64_t GetPublishCount() const { return publishCount; }
+        void ResetCounters() { publishCount = 0; }
+
+        void Clear() {
+            subscribers = {};
+            count = 0;
+        }
+
+    private:
+        struct Subscriber {
+            Handler handler = nullptr;
+            void* context = nullptr;
+        };
+
+        std::array<Subscriber, Capacity> subscribers{};
+        std::size_t count = 0;
+        uint64_t publishCount = 0;
+    };
+
+    // One channel per event type, picked at compile time
+    template<std::size_t Capacity, typename... Events>
+    class EventBus {
+    public:
+        template<typename Event>
+        using Channel = EventChannel<Event, Capacity>;
+
+        template<typename Event>
+        using Handler = typename Channel<Event>::Handler;
+
+        template<typename Event>
+        Channel<Event>& Get() { return std::get<Channel<Event>>(channels); }
+
+        template<typename Event>
+        const Channel<Event>& Get() const { return std::get<Channel<Event>>(channels); }
+
+        template<typename Event>
+        bool Subscribe(Handler<Event> handler, void* context) { return Get<Event>().Subscribe(handler, context); }
+
+        template<typename Event>
+        bool Unsubscribe(Handler<Event> handler, void* context) { return Get<Event>().Unsubscribe(handler, context); }
+
+        template<typename Event>
+        void Publish(const Event& event) { Get<Event>().Publish(event); }
+
+        uint64_t GetPublishCount() const { return (Get<Events>().GetPublishCount() + ...); }
+        void ResetCounters() { (Get<Events>().ResetCounters(), ...); }
+        void Clear() { (Get<Events>().Clear(), ...); }
+
+    private:
+        std::tuple<Channel<Events>...> channels;
+    };
+
+    using TrickEventBus = EventBus<8, TrickStartedEvent, TrickEndingEvent, TrickEndedEvent>;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    // Splits variable frame times into whole fixed steps and keeps the
+    // remainder for the next frame. Alpha is how far the remainder reaches
+    // into the next step, for blending the last two simulated states.
+    //
+    // The accumulator is a double so a run of float frame times adds up to
+    // whole steps without drift; a remainder within Tolerance of a full step
+    // counts as one. Frames longer than maxSteps steps drop the excess.
+    class FixedStepAccumulator {
+    public:
+        static constexpr double Tolerance = 1e-6;
+
+        explicit FixedStepAccumulator(float step, int maxSteps) : step(step), maxSteps(maxSteps) {}
+
+        // Steps to simulate for a frame of deltaTime seconds
+        int Advance(float deltaTime) {
+            if (deltaTime > 0.0f) accumulator += deltaTime;
+
+            int steps = 0;
+            while (accumulator + Tolerance >= step && steps < maxSteps) {
+                accumulator -= step;
+                steps++;
+            }
+            if (accumulator >= step) {
+                // Hitch past the cap: keep the fraction, drop whole steps
+                double dropped = step * std::floor(accumulator / step);
+                droppedTime += dropped;
+                accumulator -= dropped;
+            }
+            stepCount += static_cast<uint32_t>(steps);
+            return steps;
+        }
+
+        float Alpha() const { return std::clamp(static_cast<float>(accumulator / step), 0.0f, 1.0f); }
+        float Step() const { return step; }
+        uint32_t GetStepCount() const { return stepCount; }
+        double GetDroppedTime() const { return droppedTime; }
+
+        void Reset() {
+            accumulator = 0.0;
+            stepCount = 0;
+            droppedTime = 0.0;
+        }
+
+    private:
+        float step;
+        int maxSteps;
+        double accumulator = 0.0;
+        uint32_t stepCount = 0;
+        double droppedTime = 0.0;
+    };
+}
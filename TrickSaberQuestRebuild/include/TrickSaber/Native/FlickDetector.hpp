@@ -0,0 +1,71 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+#include "TrickSaber/Constants.hpp"
+
+namespace TrickSaber::Native {
+    struct FlickParams {
+        float minPeakSpeed = Constants::DEFAULT_FLICK_MIN_PEAK_SPEED;
+        float minPeakJerk = Constants::DEFAULT_FLICK_MIN_PEAK_JERK;
+        float cooldown = Constants::DEFAULT_FLICK_COOLDOWN;
+        float smoothing = Constants::FLICK_VELOCITY_SMOOTHING;
+    };
+
+    // A detected speed peak. time and velocity are those of the peak sample.
+    struct FlickEvent {
+        double time;
+        Vec3 velocity;
+        float speed;
+    };
+
+    // Streaming flick classifier for one hand, O(1) and allocation-free per
+    // sample. Speed comes from finite differences with a light EMA. A flick is
+    // a local speed maximum above minPeakSpeed whose jerk is sharp enough to
+    // rule out a slow sweep. It is reported one sample after the peak.
+    class FlickDetector {
+    public:
+        void Configure(const FlickParams& params) { this->params = params; }
+        void Reset();
+
+        // Returns true and fills event when the previous sample was a flick peak
+        bool Update(double time, const Vec3& position, FlickEvent& event);
+
+        float Speed() const { return speed; }
+
+    private:
+        FlickParams params;
+
+        int samples = 0;
+        double lastTime = 0.0;
+        Vec3 lastPosition = Zero3();
+        Vec3 velocity = Zero3();
+        float speed = 0.0f;
+        float acceleration = 0.0f;
+        double cooldownUntil = 0.0;
+    };
+
+    // A flick stands in for a trigger press that never gets a release, so
+    // the press is held for holdTime and then let go. A real trigger edge
+    // takes over: Cancel drops the pending release.
+    class FlickHold {
+    public:
+        void Start(double time, float holdTime) {
+            releaseAt = time + holdTime;
+            held = true;
+        }
+
+        // True once, on the first call at or past the release time
+        bool Expired(double now) {
+            if (!held || now < releaseAt) return false;
+            held = false;
+            return true;
+        }
+
+        void Cancel() { held = false; }
+        bool IsHeld() const { return held; }
+
+    private:
+        double releaseAt = 0.0;
+        bool held = false;
+    };
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace TrickSaber::Native {
+    // Engine and wall-clock time for one Unity frame. now is on the
+    // MonotonicSeconds timebase and steadyNow is the same instant as a
+    // time_point, so interval math and pose/event timestamps agree.
+    struct FrameTime {
+        uint64_t frame = 0;
+        std::chrono::steady_clock::time_point steadyNow{};
+        double now = 0.0;
+        float time = 0.0f;              // Time.time
+        float deltaTime = 0.0f;
+        float fixedDeltaTime = 0.0f;
+    };
+
+    // Holds the time for the current frame. The first Advance of a frame reads
+    // the steady clock once and runs the sampler, which fills the engine fields;
+    // later calls in that frame only compare the frame id.
+    //
+    // Only Update-phase callers may advance it: inside FixedUpdate the engine
+    // reports the fixed step as deltaTime, and the whole frame would be
+    // cached with it.
+    class FrameClockState {
+    public:
+        template<typename Sampler>
+        bool Advance(uint64_t frame, Sampler&& sample) {
+            beginCount++;
+            if (valid && current.frame == frame) return false;
+
+            FrameTime next;
+            next.frame = frame;
+            next.steadyNow = std::chrono::steady_clock::now();
+            next.now = std::chrono::duration<double>(next.steadyNow.time_since_epoch()).count();
+            std::forward<Sampler>(sample)(next);
+
+            current = next;
+            valid = true;
+            frameCount++;
+            return true;
+        }
+
+        // Forces the next Advance to sample and clears the counters
+        void Reset() {
+            valid = false;
+            beginCount = 0;
+            frameCount = 0;
+        }
+
+        const FrameTime& Current() const { return current; }
+        bool IsValid() const { return valid; }
+        uint64_t GetBeginCount() const { return beginCount; }
+        uint64_t GetFrameCount() const { return frameCount; }
+
+    private:
+        FrameTime current;
+        bool valid = false;
+        uint64_t beginCount = 0;
+        uint64_t frameCount = 0;
+    };
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "TrickSaber/Native/HandTracker.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    // One object per hand, indexed by Hand. Owners join when they come up and
+    // leave when they go away, so lookups never have to search the scene.
+    template<typename T>
+    class HandSlots {
+    public:
+        // Takes the slot; returns the previous occupant, if any
+        T* Join(int hand, T* item) {
+            T* previous = slots[hand];
+            slots[hand] = item;
+            joinCount++;
+            return previous;
+        }
+
+        // Clears the slot only if item still holds it
+        bool Leave(int hand, const T* item) {
+            if (!item || slots[hand] != item) return false;
+            slots[hand] = nullptr;
+            leaveCount++;
+            return true;
+        }
+
+        T* Get(int hand) const { return slots[hand]; }
+
+        // Both slots, either may be null
+        const std::array<T*, 2>& All() const { return slots; }
+
+        int Count() const { return (slots[LeftHand] ? 1 : 0) + (slots[RightHand] ? 1 : 0); }
+
+        void Clear() {
+            slots = {};
+            ResetCounters();
+        }
+
+        void ResetCounters() {
+            joinCount = 0;
+            leaveCount = 0;
+        }
+
+        uint64_t GetJoinCount() const { return joinCount; }
+        uint64_t GetLeaveCount() const { return leaveCount; }
+
+    private:
+        std::array<T*, 2> slots{};
+        uint64_t joinCount = 0;
+        uint64_t leaveCount = 0;
+    };
+}
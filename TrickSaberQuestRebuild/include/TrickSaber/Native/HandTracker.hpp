@@ -0,0 +1,48 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+#include "TrickSaber/Native/VelocityEstimator.hpp"
+#include "TrickSaber/Native/PoseHistory.hpp"
+
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    enum Hand : int {
+        LeftHand = 0,
+        RightHand = 1
+    };
+
+    // Both controllers' velocity state: finite differences, the log-map
+    // angular kernel, per-hand smoothing and the timestamped pose history.
+    // MovementController feeds it transforms once per physics tick.
+    class HandTracker {
+    public:
+        static constexpr uint32_t LeftMask = 1u << LeftHand;
+        static constexpr uint32_t RightMask = 1u << RightHand;
+
+        void Configure(VelocityFilterMode mode, const VelocityFilterParams& params);
+        void Reset();
+
+        // Hands missing from handMask keep their previous pose and velocity
+        void Update(double time, float deltaTime, uint32_t handMask, const Vec3 positions[2], const Quat rotations[2]);
+
+        const Vec3& Velocity(int hand) const { return velocity[hand]; }
+        const Vec3& AngularVelocity(int hand) const { return angularVelocity[hand]; }
+        const Vec3& Position(int hand) const { return position[hand]; }
+        const Quat& Rotation(int hand) const { return rotation[hand]; }
+
+        // Velocity over windowSeconds before time; false if the history is too short
+        bool VelocityAt(int hand, double time, double windowSeconds, Vec3& linear, Vec3& angular) const {
+            return history[hand].VelocityAt(time, windowSeconds, linear, angular);
+        }
+
+    private:
+        VelocityEstimatorSet estimators[2];
+        PoseHistory history[2];
+
+        Vec3 position[2] = {Zero3(), Zero3()};
+        Quat rotation[2] = {IdentityQuat(), IdentityQuat()};
+        Vec3 velocity[2] = {Zero3(), Zero3()};
+        Vec3 angularVelocity[2] = {Zero3(), Zero3()};
+    };
+}
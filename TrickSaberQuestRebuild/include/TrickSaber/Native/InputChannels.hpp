@@ -0,0 +1,148 @@
+#pragma once
+
+#include "TrickSaber/Native/InputSnapshot.hpp"
+#include "TrickSaber/Config.hpp"
+#include "TrickSaber/Constants.hpp"
+#include "TrickSaber/Enums.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace TrickSaber::Native {
+    // Where a channel's value comes from in a ControllerSample
+    enum class InputSource : uint8_t {
+        Trigger,
+        Grip,
+        Thumbstick,             // spin-mode aware (InputManager)
+        ThumbstickHorizontal,   // stick x past the deadzone (InputManagerEnhanced)
+        ButtonOne,
+        ButtonTwo
+    };
+
+    // Per-frame values the table's accessors resolve against
+    struct ChannelContext {
+        const Config* config = nullptr;
+        bool isLeft = false;
+        float triggerThreshold = 0.0f;
+        float thumbstickThreshold = 0.0f;
+    };
+
+    // One bound input. slot indexes the consumer's own per-channel state.
+    struct InputChannel {
+        InputSource source;
+        uint8_t slot;
+        TrickAction Config::* action;
+        bool Config::* reverse;
+        float ChannelContext::* threshold;  // nullptr for digital buttons
+    };
+
+    enum InputSlot : uint8_t {
+        TriggerSlot,
+        GripSlot,
+        ThumbstickSlot,
+        ButtonOneSlot,
+        ButtonTwoSlot,
+        InputSlotCount
+    };
+
+    // Grip has always shared the trigger threshold
+    inline constexpr InputChannel DirectInputChannels[] = {
+        {InputSource::Trigger, TriggerSlot, &Config::triggerAction, &Config::reverseTrigger, &ChannelContext::triggerThreshold},
+        {InputSource::Grip, GripSlot, &Config::gripAction, &Config::reverseGrip, &ChannelContext::triggerThreshold},
+        {InputSource::Thumbstick, ThumbstickSlot, &Config::thumbstickAction, &Config::reverseThumbstick, &ChannelContext::thumbstickThreshold},
+        {InputSource::ButtonOne, ButtonOneSlot, &Config::buttonOneAction, &Config::reverseButtonOne, nullptr},
+        {InputSource::ButtonTwo, ButtonTwoSlot, &Config::buttonTwoAction, &Config::reverseButtonTwo, nullptr}
+    };
+
+    inline constexpr InputChannel SmoothedInputChannels[] = {
+        {InputSource::Trigger, TriggerSlot, &Config::triggerAction, &Config::reverseTrigger, &ChannelContext::triggerThreshold},
+        {InputSource::Grip, GripSlot, &Config::gripAction, &Config::reverseGrip, &ChannelContext::triggerThreshold},
+        {InputSource::ThumbstickHorizontal, ThumbstickSlot, &Config::thumbstickAction, &Config::reverseThumbstick, &ChannelContext::thumbstickThreshold}
+    };
+
+    // Reads one channel; returns whether it is pressed and writes its value
+    template<InputChannel Channel>
+    inline bool ReadChannel(const ControllerSample& sample, const ChannelContext& context, float& value) {
+        const Config& cfg = *context.config;
+        bool reverse = cfg.*(Channel.reverse);
+
+        if constexpr (Channel.source == InputSource::Trigger || Channel.source == InputSource::Grip) {
+            value = std::clamp(Channel.source == InputSource::Trigger ? sample.trigger : sample.grip, 0.0f, 1.0f);
+            if (reverse) value = 1.0f - value;
+            return value >= context.*(Channel.threshold);
+        } else if constexpr (Channel.source == InputSource::ButtonOne || Channel.source == InputSource::ButtonTwo) {
+            bool pressed = sample.Pressed(Channel.source == InputSource::ButtonOne ? Trace::ButtonOne : Trace::ButtonTwo);
+            value = pressed ? 1.0f : 0.0f;
+            if (reverse) value = 1.0f - value;
+            return pressed;
+        } else if constexpr (Channel.source == InputSource::ThumbstickHorizontal) {
+            if (std::hypot(sample.stickX, sample.stickY) < cfg.thumbstickDeadzone) {
+                value = 0.0f;
+                return false;
+            }
+            value = reverse ? -sample.stickX : sample.stickX;
+            return std::abs(value) >= context.*(Channel.threshold);
+        } else {
+            float threshold = context.*(Channel.threshold);
+            if (cfg.spinMode == SpinMode::Momentum && cfg.thumbstickAction == TrickAction::Spin) {
+                bool clicked = sample.Pressed(Trace::ThumbstickClick);
+                value = clicked ? 1.0f : 0.0f;
+                return clicked;
+            }
+
+            float magnitude = std::hypot(sample.stickX, sample.stickY);
+            if (magnitude < cfg.thumbstickDeadzone) {
+                value = 0.0f;
+                return false;
+            }
+
+            switch (cfg.spinMode) {
+                case SpinMode::OmniDirectional: {
+                    float xValue = std::abs(sample.stickX);
+                    float yValue = std::abs(sample.stickY);
+                    if (xValue > yValue && xValue >= threshold) {
+                        value = sample.stickX;
+                    } else if (yValue >= threshold) {
+                        value = sample.stickY;
+                    } else {
+                        value = 0.0f;
+                        return false;
+                    }
+                    break;
+                }
+                case SpinMode::AngleSpeed:
+                    value = magnitude >= threshold ?
+                        std::atan2(sample.stickY, sample.stickX) * Constants::RADIANS_TO_DEGREES : 0.0f;
+                    break;
+
+                case SpinMode::Traditional:
+                default: {
+                    bool correctDirection = context.isLeft ?
+                        (sample.stickX < -cfg.thumbstickDeadzone) : (sample.stickX > cfg.thumbstickDeadzone);
+                    if (!correctDirection || std::abs(sample.stickX) < threshold) {
+                        value = 0.0f;
+                        return false;
+                    }
+                    value = sample.stickX;
+                    break;
+                }
+            }
+
+            if (reverse) value = -value;
+            return std::abs(value) >= threshold;
+        }
+    }
+
+    // Unrolls visit.template operator()<Channel>() over a channel table at
+    // compile time, so each channel's read and state update inline flat.
+    template<const auto& Table, typename Visitor>
+    inline void VisitChannels(Visitor&& visit) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (visit.template operator()<Table[I]>(), ...);
+        }(std::make_index_sequence<std::size(Table)>{});
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    enum class InputEdge : uint8_t {
+        Press,
+        Release,
+        Update,     // value change while held (spin speed)
+        Arm,        // partial pull crossed the arm threshold
+        Disarm      // partial pull released without firing
+    };
+
+    // One input edge, stamped with the snapshot time it was read at
+    struct InputEvent {
+        double time;
+        float value;
+        uint8_t hand;       // 0 left, 1 right
+        uint8_t action;     // TrickAction
+        InputEdge edge;
+        uint8_t padding;
+    };
+    static_assert(sizeof(InputEvent) == 16, "InputEvent should stay two words");
+
+    // Fixed-capacity single-producer/single-consumer ring. Push never blocks:
+    // a full ring drops the event and counts it.
+    template<typename T, std::size_t Capacity>
+    class SpscQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        // Producer side
+        bool Push(const T& item) {
+            uint32_t head = writeIndex.load(std::memory_order_relaxed);
+            if (head - readIndex.load(std::memory_order_acquire) >= Capacity) {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            items[head & Mask] = item;
+            writeIndex.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side
+        bool Pop(T& item) {
+            uint32_t tail = readIndex.load(std::memory_order_relaxed);
+            if (tail == writeIndex.load(std::memory_order_acquire)) return false;
+            item = items[tail & Mask];
+            readIndex.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side; discards everything queued so far
+        void Clear() {
+            readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+        std::size_t Size() const {
+            return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+        }
+
+        uint64_t GetDroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+        static constexpr std::size_t GetCapacity() { return Capacity; }
+
+    private:
+        static constexpr uint32_t Mask = static_cast<uint32_t>(Capacity - 1);
+
+        alignas(64) std::atomic<uint32_t> writeIndex{0};
+        alignas(64) std::atomic<uint32_t> readIndex{0};
+        std::atomic<uint64_t> droppedCount{0};
+        T items[Capacity];
+    };
+
+    // Drained every frame, so it only has to absorb a burst of edges
+    using InputEventQueue = SpscQueue<InputEvent, 64>;
+
+    // Delay between an event's timestamp and the moment it was acted on
+    struct LatencyStats {
+        uint64_t count = 0;
+        double total = 0.0;
+        double max = 0.0;
+
+        void Record(double seconds) {
+            count++;
+            total += seconds;
+            max = std::max(max, seconds);
+        }
+
+        double Mean() const { return count > 0 ? total / count : 0.0; }
+        void Reset() { *this = LatencyStats{}; }
+    };
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/TraceFormat.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace TrickSaber::Native {
+    // One controller's raw state for a frame. Buttons use Trace::InputButton
+    // bits so a sample can be written to a trace as-is.
+    struct ControllerSample {
+        bool connected = false;
+        uint32_t buttons = 0;
+        float trigger = 0.0f;
+        float grip = 0.0f;
+        float stickX = 0.0f;
+        float stickY = 0.0f;
+
+        bool Pressed(uint32_t button) const { return (buttons & button) != 0; }
+    };
+
+    // Both controllers, indexed by Hand
+    struct InputSnapshot {
+        uint64_t frame = 0;
+        double time = 0.0;
+        ControllerSample hands[2];
+    };
+
+    // Holds the snapshot for the current frame. The first Acquire of a frame
+    // runs the sampler, which fills both hands and returns how many engine
+    // calls it made; later reads in that frame return the cached copy.
+    class InputSnapshotBuffer {
+    public:
+        template<typename Sampler>
+        const InputSnapshot& Acquire(uint64_t frame, double time, Sampler&& sample) {
+            readCount++;
+            if (valid && snapshot.frame == frame) return snapshot;
+
+            snapshot = InputSnapshot{};
+            snapshot.frame = frame;
+            snapshot.time = time;
+            interopCalls += std::forward<Sampler>(sample)(snapshot);
+            sampleCount++;
+            valid = true;
+            return snapshot;
+        }
+
+        // Forces the next Acquire to sample and clears the counters
+        void Reset() {
+            valid = false;
+            interopCalls = 0;
+            sampleCount = 0;
+            readCount = 0;
+        }
+
+        const InputSnapshot& Current() const { return snapshot; }
+        uint64_t GetInteropCallCount() const { return interopCalls; }
+        uint64_t GetSampleCount() const { return sampleCount; }
+        uint64_t GetReadCount() const { return readCount; }
+
+    private:
+        InputSnapshot snapshot;
+        bool valid = false;
+        uint64_t interopCalls = 0;
+        uint64_t sampleCount = 0;
+        uint64_t readCount = 0;
+    };
+}
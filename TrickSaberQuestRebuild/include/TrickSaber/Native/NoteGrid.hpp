@@ -0,0 +1,167 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+#include "TrickSaber/Constants.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    // Blade of a saber at the start and end of a frame
+    struct SweptBlade {
+        Vec3 base0, tip0;
+        Vec3 base1, tip1;
+    };
+
+    // Whether a sphere at center is within radius of the surface the blade
+    // swept over the frame (two triangles of the quad between the segments);
+    // writes the closest point on that surface to point
+    bool SweptBladeHits(const SweptBlade& blade, const Vec3& center, float radius, Vec3& point);
+
+    // Active notes bucketed by lane x, by their height at the cut plane and
+    // by the song time they reach it. The key is fixed from spawn to cut or
+    // miss, so the grid is only touched by Insert/Remove, never per frame.
+    //
+    // The buckets are only a broadphase. A note's real path is its jump arc
+    // (y under gravity) in a frame turned by the map's rotation; Query pads
+    // the y range by the most any note can rise or fall over the frames it
+    // could be in reach, gives up on x and z bucketing once a rotated note is
+    // in the grid, and runs the exact swept test on PositionAt.
+    //
+    // Buckets are a fixed XCells x YCells x TimeCells array of intrusive
+    // lists over a pool of Capacity notes. Time buckets wrap after
+    // TimeCells * timeCell seconds; anything aliased in is rejected by the
+    // exact swept test. Notes outside the x/y range go into the edge cells.
+    // Find looks a note up by key in a fixed open-addressed index.
+    class NoteGrid {
+    public:
+        static constexpr int Capacity = 1024;
+        static constexpr int XCells = 8;
+        static constexpr int YCells = 8;
+        static constexpr int TimeCells = 64;
+
+        using Handle = uint16_t;
+        static constexpr Handle None = 0xFFFF;
+
+        struct Layout {
+            float cellSize;     // m, x and y
+            float timeCell;     // s
+            float minX;
+            float minY;
+            float cutPlaneZ;    // z where a note is at its arrival time
+            float radius;       // cut distance from a note's center
+        };
+
+        // Centred on the lanes, from just below the floor up
+        static constexpr Layout DefaultLayout() {
+            return {Constants::NOTE_GRID_CELL, Constants::NOTE_GRID_TIME_CELL,
+                -0.5f * XCells * Constants::NOTE_GRID_CELL, -Constants::NOTE_GRID_CELL, 0.0f, Constants::NOTE_CUT_RADIUS};
+        }
+
+        // Path in the note's move frame, taken about its arrival: at song
+        // time arrival + s it is at (x, y + verticalVelocity * s - gravity * s^2 / 2,
+        // cutPlaneZ - speed * s), turned by rotation
+        struct Note {
+            uint64_t key;
+            float x, y;
+            float arrival;      // song time at the cut plane
+            float speed;        // m/s towards -z
+            float verticalVelocity = 0.0f;     // m/s at arrival
+            float gravity = 0.0f;               // m/s^2, downwards
+            Quat rotation = IdentityQuat();     // map rotation, about +y
+        };
+
+        explicit NoteGrid(const Layout& layout);
+
+        // None when the pool is full; the note is then not cuttable
+        Handle Insert(const Note& note);
+        // False if handle is stale or no longer holds key
+        bool Remove(Handle handle, uint64_t key);
+        // None if no note with key is in the grid
+        Handle Find(uint64_t key) const;
+        void Clear();
+
+        Vec3 PositionAt(const Note& note, float time) const {
+            float s = time - note.arrival;
+            Vec3 local{note.x, note.y + (note.verticalVelocity - 0.5f * note.gravity * s) * s, layout.cutPlaneZ - s * note.speed};
+            return Rotate(note.rotation, local);
+        }
+
+        // Calls onHit(const Note&, const Vec3& point) for each note the blade
+        // swept through between songTime - deltaTime and songTime, with the
+        // note's own motion over the frame taken into account. Only the
+        // buckets the swept volume overlaps are visited.
+        template <typename Fn>
+        int Query(const SweptBlade& blade, float songTime, float deltaTime, Fn&& onHit) {
+            candidates = 0;
+            Range range;
+            if (count == 0 || !Bounds(blade, songTime, deltaTime, range)) return 0;
+
+            int hits = 0;
+            float startTime = songTime - deltaTime;
+            for (int t = range.t0; t <= range.t1; ++t) {
+                int ring = ((t % TimeCells) + TimeCells) % TimeCells;
+                for (int y = range.y0; y <= range.y1; ++y) {
+                    for (int x = range.x0; x <= range.x1; ++x) {
+                        for (Handle i = heads[Cell(x, y, ring)]; i != None; i = links[i].next) {
+                            const Note& note = notes[i];
+                            candidates++;
+                            // The note moved too: test in its frame over the frame
+                            Vec3 from = PositionAt(note, startTime);
+                            Vec3 to = PositionAt(note, songTime);
+                            SweptBlade relative{blade.base0 - from, blade.tip0 - from, blade.base1 - to, blade.tip1 - to};
+                            Vec3 point;
+                            if (SweptBladeHits(relative, Zero3(), layout.radius, point)) {
+                                hits++;
+                                onHit(note, point + to);
+                            }
+                        }
+                    }
+                }
+            }
+            return hits;
+        }
+
+        int Size() const { return count; }
+        // Notes tested by the last Query
+        uint32_t GetCandidateCount() const { return candidates; }
+
+    private:
+        struct Link {
+            Handle prev = None;
+            Handle next = None;
+            uint16_t cell = 0;
+        };
+
+        // Inclusive cell ranges; time cells are unwrapped
+        struct Range {
+            int x0, x1, y0, y1, t0, t1;
+        };
+
+        // Twice the pool, so probes stay short at full load
+        static constexpr int IndexSize = 2 * Capacity;
+
+        static int Cell(int x, int y, int ring) { return (ring * YCells + y) * XCells + x; }
+        static int Home(uint64_t key) {
+            return static_cast<int>((key * 0x9E3779B97F4A7C15ull) >> 53) & (IndexSize - 1);
+        }
+        int ClampX(float x) const;
+        int ClampY(float y) const;
+        int TimeIndex(float time) const;
+        bool Bounds(const SweptBlade& blade, float songTime, float deltaTime, Range& range) const;
+
+        Layout layout;
+        std::array<Note, Capacity> notes{};
+        std::array<Link, Capacity> links{};
+        std::array<Handle, XCells * YCells * TimeCells> heads;
+        std::array<Handle, IndexSize> index;
+        Handle freeList = 0;
+        int count = 0;
+        float minSpeed = 0.0f;      // over notes inserted since Clear; widen the time range
+        float maxSpeed = 0.0f;
+        float maxVerticalSpeed = 0.0f;  // |verticalVelocity| and |gravity|; widen the y range
+        float maxGravity = 0.0f;
+        bool rotated = false;           // any note off the unrotated lanes
+        uint32_t candidates = 0;
+    };
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace TrickSaber::Native {
+    template<typename Phase>
+    struct PhaseTransition {
+        Phase from;
+        Phase to;
+    };
+
+    // Legal transitions of a phase enum, one bit row per source phase.
+    // Phase 0 is the initial phase; every phase may reset to it.
+    template<typename Phase, std::size_t Count>
+    class TransitionTable {
+        static_assert(std::is_enum_v<Phase>, "Phases are an enum");
+        static_assert(Count <= 32, "One 32-bit row per phase");
+
+    public:
+        using PhaseType = Phase;
+        static constexpr std::size_t PhaseCount = Count;
+
+        constexpr TransitionTable(std::initializer_list<PhaseTransition<Phase>> transitions) {
+            for (auto transition : transitions) {
+                rows[Index(transition.from)] |= Bit(transition.to);
+            }
+            for (auto& row : rows) row |= Bit(Phase{});
+        }
+
+        constexpr bool Allowed(Phase from, Phase to) const {
+            return Index(from) < Count && Index(to) < Count && (rows[Index(from)] & Bit(to)) != 0;
+        }
+
+    private:
+        static constexpr std::size_t Index(Phase phase) { return static_cast<std::size_t>(phase); }
+        static constexpr uint32_t Bit(Phase phase) { return 1u << Index(phase); }
+
+        std::array<uint32_t, Count> rows{};
+    };
+
+    // Current phase of a table-driven state machine plus the per-phase step
+    // handler picked when the phase is entered, so a frame is one indirect
+    // call through Handler(). Go<From, To> checks the transition against the
+    // table at compile time; TryGo is for the few transitions whose source is
+    // only known at run time and refuses anything the table does not list.
+    template<const auto& Table, typename Fn>
+    class PhaseMachine {
+    public:
+        using Phase = typename std::remove_cvref_t<decltype(Table)>::PhaseType;
+        static constexpr std::size_t Count = std::remove_cvref_t<decltype(Table)>::PhaseCount;
+        using Handlers = std::array<Fn, Count>;
+
+        explicit PhaseMachine(const Handlers& handlers) : handlers(&handlers), handler(handlers[0]) {}
+
+        Phase Get() const { return phase; }
+        Fn Handler() const { return handler; }
+
+        // Caller has already established that the machine is in From
+        template<Phase From, Phase To>
+        void Go() {
+            static_assert(Table.Allowed(From, To), "Transition not in the phase table");
+            Enter(To);
+        }
+
+        bool TryGo(Phase to) {
+            if (!Table.Allowed(phase, to)) {
+                rejected++;
+                return false;
+            }
+            Enter(to);
+            return true;
+        }
+
+        void Reset() { Enter(Phase{}); }
+
+        uint32_t GetRejectedCount() const { return rejected; }
+
+    private:
+        void Enter(Phase to) {
+            phase = to;
+            handler = (*handlers)[static_cast<std::size_t>(to)];
+        }
+
+        const Handlers* handlers;
+        Fn handler;
+        Phase phase{};
+        uint32_t rejected = 0;
+    };
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "TrickSaber/Constants.hpp"
+#include "TrickSaber/Native/VecMath.hpp"
+
+#include <chrono>
+
+namespace TrickSaber::Native {
+    // Seconds on the steady clock; pose samples and input edges share this timebase
+    inline double MonotonicSeconds() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct PoseSample {
+        double time;
+        Vec3 position;
+        Quat rotation;
+    };
+
+    // Fixed-capacity ring of timestamped hand poses. Velocity is queried over a
+    // time window instead of "last N samples", so skipped ticks and different
+    // refresh rates all cover the same span.
+    class PoseHistory {
+    public:
+        static constexpr int Capacity = Constants::POSE_HISTORY_CAPACITY;
+
+        void Clear() { count = 0; head = 0; }
+        int Count() const { return count; }
+
+        // Samples older than or too close to the newest one are dropped
+        // (Unity can run several fixed steps back to back on the same pose).
+        bool Push(double time, const Vec3& position, const Quat& rotation) {
+            if (count > 0 && time - At(count - 1).time < Constants::POSE_HISTORY_MIN_INTERVAL_SEC) {
+                return false;
+            }
+            samples[head] = {time, position, rotation};
+            head = (head + 1) % Capacity;
+            if (count < Capacity) count++;
+            return true;
+        }
+
+        // i = 0 is the oldest retained sample
+        const PoseSample& At(int i) const {
+            return samples[(head - count + i + Capacity) % Capacity];
+        }
+
+        const PoseSample& Latest() const { return At(count - 1); }
+
+        // Velocity over [t - window, t]. Linear velocity is the least-squares
+        // slope of position over the samples in the window; angular velocity is
+        // the rotation between the window ends. If the window holds fewer than
+        // two samples it is widened to the closest older one.
+        bool VelocityAt(double t, double window, Vec3& linear, Vec3& angular) const {
+            if (count < 2) return false;
+
+            int last = count - 1;
+            while (last > 0 && At(last).time > t) last--;
+
+            int first = last;
+            while (first > 0 && At(first - 1).time >= t - window) first--;
+            if (first == last) first = last - 1;
+            if (first < 0) return false;
+
+            const PoseSample& a = At(first);
+            const PoseSample& b = At(last);
+            double span = b.time - a.time;
+            if (span <= 0.0) return false;
+
+            // Times relative to the first sample keep the float math well conditioned
+            int n = last - first + 1;
+            double meanT = 0.0;
+            Vec3 meanP = Zero3();
+            for (int i = first; i <= last; ++i) {
+                meanT += At(i).time - a.time;
+                meanP += At(i).position - a.position;
+            }
+            meanT /= n;
+            meanP = meanP / static_cast<float>(n);
+
+            double varT = 0.0;
+            Vec3 covTP = Zero3();
+            for (int i = first; i <= last; ++i) {
+                float dt = static_cast<float>(At(i).time - a.time - meanT);
+                varT += static_cast<double>(dt) * dt;
+                covTP += (At(i).position - a.position - meanP) * dt;
+            }
+            linear = covTP / static_cast<float>(varT);
+
+            Quat delta = b.rotation * Conjugate(a.rotation);
+            angular = LogMap(delta) / static_cast<float>(span);
+            return true;
+        }
+
+    private:
+        PoseSample samples[Capacity] = {};
+        int head = 0;
+        int count = 0;
+    };
+}
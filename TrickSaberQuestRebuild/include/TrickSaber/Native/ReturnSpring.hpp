@@ -0,0 +1,58 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+
+namespace TrickSaber::Native {
+    // Rate (1/s) at which a critically damped spring released at rest closes
+    // an error of ratio (tolerance / start error) in duration seconds, i.e.
+    // solves (1 + w t) e^(-w t) = ratio for w.
+    float CriticalSpringRate(float ratio, float duration);
+
+    // Critically damped spring return of a pose to a target that may move
+    // every step. Step is the exact solution over deltaTime for the target it
+    // is given, so the path is the same however the time is sliced: one exp,
+    // a log and an exp map of the rotation error, and a few multiply-adds.
+    //
+    // Position and rotation share one rate, picked in Begin so both errors
+    // reach the arrival tolerance at duration if the target holds still.
+    // Step reports arrival once both are within tolerance, or once maxTime
+    // has passed (the bound when the hand keeps moving); the pose is then
+    // exactly the target.
+    class ReturnSpring {
+    public:
+        struct Tolerance {
+            float distance;     // m
+            float angle;        // degrees
+        };
+
+        void Begin(const Vec3& position, const Quat& rotation, const Vec3& targetPosition, const Quat& targetRotation,
+            float duration, float maxTime, Tolerance tolerance, const Vec3& angularVelocity = Zero3());
+
+        // True once arrived
+        bool Step(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation);
+
+        const Vec3& Position() const { return position; }
+        const Quat& Rotation() const { return rotation; }
+        float Rate() const { return rate; }
+        float Elapsed() const { return elapsed; }
+        bool Arrived() const { return arrived; }
+
+    private:
+        // Rotation as an error vector about the target: rotation = target * ExpMap(error)
+        static Vec3 RotationError(const Quat& rotation, const Quat& target) {
+            return LogMap(Conjugate(target) * rotation);
+        }
+
+        Vec3 position = Zero3();
+        Vec3 velocity = Zero3();
+        Quat rotation = IdentityQuat();
+        Vec3 angularVelocity = Zero3();     // of the error vector, rad/s
+
+        float rate = 0.0f;
+        float elapsed = 0.0f;
+        float maxTime = 0.0f;
+        float distanceSq = 0.0f;
+        float angle = 0.0f;                 // radians
+        bool arrived = true;
+    };
+}
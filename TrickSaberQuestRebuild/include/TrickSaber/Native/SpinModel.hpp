@@ -0,0 +1,87 @@
+#pragma once
+
+#include "TrickSaber/Native/PhaseMachine.hpp"
+#include "TrickSaber/Native/VecMath.hpp"
+#include "TrickSaber/Enums.hpp"
+
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    struct SpinParams {
+        bool velocityDependent = false;
+        bool completeRotation = false;
+        SpinMode mode = SpinMode::OmniDirectional;
+        SpinDir direction = SpinDir::Backward;
+        float spinSpeed = 1.0f;
+    };
+
+    enum class SpinPhase : uint8_t {
+        Idle,
+        Spinning,
+        Stopping,
+        Completing,
+        Done
+    };
+
+    // Everything not listed is a compile error in Go<From, To>
+    inline constexpr TransitionTable<SpinPhase, 5> SpinTransitions{
+        {SpinPhase::Idle, SpinPhase::Spinning},
+        {SpinPhase::Spinning, SpinPhase::Stopping},
+        {SpinPhase::Spinning, SpinPhase::Completing},
+        {SpinPhase::Spinning, SpinPhase::Done},
+        {SpinPhase::Stopping, SpinPhase::Done},
+        {SpinPhase::Completing, SpinPhase::Done},
+    };
+
+    // Target spin speed (deg/s) for a thumbstick value and controller angular velocity
+    float ComputeSpinTargetSpeed(const SpinParams& params, float input, const Vec3& angularVelocity);
+
+    // Local-rotation spin about the saber's forward axis. SpinTrick copies
+    // LocalRotation() to the transform after each Step and ends on Done.
+    // Step is one call to the handler picked when the phase was entered.
+    class SpinModel {
+    public:
+        void Start(const SpinParams& params, const Quat& localRotation, float input, const Vec3& angularVelocity);
+        void SetInput(float value) { input = value; }
+
+        // Input released: returns true if the spin ends now, false if it
+        // winds down (Stopping) or finishes its rotation (Completing) first.
+        bool Release();
+        // Snap back to the original rotation and end
+        void Finish();
+        void Reset() { machine.Reset(); }
+
+        SpinPhase Step(float deltaTime, const Vec3& angularVelocity);
+
+        SpinPhase Phase() const { return machine.Get(); }
+        const Quat& LocalRotation() const { return rotation; }
+        const Quat& OriginalRotation() const { return originalRotation; }
+        float Speed() const { return currentSpeed; }
+        float TargetSpeed() const { return targetSpeed; }
+
+    private:
+        using StepFn = void (SpinModel::*)(float, const Vec3&);
+        using Machine = PhaseMachine<SpinTransitions, StepFn>;
+
+        // Indexed by SpinPhase
+        static const Machine::Handlers Steps;
+
+        void StepIdle(float deltaTime, const Vec3& angularVelocity) {}
+        void StepSpinning(float deltaTime, const Vec3& angularVelocity);
+        void StepStopping(float deltaTime, const Vec3& angularVelocity);
+        void StepCompleting(float deltaTime, const Vec3& angularVelocity);
+
+        void ApplyRotation(float deltaTime);
+        void ReturnToOriginal(float deltaTime);
+
+        SpinParams params;
+        Machine machine{Steps};
+        float input = 0.0f;
+
+        Quat rotation = IdentityQuat();
+        Quat originalRotation = IdentityQuat();
+        float currentSpeed = 0.0f;
+        float targetSpeed = 0.0f;
+        float largestSpeed = 0.0f;
+    };
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "TrickSaber/Native/FixedStep.hpp"
+#include "TrickSaber/Native/PhaseMachine.hpp"
+#include "TrickSaber/Native/ReturnSpring.hpp"
+#include "TrickSaber/Native/VecMath.hpp"
+#include "TrickSaber/Constants.hpp"
+
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    struct ThrowParams {
+        bool velocityDependent = false;
+        bool simplified = false;
+        float throwVelocity = 1.0f;
+        float throwVelocityMultiplier = 3.0f;
+        float velocityThreshold = 0.5f;
+        float returnDuration = Constants::DEFAULT_RETURN_DURATION;
+        float returnSpinMultiplier = 1.0f;
+        float snapBackDistance = Constants::DEFAULT_SNAP_BACK_DISTANCE;
+        float gravityScale = 1.0f;          // simplified flight only
+        float airResistance = 1.0f;         // fraction of velocity kept per second; 1 = no drag
+        float angularDamping = 1.0f;        // fraction of spin kept per second
+        float maxThrowDistance = 0.0f;      // caps snapBackDistance; 0 = no cap
+    };
+
+    enum class ThrowPhase : uint8_t {
+        Idle,
+        Thrown,
+        Returning,
+        Done
+    };
+
+    // Everything not listed is a compile error in Go<From, To>
+    inline constexpr TransitionTable<ThrowPhase, 4> ThrowTransitions{
+        {ThrowPhase::Idle, ThrowPhase::Thrown},
+        {ThrowPhase::Thrown, ThrowPhase::Returning},
+        {ThrowPhase::Returning, ThrowPhase::Done},
+    };
+
+    // Release velocity (m/s) and spin about the saber's right axis (deg/s)
+    struct ThrowLaunch {
+        Vec3 velocity;
+        float spinSpeed;
+    };
+
+    // Flight after release as a function of time: constant gravity, drag
+    // proportional to velocity (exponential decay at rate drag) and spin that
+    // decays at rate spinDamping. Nothing is integrated, so any time can be
+    // evaluated directly and skipped frames do not accumulate error.
+    struct BallisticFlight {
+        Vec3 origin = Zero3();
+        Quat orientation = IdentityQuat();
+        Vec3 velocity = Zero3();
+        Vec3 gravity = Zero3();
+        float drag = 0.0f;          // 1/s
+        float spin = 0.0f;          // deg/s about the saber's right axis
+        float spinDamping = 0.0f;   // 1/s
+        bool worldSpin = false;     // spin about world right rather than the saber's own
+
+        // Rates from the "fraction kept per second" config values
+        static float RateFromRetention(float retention);
+
+        Vec3 PositionAt(float t) const;
+        Vec3 VelocityAt(float t) const;
+        float SpinAngleAt(float t) const;   // degrees turned since release
+        Quat RotationAt(float t) const;
+
+        // First time the saber is distance from origin; +infinity if that does
+        // not happen within maxTime. Closed form without gravity; with gravity
+        // the distance has no inverse, so the closed-form path is bracketed
+        // and bisected (once, at launch).
+        float TimeToDistance(float distance, float maxTime) const;
+    };
+
+    ThrowLaunch ComputeThrowLaunch(const ThrowParams& params, const Vec3& controllerVelocity,
+        const Vec3& controllerAngularVelocity, const Vec3& saberForward);
+
+    // World-space flight and return of a thrown saber. ThrowTrick copies the
+    // pose to the transform after each Step and ends the trick on Done.
+    //
+    // The phase's step function is chosen when the phase is entered; each
+    // substep is one call through the machine. Step runs whole
+    // THROW_FIXED_STEP substeps, so the return and the snap-back substep do
+    // not depend on the refresh rate or on frame drops. The flight itself is
+    // BallisticFlight evaluated at the substep time, and the snap-back time
+    // is worked out at Launch. The return is a ReturnSpring towards the
+    // target pose of each substep, so it follows a moving hand and ends
+    // within tolerance of it. Position/Rotation are the simulated state;
+    // RenderPosition/RenderRotation are the pose one step behind the frame
+    // time: exact during flight, a blend of the last two substeps otherwise.
+    class ThrowModel {
+    public:
+        void Launch(const ThrowParams& params, const Vec3& position, const Quat& rotation, const ThrowLaunch& launch);
+        void BeginReturn();
+        void Reset() { machine.Reset(); }
+
+        // The target pose is where the return ends (the hand's saber slot) and
+        // is only read while returning.
+        ThrowPhase Step(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation);
+
+        Vec3 RenderPosition() const;
+        Quat RenderRotation() const;
+        // Substeps simulated since Launch
+        uint32_t Substeps() const { return clock.GetStepCount(); }
+
+        ThrowPhase Phase() const { return machine.Get(); }
+        const Vec3& Position() const { return position; }
+        const Quat& Rotation() const { return rotation; }
+        const Vec3& Velocity() const { return velocity; }
+        const ThrowLaunch& Launched() const { return launch; }
+        const BallisticFlight& Flight() const { return flight; }
+        float SnapTime() const { return snapTime; }
+
+    private:
+        using StepFn = void (ThrowModel::*)(float, const Vec3&, const Quat&);
+        using Machine = PhaseMachine<ThrowTransitions, StepFn>;
+
+        // Indexed by ThrowPhase
+        static const Machine::Handlers Steps;
+
+        void StepIdle(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation) {}
+        void StepThrown(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation);
+        void StepReturning(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation);
+
+        ThrowParams params;
+        ThrowLaunch launch{Zero3(), 0.0f};
+        Machine machine{Steps};
+
+        // Fixed for the whole throw, worked out at Launch / BeginReturn
+        BallisticFlight flight;
+        float snapTime = 0.0f;
+        uint32_t flightSteps = 0;
+        float FlightTime() const { return static_cast<float>(flightSteps) * clock.Step(); }
+        float returnDuration = Constants::DEFAULT_RETURN_DURATION;
+        float returnSpinSpeed = 0.0f;   // deg/s, 0 for none
+        bool returnStarted = false;     // spring is set up on the first returning substep
+
+        FixedStepAccumulator clock{Constants::THROW_FIXED_STEP, Constants::THROW_MAX_SUBSTEPS};
+
+        Vec3 position = Zero3();
+        Quat rotation = IdentityQuat();
+        Vec3 velocity = Zero3();
+        Vec3 previousPosition = Zero3();
+        Quat previousRotation = IdentityQuat();
+
+        ReturnSpring spring;
+    };
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+// On-disk layout of a TrickSaber session trace (.tstrace).
+//
+//   FileHeader, then a stream of [RecordHeader][payload] entries.
+//
+// Every header and payload is a multiple of 8 bytes, so records stay 8-byte
+// aligned inside an mmap'd file and can be read in place. Bump Version on any
+// layout change; readers reject versions they do not know.
+
+namespace TrickSaber::Native::Trace {
+    constexpr char Magic[4] = {'T', 'S', 'T', 'R'};
+    constexpr uint16_t Version = 1;
+
+    struct FileHeader {
+        char magic[4];
+        uint16_t version;
+        uint16_t headerSize;
+        double startTime;       // MonotonicSeconds() when recording began
+    };
+
+    enum class RecordType : uint16_t {
+        Pose = 1,
+        Input = 2,
+        TrickEvent = 3
+    };
+
+    struct RecordHeader {
+        RecordType type;
+        uint16_t size;          // payload bytes following this header
+        uint32_t reserved;
+    };
+
+    // Both hands as fed to MovementController::UpdateVelocities
+    struct PoseRecord {
+        double time;
+        float deltaTime;
+        uint32_t handMask;      // bit 0 left, bit 1 right
+        Vec3 position[2];
+        Quat rotation[2];
+    };
+
+    enum InputButton : uint32_t {
+        TriggerButton = 1u << 0,
+        GripButton = 1u << 1,
+        ButtonOne = 1u << 2,
+        ButtonTwo = 1u << 3,
+        ThumbstickClick = 1u << 4
+    };
+
+    // One controller as read by SaberTrickManager::CheckDirectInput
+    struct InputRecord {
+        double time;
+        uint8_t hand;           // 0 left, 1 right
+        uint8_t padding[3];
+        uint32_t buttons;       // InputButton bits
+        float trigger;
+        float grip;
+        float stickX;
+        float stickY;
+    };
+
+    enum class TrickPhase : uint8_t {
+        Started,
+        Ending,
+        Ended
+    };
+
+    struct TrickEventRecord {
+        double time;
+        uint8_t hand;
+        uint8_t action;         // TrickAction
+        TrickPhase phase;
+        uint8_t padding[5];
+    };
+
+    static_assert(sizeof(FileHeader) == 16);
+    static_assert(sizeof(RecordHeader) == 8);
+    static_assert(sizeof(PoseRecord) % 8 == 0);
+    static_assert(sizeof(InputRecord) % 8 == 0);
+    static_assert(sizeof(TrickEventRecord) % 8 == 0);
+    static_assert(std::is_trivially_copyable_v<PoseRecord>);
+    static_assert(std::is_trivially_copyable_v<InputRecord>);
+    static_assert(std::is_trivially_copyable_v<TrickEventRecord>);
+
+    template <typename T> constexpr RecordType RecordTypeOf();
+    template <> constexpr RecordType RecordTypeOf<PoseRecord>() { return RecordType::Pose; }
+    template <> constexpr RecordType RecordTypeOf<InputRecord>() { return RecordType::Input; }
+    template <> constexpr RecordType RecordTypeOf<TrickEventRecord>() { return RecordType::TrickEvent; }
+}
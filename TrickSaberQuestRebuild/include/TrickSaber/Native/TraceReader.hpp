@@ -0,0 +1,44 @@
+#pragma once
+
+#include "TrickSaber/Native/TraceFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TrickSaber::Native {
+    // Memory-maps a trace file and walks its records in place. A record cut
+    // short by a crash mid-write ends iteration instead of being returned.
+    class TraceReader {
+    public:
+        struct RecordView {
+            Trace::RecordType type;
+            uint16_t size;
+            const uint8_t* payload;
+
+            template <typename T>
+            const T* As() const {
+                if (type != Trace::RecordTypeOf<T>() || size < sizeof(T)) return nullptr;
+                return reinterpret_cast<const T*>(payload);
+            }
+        };
+
+        TraceReader() = default;
+        ~TraceReader();
+        TraceReader(const TraceReader&) = delete;
+        TraceReader& operator=(const TraceReader&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return data != nullptr; }
+
+        const Trace::FileHeader& Header() const { return *reinterpret_cast<const Trace::FileHeader*>(data); }
+        bool Next(RecordView& out);
+        void Rewind();
+
+    private:
+        const uint8_t* data = nullptr;
+        size_t length = 0;
+        size_t cursor = 0;
+    };
+}
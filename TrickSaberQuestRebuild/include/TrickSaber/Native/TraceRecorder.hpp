@@ -0,0 +1,60 @@
+#pragma once
+
+#include "TrickSaber/Native/TraceFormat.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace TrickSaber::Native {
+    // Appends trace records to a preallocated byte ring that a background
+    // thread streams to disk. The Record* calls are single-producer (Unity main
+    // thread), never allocate or lock, and drop the record if the ring is full.
+    class TraceRecorder {
+    public:
+        static constexpr size_t DEFAULT_RING_BYTES = 1u << 20;
+
+        TraceRecorder() = default;
+        ~TraceRecorder();
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        // Shared recorder used by the mod
+        static TraceRecorder& GetInstance();
+
+        bool Start(const std::string& path, size_t ringBytes = DEFAULT_RING_BYTES);
+        void Stop();
+        bool IsRecording() const { return recording.load(std::memory_order_relaxed); }
+
+        void RecordPose(double time, float deltaTime, uint32_t handMask, const Vec3 positions[2], const Quat rotations[2]);
+        void RecordInput(double time, uint8_t hand, uint32_t buttons, float trigger, float grip, float stickX, float stickY);
+        void RecordTrickEvent(double time, uint8_t hand, uint8_t action, Trace::TrickPhase phase);
+
+        uint64_t GetRecordCount() const { return recordCount.load(std::memory_order_relaxed); }
+        uint64_t GetDroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+        const std::string& GetPath() const { return path; }
+
+    private:
+        template <typename T>
+        void Append(const T& payload);
+        void WriterLoop();
+        size_t Drain();
+
+        std::unique_ptr<uint8_t[]> ring;
+        size_t ringMask = 0;
+        std::atomic<uint64_t> head{0};  // producer
+        std::atomic<uint64_t> tail{0};  // writer thread
+
+        std::atomic<bool> recording{false};
+        std::atomic<bool> stopRequested{false};
+        std::atomic<uint64_t> recordCount{0};
+        std::atomic<uint64_t> droppedCount{0};
+
+        std::thread writer;
+        FILE* file = nullptr;
+        std::string path;
+    };
+}
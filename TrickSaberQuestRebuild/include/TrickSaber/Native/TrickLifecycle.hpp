@@ -0,0 +1,40 @@
+#pragma once
+
+#include "TrickSaber/Enums.hpp"
+
+namespace TrickSaber::Native {
+    // The trick one saber is running, so Ended goes out once per Started.
+    // Either side may report the end: tricks that finish on their own call
+    // back into the manager, and EndAll reports it for the ones that do not.
+    // Only the first End of a running trick returns true.
+    class TrickLifecycle {
+    public:
+        void Start(TrickAction action) { current = action; }
+
+        // True if action was running; the caller publishes Ended then
+        bool End(TrickAction action) {
+            if (action == TrickAction::None || action != current) return false;
+            current = TrickAction::None;
+            return true;
+        }
+
+        // Ends every active trick in tricks immediately: ending(action)
+        // before, ended(action) after, unless the trick reported it itself
+        template<typename Registry, typename Ending, typename Ended>
+        void EndAll(Registry& tricks, Ending&& ending, Ended&& ended) {
+            tricks.ForEach([&](TrickAction action, auto trick) {
+                if (!trick->IsActive()) return;
+                ending(action);
+                trick->EndTrickImmediately();
+                if (End(action)) ended(action);
+            });
+            current = TrickAction::None;
+        }
+
+        TrickAction Current() const { return current; }
+        bool IsRunning() const { return current != TrickAction::None; }
+
+    private:
+        TrickAction current = TrickAction::None;
+    };
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "TrickSaber/Enums.hpp"
+#include "TrickSaber/Native/TrickSlots.hpp"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace TrickSaber::Native {
+    // How a trick consumes the input it is bound to
+    namespace TrickInput {
+        constexpr uint8_t Hold = 1 << 0;    // releasing the input ends the trick
+        constexpr uint8_t Analog = 1 << 1;  // reads the input value every frame while running
+        constexpr uint8_t PreArm = 1 << 2;  // a partial trigger pull warms it before the press
+        constexpr uint8_t Flick = 1 << 3;   // a controller flick starts it like a press
+    }
+
+    // Declared once per trick type; usable as a template argument
+    struct TrickDescriptor {
+        TrickAction action = TrickAction::None;
+        uint8_t input = 0;
+
+        constexpr bool Has(uint8_t flag) const { return (input & flag) != 0; }
+    };
+
+    // A trick type and its descriptor. Also a TrickSlot, so the registry is a
+    // TrickSlots over its entries.
+    template<TrickDescriptor D, typename T>
+    struct TrickEntry : TrickSlot<D.action, T> {
+        static constexpr TrickDescriptor Descriptor = D;
+        static_assert(D.action != TrickAction::None, "None cannot be registered");
+    };
+
+    // Every registered trick type, one instance of each per saber. The
+    // instances are built once by Build, at scene init, and reused for the
+    // whole map: adding a type adds one slot, not per-frame work.
+    //
+    // The state machine is the trick type's own StartTrick / EndTrick /
+    // EndTrickImmediately / Tick / IsActive / IsTrickInState, called on the
+    // concrete type. SetInput and Arm/Disarm are optional; types without
+    // them ignore those calls.
+    template<typename Base, typename... Entries>
+    class TrickRegistry : public TrickSlots<Base, Entries...> {
+        static constexpr std::array<TrickDescriptor, TrickActionCount> MakeTable() {
+            std::array<TrickDescriptor, TrickActionCount> table{};
+            ((table[TrickIndex(Entries::Action)] = Entries::Descriptor), ...);
+            return table;
+        }
+
+    public:
+        static constexpr std::array<TrickDescriptor, TrickActionCount> Descriptors = MakeTable();
+
+        static constexpr bool IsRegistered(TrickAction action) {
+            auto index = TrickIndex(action);
+            return index < TrickActionCount && Descriptors[index].action != TrickAction::None;
+        }
+
+        // Empty descriptor (no input flags) for unregistered actions
+        static constexpr TrickDescriptor Describe(TrickAction action) {
+            return IsRegistered(action) ? Descriptors[TrickIndex(action)] : TrickDescriptor{};
+        }
+
+        static constexpr int Size() { return static_cast<int>(sizeof...(Entries)); }
+
+        // Fills every slot with make(std::type_identity<T>{}), which returns
+        // a T* or nullptr. Returns the number of slots filled.
+        template<typename Factory>
+        int Build(Factory&& make) {
+            (BuildEntry<Entries>(make), ...);
+            return this->Count();
+        }
+
+        bool Start(TrickAction action, float value) {
+            bool started = false;
+            this->Visit(action, [&](auto trick) { started = trick->StartTrick(value); });
+            return started;
+        }
+
+        void End(TrickAction action) {
+            this->Visit(action, [](auto trick) { trick->EndTrick(); });
+        }
+
+        void EndImmediately(TrickAction action) {
+            this->Visit(action, [](auto trick) { trick->EndTrickImmediately(); });
+        }
+
+        // Steps the trick if it is running
+        void Tick(TrickAction action) {
+            this->Visit(action, [](auto trick) {
+                if (trick->IsActive()) trick->Tick();
+            });
+        }
+
+        bool IsActive(TrickAction action) const {
+            bool active = false;
+            this->Visit(action, [&](auto trick) { active = trick->IsActive(); });
+            return active;
+        }
+
+        bool IsInState(TrickAction action, TrickState state) const {
+            bool inState = false;
+            this->Visit(action, [&](auto trick) { inState = trick->IsTrickInState(static_cast<int>(state)); });
+            return inState;
+        }
+
+        // Analog tricks only
+        void SetInput(TrickAction action, float value) {
+            if (!Describe(action).Has(TrickInput::Analog)) return;
+            this->Visit(action, [&](auto trick) {
+                if constexpr (requires { trick->SetInput(value); }) trick->SetInput(value);
+            });
+        }
+
+        // PreArm tricks only
+        void Arm(TrickAction action, bool arm) {
+            if (!Describe(action).Has(TrickInput::PreArm)) return;
+            this->Visit(action, [&](auto trick) {
+                if constexpr (requires { trick->Arm(); trick->Disarm(); }) {
+                    if (arm) trick->Arm(); else trick->Disarm();
+                }
+            });
+        }
+
+        bool IsArmed(TrickAction action) const {
+            bool armed = false;
+            this->Visit(action, [&](auto trick) {
+                if constexpr (requires { trick->IsArmed(); }) armed = trick->IsArmed();
+            });
+            return armed;
+        }
+
+    private:
+        template<typename Entry, typename Factory>
+        void BuildEntry(Factory& make) {
+            using T = typename Entry::Type;
+            T* trick = make(std::type_identity<T>{});
+            if (trick) this->template Set<Entry::Action>(trick);
+        }
+    };
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "TrickSaber/Enums.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace TrickSaber::Native {
+    constexpr std::size_t TrickActionCount = static_cast<std::size_t>(TrickAction::FreezeThrow) + 1;
+
+    constexpr std::size_t TrickIndex(TrickAction action) {
+        return static_cast<std::size_t>(action);
+    }
+
+    // Binds the trick type that handles an action
+    template<TrickAction A, typename T>
+    struct TrickSlot {
+        static constexpr TrickAction Action = A;
+        using Type = T;
+    };
+
+    namespace Detail {
+        template<TrickAction A, typename Slot, typename... Rest>
+        constexpr auto FindTrickSlot() {
+            if constexpr (Slot::Action == A) {
+                return std::type_identity<Slot>{};
+            } else {
+                static_assert(sizeof...(Rest) > 0, "No trick type is bound to this action");
+                return FindTrickSlot<A, Rest...>();
+            }
+        }
+    }
+
+    // One pointer per TrickAction in a flat array, plus the compile-time list
+    // of concrete types behind the slots. Visit and ForEach hand the callback
+    // the concrete pointer, so the derived trick's methods run without a map
+    // lookup, a dynamic_cast or a virtual call.
+    template<typename Base, typename... Slots>
+    class TrickSlots {
+    public:
+        template<TrickAction A>
+        using TypeOf = typename decltype(Detail::FindTrickSlot<A, Slots...>())::type::Type;
+
+        template<TrickAction A>
+        void Set(TypeOf<A>* trick) {
+            static_assert(std::is_base_of_v<Base, TypeOf<A>>, "Trick types must derive from Base");
+            slots[TrickIndex(A)] = trick;
+        }
+
+        template<TrickAction A>
+        TypeOf<A>* Get() const {
+            return static_cast<TypeOf<A>*>(slots[TrickIndex(A)]);
+        }
+
+        Base* Get(TrickAction action) const {
+            auto index = TrickIndex(action);
+            return index < slots.size() ? slots[index] : nullptr;
+        }
+
+        // Calls fn(T*) for the trick bound to action; false if there is none.
+        // fn is instantiated for every type in the list.
+        template<typename Fn>
+        bool Visit(TrickAction action, Fn&& fn) const {
+            return (VisitSlot<Slots>(action, fn) || ...);
+        }
+
+        // Calls fn(action, T*) for every filled slot, in list order
+        template<typename Fn>
+        void ForEach(Fn&& fn) const {
+            (ForEachSlot<Slots>(fn), ...);
+        }
+
+        int Count() const {
+            return ((slots[TrickIndex(Slots::Action)] ? 1 : 0) + ... + 0);
+        }
+
+        void Clear() { slots = {}; }
+
+    private:
+        std::array<Base*, TrickActionCount> slots{};
+
+        template<typename Slot, typename Fn>
+        bool VisitSlot(TrickAction action, Fn& fn) const {
+            if (action != Slot::Action) return false;
+            auto* trick = Get<Slot::Action>();
+            if (!trick) return false;
+            fn(trick);
+            return true;
+        }
+
+        template<typename Slot, typename Fn>
+        void ForEachSlot(Fn& fn) const {
+            if (auto* trick = Get<Slot::Action>()) {
+                fn(Slot::Action, trick);
+            }
+        }
+    };
+}
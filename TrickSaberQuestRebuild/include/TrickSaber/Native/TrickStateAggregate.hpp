@@ -0,0 +1,74 @@
+#pragma once
+
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/TrickSlots.hpp"
+
+#include <bit>
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    // Running tricks on both hands as one bitmask, bit hand * TrickActionCount
+    // + action. Written only when a trick starts or ends, so every query is a
+    // load and a mask. Ended is idempotent, so a stray duplicate does not
+    // skew the counts.
+    class TrickStateAggregate {
+    public:
+        using Mask = uint8_t;
+        static_assert(TrickActionCount * 2 <= sizeof(Mask) * 8, "Mask too narrow for both hands");
+
+        static constexpr Mask Bit(int hand, TrickAction action) {
+            return static_cast<Mask>(1u << (hand * TrickActionCount + TrickIndex(action)));
+        }
+
+        static constexpr Mask HandBits(int hand) {
+            return static_cast<Mask>(((1u << TrickActionCount) - 1) << (hand * TrickActionCount));
+        }
+
+        static constexpr Mask ActionBits(TrickAction action) {
+            return static_cast<Mask>(Bit(LeftHand, action) | Bit(RightHand, action));
+        }
+
+        void Started(int hand, TrickAction action) {
+            if (action == TrickAction::None) return;
+            mask |= Bit(hand, action);
+            startCount++;
+        }
+
+        void Ended(int hand, TrickAction action) {
+            Mask bit = Bit(hand, action);
+            if (!(mask & bit)) return;
+            mask &= static_cast<Mask>(~bit);
+            endCount++;
+        }
+
+        bool Any() const { return mask != 0; }
+        bool IsActive(TrickAction action) const { return (mask & ActionBits(action)) != 0; }
+        bool IsHandActive(int hand) const { return (mask & HandBits(hand)) != 0; }
+        int Count(TrickAction action) const {
+            // Two hands, so two bit tests beat a generic popcount
+            return ((mask & Bit(LeftHand, action)) ? 1 : 0) + ((mask & Bit(RightHand, action)) ? 1 : 0);
+        }
+        Mask Bits() const { return mask; }
+
+        // Calls fn(hand, action) for each running trick. Walks a copy of the
+        // mask, so tricks may end from inside fn.
+        template<typename Fn>
+        void ForEachActive(Fn&& fn) const {
+            for (Mask bits = mask; bits != 0; bits &= static_cast<Mask>(bits - 1)) {
+                int index = std::countr_zero(bits);
+                fn(static_cast<int>(index / TrickActionCount), static_cast<TrickAction>(index % TrickActionCount));
+            }
+        }
+
+        // Drops all running tricks; the counters are kept
+        void Clear() { mask = 0; }
+
+        uint64_t GetStartCount() const { return startCount; }
+        uint64_t GetEndCount() const { return endCount; }
+
+    private:
+        Mask mask = 0;
+        uint64_t startCount = 0;
+        uint64_t endCount = 0;
+    };
+}
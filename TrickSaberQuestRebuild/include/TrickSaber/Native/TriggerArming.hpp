@@ -0,0 +1,55 @@
+#pragma once
+
+#include "TrickSaber/Constants.hpp"
+
+#include <cstdint>
+
+namespace TrickSaber::Native {
+    // Two-threshold latch on an analog value: turns on at pressThreshold and
+    // stays on until the value drops below releaseThreshold
+    struct HysteresisBand {
+        float pressThreshold = 0.8f;
+        float releaseThreshold = 0.6f;
+
+        bool Next(bool pressed, float value) const {
+            return value >= (pressed ? releaseThreshold : pressThreshold);
+        }
+    };
+
+    enum class ArmEdge : uint8_t {
+        None,
+        Armed,
+        Disarmed
+    };
+
+    // Arm stage in front of a press. The value arms the press once it crosses
+    // the arm band and disarms when it falls back out. The press itself
+    // (fireDown) consumes the arming and reports nothing, so Disarmed means
+    // "warmed up but never fired".
+    class TriggerArming {
+    public:
+        void Configure(float armThreshold, float hysteresis = Constants::THROW_ARM_HYSTERESIS) {
+            band = {armThreshold, armThreshold - hysteresis};
+        }
+
+        ArmEdge Update(float value, bool fireDown) {
+            if (fireDown) {
+                armed = false;
+                return ArmEdge::None;
+            }
+
+            bool next = band.Next(armed, value);
+            if (next == armed) return ArmEdge::None;
+            armed = next;
+            return armed ? ArmEdge::Armed : ArmEdge::Disarmed;
+        }
+
+        bool IsArmed() const { return armed; }
+        void Reset() { armed = false; }
+
+    private:
+        HysteresisBand band{Constants::DEFAULT_THROW_ARM_THRESHOLD,
+            Constants::DEFAULT_THROW_ARM_THRESHOLD - Constants::THROW_ARM_HYSTERESIS};
+        bool armed = false;
+    };
+}
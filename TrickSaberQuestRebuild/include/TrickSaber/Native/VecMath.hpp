@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// Plain-data vector math shared by the IL2CPP-free hot paths.
+// Layout matches UnityEngine::Vector3/Quaternion so adapters are plain copies.
+
+namespace TrickSaber::Native {
+    struct Vec3 {
+        float x, y, z;
+    };
+
+    struct Quat {
+        float x, y, z, w;
+    };
+
+    constexpr Vec3 Zero3() { return {0.0f, 0.0f, 0.0f}; }
+    constexpr Quat IdentityQuat() { return {0.0f, 0.0f, 0.0f, 1.0f}; }
+
+    constexpr Vec3 operator+(const Vec3& a, const Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+    constexpr Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+    constexpr Vec3 operator-(const Vec3& a) { return {-a.x, -a.y, -a.z}; }
+    constexpr Vec3 operator*(const Vec3& a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+    constexpr Vec3 operator*(float s, const Vec3& a) { return {a.x * s, a.y * s, a.z * s}; }
+    constexpr Vec3 operator/(const Vec3& a, float s) { return {a.x / s, a.y / s, a.z / s}; }
+
+    constexpr Vec3& operator+=(Vec3& a, const Vec3& b) { a.x += b.x; a.y += b.y; a.z += b.z; return a; }
+    constexpr Vec3& operator-=(Vec3& a, const Vec3& b) { a.x -= b.x; a.y -= b.y; a.z -= b.z; return a; }
+    constexpr Vec3& operator*=(Vec3& a, float s) { a.x *= s; a.y *= s; a.z *= s; return a; }
+
+    constexpr float Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    constexpr Vec3 Cross(const Vec3& a, const Vec3& b) {
+        return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+    constexpr float SqrMagnitude(const Vec3& a) { return Dot(a, a); }
+    inline float Magnitude(const Vec3& a) { return std::sqrt(Dot(a, a)); }
+
+    constexpr Vec3 Lerp(const Vec3& a, const Vec3& b, float t) { return a + (b - a) * t; }
+    inline float Distance(const Vec3& a, const Vec3& b) { return Magnitude(a - b); }
+
+    // Unit vector, or zero for a degenerate input (Unity's Vector3.normalized)
+    inline Vec3 Normalized(const Vec3& a) {
+        float len = Magnitude(a);
+        return len > 1e-5f ? a / len : Zero3();
+    }
+
+    // Mathf.MoveTowards
+    inline float MoveTowards(float current, float target, float maxDelta) {
+        if (std::fabs(target - current) <= maxDelta) return target;
+        return current + std::copysign(maxDelta, target - current);
+    }
+
+    // Hamilton product, same convention as Unity's Quaternion * Quaternion
+    constexpr Quat operator*(const Quat& a, const Quat& b) {
+        return {
+            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+            a.w * b.y + a.y * b.w + a.z * b.x - a.x * b.z,
+            a.w * b.z + a.z * b.w + a.x * b.y - a.y * b.x,
+            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+        };
+    }
+
+    // Inverse of a unit quaternion
+    constexpr Quat Conjugate(const Quat& q) { return {-q.x, -q.y, -q.z, q.w}; }
+
+    constexpr float Dot(const Quat& a, const Quat& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+    inline Quat Normalize(const Quat& q) {
+        float len = std::sqrt(Dot(q, q));
+        if (len < 1e-8f) return IdentityQuat();
+        float inv = 1.0f / len;
+        return {q.x * inv, q.y * inv, q.z * inv, q.w * inv};
+    }
+
+    // Rotation vector (axis * angle in radians) of a unit quaternion, shortest arc
+    inline Vec3 LogMap(const Quat& q) {
+        float sign = q.w < 0.0f ? -1.0f : 1.0f;
+        Vec3 v{q.x * sign, q.y * sign, q.z * sign};
+        float len = Magnitude(v);
+        if (len < 1e-7f) return v * 2.0f;
+        return v * (2.0f * std::atan2(len, q.w * sign) / len);
+    }
+
+    // Unit quaternion of a rotation vector (axis * angle in radians); inverse of LogMap
+    inline Quat ExpMap(const Vec3& v) {
+        float angle = Magnitude(v);
+        if (angle < 1e-7f) return Normalize({v.x * 0.5f, v.y * 0.5f, v.z * 0.5f, 1.0f});
+        float s = std::sin(angle * 0.5f) / angle;
+        return {v.x * s, v.y * s, v.z * s, std::cos(angle * 0.5f)};
+    }
+
+    // Rotate a vector by a unit quaternion
+    constexpr Vec3 Rotate(const Quat& q, const Vec3& v) {
+        Vec3 u{q.x, q.y, q.z};
+        Vec3 t = Cross(u, v) * 2.0f;
+        return v + t * q.w + Cross(u, t);
+    }
+
+    // Rotation of angle radians about a unit axis
+    inline Quat AxisAngle(const Vec3& axis, float radians) {
+        float s = std::sin(radians * 0.5f);
+        return {axis.x * s, axis.y * s, axis.z * s, std::cos(radians * 0.5f)};
+    }
+
+    // Angle between two rotations in degrees (Quaternion.Angle)
+    inline float AngleDegrees(const Quat& a, const Quat& b) {
+        float d = std::min(std::fabs(Dot(a, b)), 1.0f);
+        return d > 0.999999f ? 0.0f : std::acos(d) * 2.0f * 57.29578f;
+    }
+
+    // Normalized lerp along the shortest arc, t clamped (Quaternion.Lerp)
+    inline Quat Nlerp(const Quat& a, const Quat& b, float t) {
+        t = std::clamp(t, 0.0f, 1.0f);
+        float sign = Dot(a, b) < 0.0f ? -1.0f : 1.0f;
+        float u = 1.0f - t, v = t * sign;
+        return Normalize({a.x * u + b.x * v, a.y * u + b.y * v, a.z * u + b.z * v, a.w * u + b.w * v});
+    }
+
+    // Spherical lerp along the shortest arc, t clamped (Quaternion.Slerp)
+    inline Quat Slerp(const Quat& a, const Quat& b, float t) {
+        t = std::clamp(t, 0.0f, 1.0f);
+        float d = Dot(a, b);
+        Quat target = b;
+        if (d < 0.0f) {
+            d = -d;
+            target = {-b.x, -b.y, -b.z, -b.w};
+        }
+        if (d > 0.9995f) return Nlerp(a, target, t);
+        float theta = std::acos(d);
+        float invSin = 1.0f / std::sin(theta);
+        float u = std::sin((1.0f - t) * theta) * invSin, v = std::sin(t * theta) * invSin;
+        return {a.x * u + target.x * v, a.y * u + target.y * v, a.z * u + target.z * v, a.w * u + target.w * v};
+    }
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "TrickSaber/Constants.hpp"
+#include "TrickSaber/Enums.hpp"
+#include "TrickSaber/Native/VecMath.hpp"
+#include "TrickSaber/Native/VelocityRingBuffer.hpp"
+
+namespace TrickSaber::Native {
+    struct VelocityFilterParams {
+        int boxcarWindow = Constants::DEFAULT_VELOCITY_BUFFER_SIZE;
+        float oneEuroMinCutoff = Constants::DEFAULT_ONE_EURO_MIN_CUTOFF;
+        float oneEuroBeta = Constants::DEFAULT_ONE_EURO_BETA;
+        float oneEuroDerivativeCutoff = Constants::DEFAULT_ONE_EURO_DERIVATIVE_CUTOFF;
+        float kalmanProcessNoise = Constants::DEFAULT_KALMAN_PROCESS_NOISE;
+        float kalmanMeasurementNoise = Constants::DEFAULT_KALMAN_MEASUREMENT_NOISE;
+    };
+
+    // Smooths the raw per-tick linear and angular velocity of one hand.
+    // Implementations hold fixed-size state only; Push never allocates.
+    class VelocityEstimator {
+    public:
+        virtual ~VelocityEstimator() = default;
+        virtual void Configure(const VelocityFilterParams& params) = 0;
+        virtual void Reset() = 0;
+        virtual void Push(const Vec3& linear, const Vec3& angular, float deltaTime) = 0;
+        virtual Vec3 Linear() const = 0;
+        virtual Vec3 Angular() const = 0;
+    };
+
+    // Moving average over the last N probes (PC parity)
+    class BoxcarVelocityEstimator : public VelocityEstimator {
+    public:
+        void Configure(const VelocityFilterParams& params) override { ring.Resize(params.boxcarWindow); }
+        void Reset() override { ring.Clear(); }
+        void Push(const Vec3& linear, const Vec3& angular, float) override { ring.Push(linear, angular); }
+        Vec3 Linear() const override { return ring.AverageLinear(); }
+        Vec3 Angular() const override { return ring.AverageAngular(); }
+
+    private:
+        VelocityRingBuffer ring;
+    };
+
+    // One-Euro filter (Casiez et al.): the cutoff rises with the signal's rate
+    // of change, so it is smooth at rest and responsive during a flick.
+    class OneEuroFilter3 {
+    public:
+        void Configure(float minCutoff, float beta, float derivativeCutoff) {
+            this->minCutoff = minCutoff;
+            this->beta = beta;
+            this->derivativeCutoff = derivativeCutoff;
+        }
+
+        void Reset() { primed = false; value = Zero3(); derivative = Zero3(); }
+
+        Vec3 Update(const Vec3& x, float dt) {
+            if (!primed) {
+                primed = true;
+                value = x;
+                derivative = Zero3();
+                return value;
+            }
+            Vec3 dx = (x - value) / dt;
+            derivative = Lerp(derivative, dx, Alpha(derivativeCutoff, dt));
+            float cutoff = minCutoff + beta * Magnitude(derivative);
+            value = Lerp(value, x, Alpha(cutoff, dt));
+            return value;
+        }
+
+        Vec3 Value() const { return value; }
+
+    private:
+        static float Alpha(float cutoff, float dt) {
+            float tau = 1.0f / (2.0f * Constants::PI * cutoff);
+            return 1.0f / (1.0f + tau / dt);
+        }
+
+        float minCutoff = Constants::DEFAULT_ONE_EURO_MIN_CUTOFF;
+        float beta = Constants::DEFAULT_ONE_EURO_BETA;
+        float derivativeCutoff = Constants::DEFAULT_ONE_EURO_DERIVATIVE_CUTOFF;
+        Vec3 value{};
+        Vec3 derivative{};
+        bool primed = false;
+    };
+
+    // Constant-acceleration Kalman filter on a velocity measurement, one
+    // independent [v, a] state per axis. Process noise is white jerk.
+    class KalmanFilter3 {
+    public:
+        void Configure(float processNoise, float measurementNoise) {
+            q = processNoise;
+            r = measurementNoise;
+        }
+
+        void Reset() {
+            for (auto& axis : axes) axis = Axis{};
+            primed = false;
+        }
+
+        Vec3 Update(const Vec3& z, float dt) {
+            float in[3] = {z.x, z.y, z.z};
+            if (!primed) {
+                primed = true;
+                // Velocity known to measurement accuracy, acceleration unknown
+                for (int i = 0; i < 3; ++i) axes[i] = Axis{in[i], 0.0f, r, 0.0f, 100.0f};
+                return z;
+            }
+
+            float dt2 = dt * dt;
+            float q11 = q * dt2 * dt / 3.0f;
+            float q12 = q * dt2 / 2.0f;
+            float q22 = q * dt;
+
+            for (int i = 0; i < 3; ++i) {
+                Axis& s = axes[i];
+
+                // Predict
+                s.v += s.a * dt;
+                float p11 = s.p11 + dt * (2.0f * s.p12 + dt * s.p22) + q11;
+                float p12 = s.p12 + dt * s.p22 + q12;
+                float p22 = s.p22 + q22;
+
+                // Correct with the velocity measurement
+                float innovation = in[i] - s.v;
+                float inv = 1.0f / (p11 + r);
+                float k1 = p11 * inv;
+                float k2 = p12 * inv;
+                s.v += k1 * innovation;
+                s.a += k2 * innovation;
+                s.p11 = (1.0f - k1) * p11;
+                s.p12 = (1.0f - k1) * p12;
+                s.p22 = p22 - k2 * p12;
+            }
+            return Value();
+        }
+
+        Vec3 Value() const { return {axes[0].v, axes[1].v, axes[2].v}; }
+
+    private:
+        struct Axis {
+            float v = 0.0f, a = 0.0f;
+            float p11 = 1.0f, p12 = 0.0f, p22 = 1.0f;
+        };
+
+        Axis axes[3];
+        float q = Constants::DEFAULT_KALMAN_PROCESS_NOISE;
+        float r = Constants::DEFAULT_KALMAN_MEASUREMENT_NOISE;
+        bool primed = false;
+    };
+
+    class OneEuroVelocityEstimator : public VelocityEstimator {
+    public:
+        void Configure(const VelocityFilterParams& p) override {
+            linear.Configure(p.oneEuroMinCutoff, p.oneEuroBeta, p.oneEuroDerivativeCutoff);
+            angular.Configure(p.oneEuroMinCutoff, p.oneEuroBeta, p.oneEuroDerivativeCutoff);
+        }
+        void Reset() override { linear.Reset(); angular.Reset(); }
+        void Push(const Vec3& v, const Vec3& w, float dt) override { linear.Update(v, dt); angular.Update(w, dt); }
+        Vec3 Linear() const override { return linear.Value(); }
+        Vec3 Angular() const override { return angular.Value(); }
+
+    private:
+        OneEuroFilter3 linear, angular;
+    };
+
+    class KalmanVelocityEstimator : public VelocityEstimator {
+    public:
+        void Configure(const VelocityFilterParams& p) override {
+            linear.Configure(p.kalmanProcessNoise, p.kalmanMeasurementNoise);
+            angular.Configure(p.kalmanProcessNoise, p.kalmanMeasurementNoise);
+        }
+        void Reset() override { linear.Reset(); angular.Reset(); }
+        void Push(const Vec3& v, const Vec3& w, float dt) override { linear.Update(v, dt); angular.Update(w, dt); }
+        Vec3 Linear() const override { return linear.Value(); }
+        Vec3 Angular() const override { return angular.Value(); }
+
+    private:
+        KalmanFilter3 linear, angular;
+    };
+
+    // All estimators for one hand, preallocated; switching mode is a pointer swap
+    class VelocityEstimatorSet {
+    public:
+        VelocityEstimatorSet() = default;
+        VelocityEstimatorSet(const VelocityEstimatorSet&) = delete;
+        VelocityEstimatorSet& operator=(const VelocityEstimatorSet&) = delete;
+
+        void Configure(VelocityFilterMode mode, const VelocityFilterParams& params) {
+            boxcar.Configure(params);
+            oneEuro.Configure(params);
+            kalman.Configure(params);
+            switch (mode) {
+                case VelocityFilterMode::OneEuro: active = &oneEuro; break;
+                case VelocityFilterMode::Kalman:  active = &kalman; break;
+                default:                          active = &boxcar; break;
+            }
+            active->Reset();
+        }
+
+        VelocityEstimator& Active() { return *active; }
+        const VelocityEstimator& Active() const { return *active; }
+
+    private:
+        BoxcarVelocityEstimator boxcar;
+        OneEuroVelocityEstimator oneEuro;
+        KalmanVelocityEstimator kalman;
+        VelocityEstimator* active = &boxcar;
+    };
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "TrickSaber/Constants.hpp"
+#include "TrickSaber/Native/VecMath.hpp"
+
+#include <algorithm>
+
+namespace TrickSaber::Native {
+    // Fixed-capacity ring of linear + angular velocity probes for one hand.
+    // Samples are stored structure-of-arrays and the window sums are kept
+    // running, so Push and the averages cost the same for any window size.
+    class VelocityRingBuffer {
+    public:
+        static constexpr int Capacity = Constants::MAX_VELOCITY_BUFFER_SIZE;
+
+        VelocityRingBuffer() { Resize(Constants::DEFAULT_VELOCITY_BUFFER_SIZE); }
+
+        // Changes the averaging window; clamps to [1, Capacity] and clears
+        void Resize(int windowSize) {
+            size = std::clamp(windowSize, 1, Capacity);
+            invSize = 1.0f / static_cast<float>(size);
+            Clear();
+        }
+
+        // Zero-fills the window (matches the old pre-filled std::vector buffers)
+        void Clear() {
+            for (auto& lane : lanes) std::fill(lane, lane + Capacity, 0.0f);
+            std::fill(sums, sums + LaneWidth, 0.0f);
+            head = 0;
+        }
+
+        void Push(const Vec3& linear, const Vec3& angular) {
+            alignas(16) float in[LaneWidth] = {linear.x, linear.y, linear.z, angular.x, angular.y, angular.z, 0.0f, 0.0f};
+            alignas(16) float out[LaneWidth] = {};
+
+            for (int l = 0; l < LaneCount; ++l) {
+                out[l] = lanes[l][head];
+                lanes[l][head] = in[l];
+            }
+
+            // Two 4-wide lanes on NEON/SSE
+            for (int l = 0; l < LaneWidth; ++l) {
+                sums[l] += in[l] - out[l];
+            }
+
+            if (++head >= size) {
+                head = 0;
+                // Re-sum once per lap so float drift cannot build up
+                Resum();
+            }
+        }
+
+        Vec3 AverageLinear() const { return {sums[LX] * invSize, sums[LY] * invSize, sums[LZ] * invSize}; }
+        Vec3 AverageAngular() const { return {sums[AX] * invSize, sums[AY] * invSize, sums[AZ] * invSize}; }
+
+        int Size() const { return size; }
+
+    private:
+        enum Lane { LX, LY, LZ, AX, AY, AZ, LaneCount };
+        static constexpr int LaneWidth = 8;
+
+        void Resum() {
+            for (int l = 0; l < LaneCount; ++l) {
+                float s = 0.0f;
+                for (int i = 0; i < size; ++i) s += lanes[l][i];
+                sums[l] = s;
+            }
+        }
+
+        alignas(16) float lanes[LaneCount][Capacity] = {};
+        alignas(16) float sums[LaneWidth] = {};
+        int size = 1;
+        int head = 0;
+        float invSize = 1.0f;
+    };
+}
@@ -4,6 +4,7 @@
 #include "UnityEngine/Quaternion.hpp"
 #include "UnityEngine/Transform.hpp"
 #include "TrickSaber/SafePtrUnity.hpp"
+#include "TrickSaber/Native/ReturnSpring.hpp"
 
 namespace TrickSaber {
     enum class SaberInteractionState {
@@ -22,6 +23,8 @@ namespace TrickSaber {
         float returnTime = 0.0f;
         UnityEngine::Vector3 throwReleasePosition = UnityEngine::Vector3::get_zero();
         UnityEngine::Quaternion throwReleaseRotation = UnityEngine::Quaternion::get_identity();
+        Native::ReturnSpring returnSpring;                  // set up on the first returning frame
+        Native::Vec3 returnSlotOffset = Native::Zero3();    // originalLocalPosition in the hand's frame, scaled
         
         // Original pose
         UnityEngine::Vector3 originalLocalPosition = UnityEngine::Vector3::get_zero();
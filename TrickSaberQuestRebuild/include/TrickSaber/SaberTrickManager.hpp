@@ -6,17 +6,20 @@
 #include "GlobalNamespace/VRController.hpp"
 #include "GlobalNamespace/AudioTimeSyncController.hpp"
 #include "TrickSaber/Enums.hpp"
+#include "TrickSaber/Native/DirectInputState.hpp"
+#include "TrickSaber/Native/InputEventQueue.hpp"
+#include "TrickSaber/Native/TriggerArming.hpp"
+#include "TrickSaber/Native/TrickRegistry.hpp"
+#include "TrickSaber/Native/TrickLifecycle.hpp"
 
-#include <unordered_map>
-#include <functional>
 #include <chrono>
 
-namespace TrickSaber::Tricks { class Trick; }
+namespace TrickSaber::Tricks { class Trick; class SpinTrick; class ThrowTrick; class FreezeThrowTrick; }
 namespace TrickSaber { class InputManager; class MovementController; class SaberTrickModel; class TrailHandler; }
 
 DECLARE_CLASS_CODEGEN(TrickSaber, SaberTrickManager, UnityEngine::MonoBehaviour,
+    DECLARE_CTOR(ctor);
     DECLARE_INSTANCE_METHOD(void, Awake);
-    DECLARE_INSTANCE_METHOD(void, Update);
     DECLARE_INSTANCE_METHOD(void, OnDestroy);
     
     DECLARE_INSTANCE_METHOD(void, Initialize, GlobalNamespace::Saber* saber);
@@ -36,25 +39,41 @@ public:
     
     bool enabled = true;
     
-    // Event callbacks
-    std::function<void(TrickAction)> onTrickStarted;
-    std::function<void(TrickAction)> onTrickEnding;
-    std::function<void(TrickAction)> onTrickEnded;
+    // Snapshot timestamp of the last consumed throw press (throw release sampling)
+    double lastInputEdgeTime = 0.0;
     
-    // Public method for tricks to call when they end
+    // Per-frame work, called by TrickDriver instead of a Unity Update:
+    // Tick samples and applies input, TickTrick steps one running trick
+    void Tick();
+    void TickTrick(TrickAction action);
+    
+    // Public method for tricks to call when they end; publishes Ended only
+    // for the running trick, once
     void OnTrickEnded(TrickAction action);
-    void UpdateActiveTricks();
     
     // Public input callbacks
     void OnTrickActivated(TrickAction action, float value);
     void OnTrickDeactivated(TrickAction action);
     
+    // Queues an input edge; drained at the start of the next Tick, which TrickDriver calls each frame
+    bool EnqueueInput(Native::InputEdge edge, TrickAction action, float value, double time);
+    
 private:
-    std::unordered_map<TrickAction, Tricks::Trick*> tricks;
-    TrickAction currentTrick = TrickAction::None;
+    // Every trick type and the input it takes. A new trick is one entry
+    // here; InitializeTricks builds one instance of each per saber.
+    using TrickTable = Native::TrickRegistry<Tricks::Trick,
+        Native::TrickEntry<Native::TrickDescriptor{TrickAction::Spin,
+            Native::TrickInput::Hold | Native::TrickInput::Analog}, Tricks::SpinTrick>,
+        Native::TrickEntry<Native::TrickDescriptor{TrickAction::Throw,
+            Native::TrickInput::Hold | Native::TrickInput::PreArm | Native::TrickInput::Flick}, Tricks::ThrowTrick>,
+        Native::TrickEntry<Native::TrickDescriptor{TrickAction::FreezeThrow,
+            Native::TrickInput::Hold}, Tricks::FreezeThrowTrick>>;
+    TrickTable tricks;
+    Native::TrickLifecycle lifecycle;
+    uint8_t hand = Native::LeftHand;    // lifecycle events are tagged with it
     
     // Performance tracking
-    std::chrono::high_resolution_clock::time_point trickStartTime;
+    std::chrono::steady_clock::time_point trickStartTime;
     
     void InitializeComponents();
     void InitializeTricks();
@@ -64,12 +83,23 @@ private:
     
     void OnTrickStarted(TrickAction action);
     void OnTrickEnding(TrickAction action);
+    void PublishTrickEnded(TrickAction action);
     
     void ValidateComponents();
     void Cleanup();
     void CheckDirectInput();
+    void DrainInputEvents();
+    void ApplyInputEvent(const Native::InputEvent& event);
+    
+    // Input edge tracking
+    Native::DirectInputState directInput;
+    Native::InputEventQueue inputEvents;
+    Native::LatencyStats inputLatency;
+    
+    // Partial trigger pull warms a PreArm trick before the press
+    Native::TriggerArming throwArming;
     
-    // Input state tracking
-    bool triggerWasPressed = false;
-    bool thumbstickWasActive = false;
+    // Release for a flick-started Hold trick, which has no trigger release
+    Native::FlickHold flickHold;
+    Native::LatencyStats throwPressCost[2];     // [0] cold, [1] armed
 );
\ No newline at end of file
@@ -22,6 +22,7 @@ DECLARE_CLASS_CODEGEN(TrickSaber, SaberTrickModel, UnityEngine::MonoBehaviour,
     DECLARE_INSTANCE_FIELD(UnityEngine::GameObject*, trickModel);
     DECLARE_INSTANCE_FIELD(UnityEngine::Transform*, trickModelTransform);
     DECLARE_INSTANCE_FIELD(UnityEngine::Rigidbody*, rigidbody);
+    DECLARE_INSTANCE_FIELD(GlobalNamespace::SaberModelController*, saberModelController);
     
     DECLARE_INSTANCE_METHOD(void, OnDestroy);
     
@@ -34,6 +35,9 @@ public:
     void ChangeToActualSaber();
     void ChangeToTrickModel();
     
+    // Resolves the saber's model controller ahead of ChangeToTrickModel
+    void Prepare();
+    
     UnityEngine::Transform* GetSaberTransform();
     UnityEngine::Transform* GetTrickModelTransform();
     UnityEngine::Rigidbody* GetRigidbody();
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "GlobalNamespace/Saber.hpp"
+#include "GlobalNamespace/NoteController.hpp"
+#include "GlobalNamespace/AudioTimeSyncController.hpp"
+#include "TrickSaber/Native/NoteGrid.hpp"
+#include <memory>
+
+namespace TrickSaber {
+    // Lets a thrown saber cut notes. The note hooks keep the active notes in
+    // a Native::NoteGrid (added when a note starts its jump, removed when it
+    // is cut or missed), and the throw tests its swept blade against the
+    // notes near it each frame.
+    class ThrownSaberCutter {
+    public:
+        static void Initialize(GlobalNamespace::AudioTimeSyncController* audioController);
+        static void OnNoteDidStartJump(GlobalNamespace::NoteController* noteController);
+        static void OnNoteRemoved(GlobalNamespace::NoteController* noteController);
+        static void Clear();
+
+        // Song time now; 0 before Initialize
+        static float SongTime();
+
+        // Cuts every note the blade swept through between the two song times,
+        // the blade's start and end poses; returns the count
+        static int Cut(GlobalNamespace::Saber* saber, const Native::SweptBlade& blade, const Native::Quat& rotation,
+            float fromSongTime, float toSongTime);
+
+    private:
+        static void CutNote(GlobalNamespace::NoteController* noteController, GlobalNamespace::Saber* saber,
+            const Native::Vec3& point, const Native::Quat& rotation, const Native::Vec3& direction);
+        static bool ReadJump(GlobalNamespace::NoteController* noteController, float beatTime, Native::NoteGrid::Note& note);
+
+        static std::unique_ptr<Native::NoteGrid> grid;
+        static GlobalNamespace::AudioTimeSyncController* audioController;
+    };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "custom-types/shared/macros.hpp"
+#include "UnityEngine/MonoBehaviour.hpp"
+#include "TrickSaber/Native/EventBus.hpp"
+#include "TrickSaber/Native/TrickStateAggregate.hpp"
+
+// The one Unity Update for the trick system. Each frame it runs the global
+// note timer and input for both saber managers, then steps only the tricks
+// that are running. SaberTrickManager, GlobalTrickManager and the tricks
+// have no Update of their own, so an idle frame costs one managed callback.
+DECLARE_CLASS_CODEGEN(TrickSaber, TrickDriver, UnityEngine::MonoBehaviour,
+    DECLARE_INSTANCE_METHOD(void, Awake);
+    DECLARE_INSTANCE_METHOD(void, Update);
+    DECLARE_INSTANCE_METHOD(void, OnDestroy);
+    
+public:
+    // Creates the driver for the current scene unless one is running
+    static void Initialize();
+    static TrickDriver* GetInstance() { return instance; }
+    
+    // Unity Update callbacks each registered manager used to cost per frame:
+    // SaberTrickManager, SpinTrick and ThrowTrick
+    static constexpr int UpdatesPerManager = 3;
+    
+private:
+    static inline TrickDriver* instance = nullptr;
+    
+    // Running tricks, kept from lifecycle events
+    Native::TrickStateAggregate activeTricks;
+    
+    uint64_t frameCount = 0;
+    uint64_t idleFrameCount = 0;
+    uint64_t trickTickCount = 0;
+    uint64_t replacedCallbackCount = 0;
+    
+    static void HandleTrickStarted(void* context, const Native::TrickStartedEvent& event);
+    static void HandleTrickEnded(void* context, const Native::TrickEndedEvent& event);
+);
@@ -6,13 +6,20 @@
 #include "UnityEngine/Vector3.hpp"
 #include "UnityEngine/Quaternion.hpp"
 #include "UnityEngine/Rigidbody.hpp"
-#include "custom-types/shared/coroutine.hpp"
+#include "UnityEngine/Transform.hpp"
+#include "TrickSaber/Native/VecMath.hpp"
 
 DECLARE_CLASS_CODEGEN(TrickSaber::Tricks, FreezeThrowTrick, TrickSaber::Tricks::Trick,
+    DECLARE_CTOR(ctor);
     DECLARE_INSTANCE_METHOD(void, Awake);
-    DECLARE_INSTANCE_METHOD(void, Update);
+    DECLARE_INSTANCE_METHOD(bool, StartTrick, float value);
+    DECLARE_INSTANCE_METHOD(void, EndTrick);
+    DECLARE_INSTANCE_METHOD(void, EndTrickImmediately);
     
 public:
+    // Holds the saber in place, then eases it back to the hand on release
+    void Tick();
+    
     void Initialize(TrickSaber::SaberTrickManager* manager);
     void Initialize(TrickSaber::SaberTrickManager* manager, TrickSaber::SaberTrickModel* saberTrickModel);
     TrickSaber::TrickAction GetTrickAction();
@@ -28,7 +35,23 @@ private:
     UnityEngine::Rigidbody* rigidbody = nullptr;
     bool isFrozen = false;
     
+    // Saber slot in the hand's frame and the local pose to put back, taken
+    // when the saber freezes
+    UnityEngine::Transform* handTransform = nullptr;
+    Native::Vec3 slotOffset = Native::Zero3();
+    Native::Quat slotRotation = Native::IdentityQuat();
+    UnityEngine::Vector3 originalLocalPosition;
+    UnityEngine::Quaternion originalLocalRotation;
+    
+    // Return to the hand's saber slot, stepped from Tick
+    bool returning = false;
+    float returnTime = 0.0f;
+    UnityEngine::Vector3 returnStart;
+    UnityEngine::Quaternion returnStartRotation;
+    
     void FreezeSaber();
     void UnfreezeSaber();
-    custom_types::Helpers::Coroutine ReturnSaber();
+    void StepReturn();
+    void FinishReturn();
+    void RestoreLocalPose();
 );
\ No newline at end of file
@@ -3,37 +3,33 @@
 #include "TrickSaber/Tricks/Trick.hpp"
 #include "UnityEngine/Vector3.hpp"
 #include "UnityEngine/Quaternion.hpp"
+#include "UnityEngine/Transform.hpp"
+#include "TrickSaber/Native/SpinModel.hpp"
 
 DECLARE_CLASS_CODEGEN(TrickSaber::Tricks, SpinTrick, Trick,
+    DECLARE_CTOR(ctor);
     DECLARE_INSTANCE_METHOD(bool, StartTrick, float value);
-    DECLARE_INSTANCE_METHOD(void, Update);
     DECLARE_INSTANCE_METHOD(void, EndTrick);
     DECLARE_INSTANCE_METHOD(void, EndTrickImmediately);
     
 public:
+    void Tick();
+    
     // Input tracking for continuous updates
     float inputValue = 0.0f;
+    void SetInput(float value) { inputValue = value; }
     
 private:
-    enum class SpinState {
-        Spinning,
-        Stopping,
-        Completing
-    };
-    
-    SpinState state = SpinState::Spinning;
+    // Spin state and math (IL2CPP-free core)
+    Native::SpinModel model;
     
-    // Transform state
+    // Transform state, checked once in StartTrick
     UnityEngine::Vector3 originalLocalPosition;
-    UnityEngine::Quaternion originalLocalRotation;
-    
-    // Spin physics
-    float currentSpinSpeed = 0.0f;
-    float targetSpinSpeed = 0.0f;
-    float largestSpinSpeed = 0.0f;
+    UnityEngine::Transform* saberTransform = nullptr;
+    bool isLeft = false;
     
-    void UpdateSpinPhysics();
-    void ApplySpinRotation(float deltaTime);
-    void LerpToOriginalRotation(float deltaTime);
-    float CalculateTargetSpeed(float input);
+    Native::SpinParams BuildParams() const;
+    UnityEngine::Vector3 GetControllerAngularVelocity() const;
+    void ApplyModelRotation();
+    void FinishSpin();
 );
\ No newline at end of file
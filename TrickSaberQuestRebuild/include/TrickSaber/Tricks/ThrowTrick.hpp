@@ -5,51 +5,64 @@
 #include "UnityEngine/Quaternion.hpp"
 #include "UnityEngine/Transform.hpp"
 #include "UnityEngine/Rigidbody.hpp"
+#include "TrickSaber/Native/ThrowModel.hpp"
+#include "TrickSaber/Utils/PooledTrickCalculation.hpp"
+#include "GlobalNamespace/HapticFeedbackManager.hpp"
+
+#include <optional>
 
 DECLARE_CLASS_CODEGEN(TrickSaber::Tricks, ThrowTrick, Trick,
+    DECLARE_CTOR(ctor);
     DECLARE_INSTANCE_METHOD(bool, StartTrick, float value);
-    DECLARE_INSTANCE_METHOD(void, Update);
     DECLARE_INSTANCE_METHOD(void, EndTrick);
     DECLARE_INSTANCE_METHOD(void, EndTrickImmediately);
-    DECLARE_INSTANCE_METHOD(void, FixedUpdate);
     
-private:
-    enum class ThrowState {
-        Preparing,
-        Thrown,
-        Returning,
-        Snapping
-    };
-    
-    ThrowState state = ThrowState::Preparing;
-    
-    // Transform state
-    UnityEngine::Vector3 originalLocalPosition;
-    UnityEngine::Quaternion originalLocalRotation;
-    UnityEngine::Transform* originalParent = nullptr;
+public:
+    void Tick();
     
-    // Simple physics state
-    UnityEngine::Vector3 throwVelocity;
-    UnityEngine::Vector3 currentVelocity;
-    float saberRotSpeed = 0.0f;
+    // Trigger partially pulled: does the press-independent part of StartTrick
+    // now so the press frame only commits. Disarm drops it unused.
+    void Arm();
+    void Disarm();
+    bool IsArmed() const { return armed; }
     
-    // Return state
-    UnityEngine::Vector3 throwReleasePosition;
-    UnityEngine::Quaternion throwReleaseRotation;
-    float returnTime = 0.0f;
-    float returnDuration = 0.5f;
+private:
+    // Flight/return state and math (IL2CPP-free core)
+    Native::ThrowModel model;
+    
+    // Saber slot in the hand's frame (scale folded in), so the return target
+    // is worked out natively from the hand's world pose each frame
+    Native::Vec3 slotOffset = Native::Zero3();
+    Native::Quat slotRotation = Native::IdentityQuat();
+    UnityEngine::Transform* originalParent = nullptr;
+    UnityEngine::Transform* saberTransform = nullptr;    // checked once in StartTrick
     
     // Simple collision detection
     float snapBackDistance = 8.0f;
     
+    // Blade at the last rendered pose and the song time it was at, for the
+    // swept note test
+    Native::Vec3 bladeBase = Native::Zero3();
+    Native::Vec3 bladeTip = Native::Zero3();
+    float bladeSongTime = 0.0f;
+    bool hasBlade = false;
+    
+    // Warmed by Arm, or by StartTrick itself on an unarmed press
+    bool armed = false;
+    Native::ThrowParams armedParams;
+    GlobalNamespace::HapticFeedbackManager* hapticManager = nullptr;
+    std::optional<Utils::PooledTrickCalculation> calculation;
+    bool hasVelocityEstimate = false;
+    UnityEngine::Vector3 estimatedVelocity;
+    UnityEngine::Vector3 estimatedAngularVelocity;
+    
+    void Prepare();
+    float VelocityWindowMs() const;
+    Native::ThrowParams BuildParams() const;
     void ApplyThrowForces();
-    void UpdatePhysics();
-    void UpdateReturn();
-    void CalculateThrowForces();
+    void CalculateThrowForces(const Native::ThrowParams& params);
+    void ReleasePrepared();
+    void ApplyModelPose();
+    void CutNotes();
     void ThrowEnd();
-    bool ShouldSnapBack();
-    
-    // Simplified physics
-    void UpdatePhysicsSimplified();
-    void UpdateReturnSimplified();
 );
\ No newline at end of file
@@ -13,7 +13,6 @@ namespace TrickSaber {
 
 DECLARE_CLASS_CODEGEN(TrickSaber::Tricks, Trick, UnityEngine::MonoBehaviour,
     DECLARE_INSTANCE_METHOD(bool, StartTrick, float value);
-    DECLARE_INSTANCE_METHOD(void, Update);
     DECLARE_INSTANCE_METHOD(void, EndTrick);
     DECLARE_INSTANCE_METHOD(void, EndTrickImmediately);
     DECLARE_INSTANCE_METHOD(bool, IsActive);
@@ -23,6 +22,10 @@ public:
     // Initialize method with proper types
     void Initialize(SaberTrickManager* manager, SaberTrickModel* saberTrickModel);
     
+    // Per-frame step while active. Tricks have no Unity Update of their own;
+    // TrickDriver calls this through SaberTrickManager::TickTrick.
+    void Tick();
+    
     SaberTrickManager* manager = nullptr;
     SaberTrickModel* saberTrickModel = nullptr;
     bool active = false;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "GlobalNamespace/SaberType.hpp"
+#include "GlobalNamespace/HapticFeedbackManager.hpp"
+#include "TrickSaber/Native/EventBus.hpp"
 
 namespace TrickSaber::Utils {
     class HapticFeedbackHelper {
@@ -20,6 +22,20 @@ namespace TrickSaber::Utils {
         
         static void TriggerHaptic(GlobalNamespace::SaberType saberType, HapticType type);
         static void TriggerHaptic(GlobalNamespace::SaberType saberType, float duration, float strength);
+        
+        // Plays through a manager resolved earlier (see ResolveManager), skipping the lookup
+        static void TriggerHaptic(GlobalNamespace::HapticFeedbackManager* manager, GlobalNamespace::SaberType saberType, HapticType type);
+        
+        // Enabled haptic manager for the scene, or nullptr
+        static GlobalNamespace::HapticFeedbackManager* ResolveManager();
         static HapticParams GetHapticParams(HapticType type);
+        
+        // Plays TrickStart/SaberReturn on trick lifecycle events
+        static void SubscribeTrickEvents();
+        
+    private:
+        static void OnTrickStarted(void* context, const Native::TrickStartedEvent& event);
+        static void OnTrickEnded(void* context, const Native::TrickEndedEvent& event);
+        static void Play(GlobalNamespace::HapticFeedbackManager* manager, GlobalNamespace::SaberType saberType, float strength);
     };
 }
\ No newline at end of file
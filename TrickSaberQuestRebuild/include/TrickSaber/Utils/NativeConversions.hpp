@@ -0,0 +1,13 @@
+#pragma once
+
+#include "TrickSaber/Native/VecMath.hpp"
+#include "UnityEngine/Vector3.hpp"
+#include "UnityEngine/Quaternion.hpp"
+
+namespace TrickSaber::Utils {
+    inline Native::Vec3 ToNative(const UnityEngine::Vector3& v) { return {v.x, v.y, v.z}; }
+    inline Native::Quat ToNative(const UnityEngine::Quaternion& q) { return {q.x, q.y, q.z, q.w}; }
+
+    inline UnityEngine::Vector3 ToUnity(const Native::Vec3& v) { return UnityEngine::Vector3(v.x, v.y, v.z); }
+    inline UnityEngine::Quaternion ToUnity(const Native::Quat& q) { return UnityEngine::Quaternion(q.x, q.y, q.z, q.w); }
+} // namespace TrickSaber::Utils
@@ -6,26 +6,25 @@
 #include "GlobalNamespace/GameScenesManager.hpp"
 #include "GlobalNamespace/PauseController.hpp"
 #include "UnityEngine/Object.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
 #include "TrickSaber/Utils/LazyInitializer.hpp"
 #include <unordered_map>
-#include <chrono>
 #include <mutex>
 #include <typeindex>
 
 namespace TrickSaber::Utils {
     class ObjectCache {
     private:
+        // Entries live until the object is destroyed or the scene is torn
+        // down; expiring them by age only forced rescans mid-level
         struct CacheEntry {
             UnityEngine::Object* object;
-            std::chrono::steady_clock::time_point timestamp;
             
-            CacheEntry(UnityEngine::Object* obj) 
-                : object(obj), timestamp(std::chrono::steady_clock::now()) {}
+            CacheEntry(UnityEngine::Object* obj) : object(obj) {}
         };
         
         static LazyInitializer<std::unordered_map<std::type_index, CacheEntry>> lazyCache;
         static std::mutex cacheMutex;
-        static constexpr float CACHE_TIMEOUT_SECONDS = 15.0f;
         static constexpr size_t MAX_CACHE_SIZE = 16;
         
         static bool IsObjectValid(UnityEngine::Object* obj);
@@ -43,17 +42,14 @@ namespace TrickSaber::Utils {
             
             // Check if cached object exists and is still valid
             if (it != cache.end()) {
-                auto now = std::chrono::steady_clock::now();
-                auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - it->second.timestamp).count();
-                
-                if (elapsed < CACHE_TIMEOUT_SECONDS && IsObjectValid(it->second.object)) {
+                if (IsObjectValid(it->second.object)) {
                     return reinterpret_cast<T*>(it->second.object);
-                } else {
-                    cache.erase(it);
                 }
+                cache.erase(it);
             }
             
             // Find new object and cache it
+            Core::SaberManagerRegistry::RecordObjectScan("ObjectCache::GetCachedObject");
             auto* obj = UnityEngine::Object::FindObjectOfType<T*>();
             if (obj && cache.size() < MAX_CACHE_SIZE) {
                 cache.emplace(typeIndex, CacheEntry(reinterpret_cast<UnityEngine::Object*>(obj)));
@@ -83,5 +79,6 @@ namespace TrickSaber::Utils {
     public:
         static void WarmCache();
         static bool IsWarmed();
+        static void Reset();
     };
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "TrickSaber/Utils/LazyInitializer.hpp"
+#include "TrickSaber/Native/EventBus.hpp"
 #include <chrono>
 #include <unordered_map>
 #include <string>
@@ -37,8 +38,8 @@ namespace TrickSaber::Utils {
     private:
         static LazyInitializer<PerformanceMetrics> lazyInstance;
         
-        std::chrono::high_resolution_clock::time_point lastFrameTime;
-        std::chrono::high_resolution_clock::time_point startTime;
+        std::chrono::steady_clock::time_point lastFrameTime;
+        std::chrono::steady_clock::time_point startTime;
         
         FrameMetrics frameMetrics{};
         MemoryMetrics memoryMetrics{};
@@ -53,7 +54,7 @@ namespace TrickSaber::Utils {
         
         bool enabled = true;
         float reportInterval = 5.0f; // Report every 5 seconds
-        std::chrono::high_resolution_clock::time_point lastReport;
+        std::chrono::steady_clock::time_point lastReport;
 
     public:
         static PerformanceMetrics* GetInstance();
@@ -99,6 +100,9 @@ namespace TrickSaber::Utils {
         
     private:
         friend class LazyInitializer<PerformanceMetrics>;
+        
+        // Subscribed when the instance is created, so no metrics, no cost
+        static void OnTrickEnded(void* context, const Native::TrickEndedEvent& event);
     };
     
     // Lazy performance metrics initializer
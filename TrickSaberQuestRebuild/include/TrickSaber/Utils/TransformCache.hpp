@@ -23,6 +23,8 @@ struct CachedTransform {
         lastUpdateTime(0.0f) {}
 };
 
+// Expires on Time.time rather than the frame clock: the FixedUpdate velocity
+// path reads it, and there Time.time is the fixed-step time
 class TransformCache {
 private:
     static std::unordered_map<UnityEngine::Transform*, CachedTransform> cache;
@@ -1,6 +1,7 @@
 param(
     [switch]$Clean,
-    [string]$Filter = "*"
+    [string]$Filter = "*",
+    [string]$BuildType = "Debug"
 )
 
 $ErrorActionPreference = "Stop"
@@ -56,16 +57,22 @@ enable_testing()
 # Get test source files
 file(GLOB_RECURSE cpp_test_files "../test/*.cpp")
 
+# IL2CPP-free sources under test
+file(GLOB_RECURSE cpp_native_files "../src/TrickSaber/Native/*.cpp")
+
+find_package(Threads REQUIRED)
+
 # Create test executable
 add_executable(
     tricksaber_host_test
     ${cpp_test_files}
+    ${cpp_native_files}
 )
 
 # Link with GTest
 target_link_libraries(
     tricksaber_host_test
-    PRIVATE GTest::gtest_main
+    PRIVATE GTest::gtest_main Threads::Threads
 )
 
 # Include directories
@@ -93,7 +100,7 @@ gtest_discover_tests(tricksaber_host_test)
     $env:ANDROID_NDK_ROOT = $null
 
     & /opt/homebrew/bin/cmake -G "Unix Makefiles" `
-        -DCMAKE_BUILD_TYPE="Debug" `
+        -DCMAKE_BUILD_TYPE="$BuildType" `
         .
     
     if ($LASTEXITCODE -ne 0) { throw "CMake configuration failed" }
@@ -4,6 +4,7 @@ set -e
 
 CLEAN=false
 FILTER="*"
+BUILD_TYPE="Debug"
 
 # Parse command line arguments
 while [[ $# -gt 0 ]]; do
@@ -16,9 +17,13 @@ while [[ $# -gt 0 ]]; do
             FILTER="$2"
             shift 2
             ;;
+        --build-type)
+            BUILD_TYPE="$2"
+            shift 2
+            ;;
         *)
             echo "Unknown option: $1"
-            echo "Usage: $0 [--clean] [--filter PATTERN]"
+            echo "Usage: $0 [--clean] [--filter PATTERN] [--build-type Debug|Release]"
             exit 1
             ;;
     esac
@@ -77,16 +82,22 @@ enable_testing()
 # Get test source files
 file(GLOB_RECURSE cpp_test_files "../test/*.cpp")
 
+# IL2CPP-free sources under test
+file(GLOB_RECURSE cpp_native_files "../src/TrickSaber/Native/*.cpp")
+
+find_package(Threads REQUIRED)
+
 # Create test executable
 add_executable(
     tricksaber_host_test
     ${cpp_test_files}
+    ${cpp_native_files}
 )
 
 # Link with GTest
 target_link_libraries(
     tricksaber_host_test
-    PRIVATE GTest::gtest_main
+    PRIVATE GTest::gtest_main Threads::Threads
 )
 
 # Include directories
@@ -114,7 +125,7 @@ unset ANDROID_NDK
 unset ANDROID_NDK_ROOT
 
 /opt/homebrew/bin/cmake -G "Unix Makefiles" \
-    -DCMAKE_BUILD_TYPE="Debug" \
+    -DCMAKE_BUILD_TYPE="$BUILD_TYPE" \
     .
 
 # Build tests
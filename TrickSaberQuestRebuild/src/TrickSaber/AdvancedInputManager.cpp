@@ -1,7 +1,8 @@
 #include "TrickSaber/AdvancedInputManager.hpp"
 #include "TrickSaber/Configuration.hpp"
 #include "TrickSaber/SaberTrickManager.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
 #include "UnityEngine/Mathf.hpp"
 #include "UnityEngine/Object.hpp"
 #include "main.hpp"
@@ -33,14 +34,12 @@ void AdvancedInputManager::Update() {
 void AdvancedInputManager::CheckTriggerInput() {
     using namespace TrickSaber::Configuration;
     
-    // Left trigger
-    bool leftPressed = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Button::PrimaryIndexTrigger, 
-        GlobalNamespace::OVRInput::Controller::LTouch);
+    const auto& snapshot = Core::InputSnapshotService::Get();
     
-    float leftValue = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis1D::PrimaryIndexTrigger,
-        GlobalNamespace::OVRInput::Controller::LTouch);
+    // Left trigger
+    const auto& left = snapshot.hands[Native::LeftHand];
+    bool leftPressed = left.Pressed(Native::Trace::TriggerButton);
+    float leftValue = left.trigger;
     
     if (leftPressed && !leftTriggerPressed && leftValue > GetTriggerThreshold()) {
         OnInputActivated(GetTriggerAction(), leftValue, true);
@@ -50,13 +49,9 @@ void AdvancedInputManager::CheckTriggerInput() {
     leftTriggerPressed = leftPressed;
     
     // Right trigger
-    bool rightPressed = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Button::PrimaryIndexTrigger,
-        GlobalNamespace::OVRInput::Controller::RTouch);
-    
-    float rightValue = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis1D::PrimaryIndexTrigger,
-        GlobalNamespace::OVRInput::Controller::RTouch);
+    const auto& right = snapshot.hands[Native::RightHand];
+    bool rightPressed = right.Pressed(Native::Trace::TriggerButton);
+    float rightValue = right.trigger;
     
     if (rightPressed && !rightTriggerPressed && rightValue > GetTriggerThreshold()) {
         OnInputActivated(GetTriggerAction(), rightValue, false);
@@ -71,14 +66,12 @@ void AdvancedInputManager::CheckGripInput() {
     
     if (GetGripAction() == TrickAction::None) return;
     
-    // Left grip
-    bool leftPressed = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Button::PrimaryHandTrigger,
-        GlobalNamespace::OVRInput::Controller::LTouch);
+    const auto& snapshot = Core::InputSnapshotService::Get();
     
-    float leftValue = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis1D::PrimaryHandTrigger,
-        GlobalNamespace::OVRInput::Controller::LTouch);
+    // Left grip
+    const auto& left = snapshot.hands[Native::LeftHand];
+    bool leftPressed = left.Pressed(Native::Trace::GripButton);
+    float leftValue = left.grip;
     
     if (leftPressed && !leftGripPressed && leftValue > GetGripThreshold()) {
         OnInputActivated(GetGripAction(), leftValue, true);
@@ -88,13 +81,9 @@ void AdvancedInputManager::CheckGripInput() {
     leftGripPressed = leftPressed;
     
     // Right grip
-    bool rightPressed = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Button::PrimaryHandTrigger,
-        GlobalNamespace::OVRInput::Controller::RTouch);
-    
-    float rightValue = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis1D::PrimaryHandTrigger,
-        GlobalNamespace::OVRInput::Controller::RTouch);
+    const auto& right = snapshot.hands[Native::RightHand];
+    bool rightPressed = right.Pressed(Native::Trace::GripButton);
+    float rightValue = right.grip;
     
     if (rightPressed && !rightGripPressed && rightValue > GetGripThreshold()) {
         OnInputActivated(GetGripAction(), rightValue, false);
@@ -109,13 +98,13 @@ void AdvancedInputManager::CheckThumbstickInput() {
     
     if (GetThumbstickAction() == TrickAction::None) return;
     
-    // Left thumbstick
-    auto leftStick = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis2D::PrimaryThumbstick,
-        GlobalNamespace::OVRInput::Controller::LTouch);
+    const auto& snapshot = Core::InputSnapshotService::Get();
+    bool horizontal = GetThumbstickDirection() == ThumbstickDir::Horizontal;
     
-    float leftValue = (GetThumbstickDirection() == ThumbstickDir::Horizontal) ? 
-        UnityEngine::Mathf::Abs(leftStick.x) : UnityEngine::Mathf::Abs(leftStick.y);
+    // Left thumbstick
+    const auto& leftStick = snapshot.hands[Native::LeftHand];
+    float leftValue = horizontal ? 
+        UnityEngine::Mathf::Abs(leftStick.stickX) : UnityEngine::Mathf::Abs(leftStick.stickY);
     bool leftActive = leftValue > GetThumbstickThreshold();
     
     if (leftActive && !leftThumbstickActive) {
@@ -128,12 +117,9 @@ void AdvancedInputManager::CheckThumbstickInput() {
     leftThumbstickActive = leftActive;
     
     // Right thumbstick
-    auto rightStick = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis2D::PrimaryThumbstick,
-        GlobalNamespace::OVRInput::Controller::RTouch);
-    
-    float rightValue = (GetThumbstickDirection() == ThumbstickDir::Horizontal) ?
-        UnityEngine::Mathf::Abs(rightStick.x) : UnityEngine::Mathf::Abs(rightStick.y);
+    const auto& rightStick = snapshot.hands[Native::RightHand];
+    float rightValue = horizontal ?
+        UnityEngine::Mathf::Abs(rightStick.stickX) : UnityEngine::Mathf::Abs(rightStick.stickY);
     bool rightActive = rightValue > GetThumbstickThreshold();
     
     if (rightActive && !rightThumbstickActive) {
@@ -149,56 +135,28 @@ void AdvancedInputManager::CheckThumbstickInput() {
 void AdvancedInputManager::OnInputActivated(TrickAction action, float value, bool isLeft) {
     if (action == TrickAction::None) return;
     
-    // Find managers using simple search
-    auto foundManagers = UnityEngine::Object::FindObjectsOfType<SaberTrickManager*>();
-    if (!foundManagers) return;
-    
-    for (int i = 0; i < foundManagers->get_Length(); i++) {
-        auto manager = foundManagers->_values[i];
-        if (!manager || !manager->saber) continue;
-        
-        bool managerIsLeft = (manager->saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
-        if (managerIsLeft == isLeft) {
-            manager->OnTrickActivated(action, value);
-            break;
-        }
-    }
+    auto manager = Core::SaberManagerRegistry::Get(isLeft);
+    if (!manager || !manager->saber) return;
+    
+    manager->EnqueueInput(Native::InputEdge::Press, action, value, Core::InputSnapshotService::Get().time);
 }
 
 void AdvancedInputManager::OnInputDeactivated(TrickAction action, bool isLeft) {
     if (action == TrickAction::None) return;
     
-    auto foundManagers = UnityEngine::Object::FindObjectsOfType<SaberTrickManager*>();
-    if (!foundManagers) return;
-    
-    for (int i = 0; i < foundManagers->get_Length(); i++) {
-        auto manager = foundManagers->_values[i];
-        if (!manager || !manager->saber) continue;
-        
-        bool managerIsLeft = (manager->saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
-        if (managerIsLeft == isLeft) {
-            manager->OnTrickDeactivated(action);
-            break;
-        }
-    }
+    auto manager = Core::SaberManagerRegistry::Get(isLeft);
+    if (!manager || !manager->saber) return;
+    
+    manager->EnqueueInput(Native::InputEdge::Release, action, 0.0f, Core::InputSnapshotService::Get().time);
 }
 
 void AdvancedInputManager::OnInputUpdated(TrickAction action, float value, bool isLeft) {
-    if (action == TrickAction::None) return;
+    if (action != TrickAction::Spin) return;
     
-    auto foundManagers = UnityEngine::Object::FindObjectsOfType<SaberTrickManager*>();
-    if (!foundManagers) return;
-    
-    for (int i = 0; i < foundManagers->get_Length(); i++) {
-        auto manager = foundManagers->_values[i];
-        if (!manager || !manager->saber) continue;
-        
-        bool managerIsLeft = (manager->saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
-        if (managerIsLeft == isLeft && manager->IsDoingTrick() && action == TrickAction::Spin) {
-            manager->OnTrickActivated(action, value);
-            break;
-        }
-    }
+    auto manager = Core::SaberManagerRegistry::Get(isLeft);
+    if (!manager || !manager->saber || !manager->IsDoingTrick()) return;
+    
+    manager->EnqueueInput(Native::InputEdge::Update, action, value, Core::InputSnapshotService::Get().time);
 }
 
 void AdvancedInputManager::Initialize() {
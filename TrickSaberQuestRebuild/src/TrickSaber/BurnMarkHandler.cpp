@@ -1,4 +1,6 @@
 #include "TrickSaber/BurnMarkHandler.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
 #include "main.hpp"
 
 #include "GlobalNamespace/SaberBurnMarkArea.hpp"
@@ -17,18 +19,37 @@ bool BurnMarkHandler::initialized = false;
 
 void BurnMarkHandler::Initialize() {
     if (initialized) return;
+    Core::TrickEvents::Subscribe<Native::TrickStartedEvent>(&BurnMarkHandler::OnTrickStarted);
+    Core::TrickEvents::Subscribe<Native::TrickEndedEvent>(&BurnMarkHandler::OnTrickEnded);
+    
     burnTypes.clear();
     burnTypes.push_back(csTypeOf(SaberBurnMarkArea*));
     burnTypes.push_back(csTypeOf(SaberBurnMarkSparkles*));
     burnTypes.push_back(csTypeOf(ObstacleSaberSparkleEffectManager*));
+    
+    // Looked up once during level setup so starting a trick never scans the scene
+    for (auto type : burnTypes) {
+        Core::SaberManagerRegistry::RecordObjectScan("BurnMarkHandler::Initialize");
+        disabledBurnmarks[type] = UnityEngine::Object::FindObjectsOfType(type);
+    }
     initialized = true;
 }
 
+// Hand index and SaberType share values (SaberA is the left hand)
+void BurnMarkHandler::OnTrickStarted(void*, const Native::TrickStartedEvent& event) {
+    DisableBurnMarks(event.hand);
+}
+
+void BurnMarkHandler::OnTrickEnded(void*, const Native::TrickEndedEvent& event) {
+    EnableBurnMarks(event.hand);
+}
+
 void BurnMarkHandler::DisableBurnMarks(int saberType) {
     // Simple implementation - just cache the components for later restoration
     for (auto type : burnTypes) {
         auto& components = disabledBurnmarks[type];
         if (!components) {
+            Core::SaberManagerRegistry::RecordObjectScan("BurnMarkHandler::DisableBurnMarks");
             components = UnityEngine::Object::FindObjectsOfType(type);
         }
         // Components are cached for restoration later
@@ -36,12 +57,8 @@ void BurnMarkHandler::DisableBurnMarks(int saberType) {
 }
 
 void BurnMarkHandler::EnableBurnMarks(int saberType, bool force) {
-    // Simple implementation - just clear the cached components
-    // The actual burn marks will be re-enabled when the components are recreated
-    for (auto type : burnTypes) {
-        auto& components = disabledBurnmarks[type];
-        components = ArrayW<::UnityW<::UnityEngine::Object>>();
-    }
+    // The cached components stay valid for the whole level; ClearCache drops
+    // them on scene change. Clearing them here forced a rescan on every trick.
 }
 
 void BurnMarkHandler::ClearCache() {
@@ -31,7 +31,7 @@ namespace TrickSaber {
     }
     
     TrickAction ValidateTrickAction(int value, TrickAction defaultValue) {
-        if (value >= static_cast<int>(TrickAction::None) && value <= static_cast<int>(TrickAction::Spin)) {
+        if (value >= static_cast<int>(TrickAction::None) && value <= static_cast<int>(TrickAction::FreezeThrow)) {
             return static_cast<TrickAction>(value);
         }
         Logger.error("Invalid TrickAction value, using default");
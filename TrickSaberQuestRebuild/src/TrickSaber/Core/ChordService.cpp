@@ -0,0 +1,79 @@
+#include "TrickSaber/Core/ChordService.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Configuration.hpp"
+#include "main.hpp"
+
+#include <bit>
+
+namespace TrickSaber::Core {
+    void ChordService::RefreshBindings() {
+        // Every action a chord can resolve to, packed one byte per input
+        uint64_t signature = 0;
+        for (const auto& channel : Native::DirectInputChannels) {
+            signature = (signature << 8) | static_cast<uint8_t>(config.*(channel.action));
+        }
+        if (signature == bindingSignature) return;
+
+        Native::ChordBinding bindings[Native::ChordMatcher::MaxBindings];
+        int count = Native::BuildConfigChords(config, bindings, Native::ChordMatcher::MaxBindings);
+        matcher.SetBindings(bindings, count);
+        bindingSignature = signature;
+        rebuildCount++;
+        Logger.debug("Chord table rebuilt: {} bindings", matcher.BindingCount());
+    }
+
+    const ChordFrame& ChordService::Update() {
+        const auto& snapshot = InputSnapshotService::Get();
+        if (hasFrame && current.frame == snapshot.frame) return current;
+
+        RefreshBindings();
+
+        Native::ChordMask pressed = 0;
+        float values[Native::ChordBitCount] = {};
+        for (int hand = Native::LeftHand; hand <= Native::RightHand; ++hand) {
+            Native::ChannelContext context{
+                &config,
+                hand == Native::LeftHand,
+                TrickSaber::Configuration::GetTriggerThreshold(),
+                TrickSaber::Configuration::GetThumbstickThreshold()
+            };
+            const auto& sample = snapshot.hands[hand];
+            Native::VisitChannels<Native::DirectInputChannels>([&]<Native::InputChannel Channel>() {
+                if (config.*(Channel.action) == TrickAction::None) return;
+                float value = 0.0f;
+                if (Native::ReadChannel<Channel>(sample, context, value)) {
+                    pressed |= Native::ChordBit(hand, static_cast<Native::InputSlot>(Channel.slot));
+                    values[hand * Native::InputSlotCount + Channel.slot] = value;
+                }
+            });
+        }
+
+        current = ChordFrame{};
+        current.frame = snapshot.frame;
+        current.transition = matcher.Update(pressed, FrameClock::Now(), current.binding);
+        hasFrame = true;
+
+        if (current.transition == Native::ChordTransition::Started) {
+            float total = 0.0f;
+            for (Native::ChordMask bits = current.binding.mask; bits != 0; bits &= bits - 1) {
+                total += values[std::countr_zero(bits)];
+            }
+            current.value = total / std::popcount(current.binding.mask);
+            chordCount++;
+        }
+        return current;
+    }
+
+    void ChordService::Invalidate() {
+        if (rebuildCount > 0) {
+            Logger.info("ChordService: {} chords over {} table rebuilds", chordCount, rebuildCount);
+        }
+
+        matcher.Reset();
+        current = ChordFrame{};
+        hasFrame = false;
+        rebuildCount = 0;
+        chordCount = 0;
+    }
+}
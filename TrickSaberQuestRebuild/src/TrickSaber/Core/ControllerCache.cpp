@@ -0,0 +1,35 @@
+#include "TrickSaber/Core/ControllerCache.hpp"
+#include "GlobalNamespace/VRController.hpp"
+#include "main.hpp"
+
+namespace TrickSaber::Core {
+    void ControllerCache::Resolve(GlobalNamespace::SaberManager* saberManager) {
+        slots = ControllerSlots{};
+        slots.saberManager = saberManager;
+        if (!saberManager) return;
+        
+        slots.leftHand = ResolveHand(saberManager->get_leftSaber());
+        slots.rightHand = ResolveHand(saberManager->get_rightSaber());
+        
+        Logger.debug("ControllerCache resolved - left: {}, right: {}", 
+            slots.leftHand != nullptr, slots.rightHand != nullptr);
+    }
+
+    void ControllerCache::Invalidate() {
+        if (slots.saberManager || tickCount > 0) {
+            Logger.info("ControllerCache: {} component lookups over {} physics ticks", lookupCount, tickCount);
+        }
+        
+        slots = ControllerSlots{};
+        lookupCount = 0;
+        tickCount = 0;
+    }
+
+    UnityEngine::Transform* ControllerCache::ResolveHand(GlobalNamespace::Saber* saber) {
+        if (!saber) return nullptr;
+        
+        lookupCount++;
+        auto controller = saber->get_transform()->GetComponentInParent<GlobalNamespace::VRController*>();
+        return controller ? controller->get_transform() : nullptr;
+    }
+}
@@ -0,0 +1,32 @@
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "main.hpp"
+
+#include "UnityEngine/Time.hpp"
+
+namespace TrickSaber::Core {
+    namespace {
+        void SampleEngineTime(Native::FrameTime& time) {
+            time.time = UnityEngine::Time::get_time();
+            time.deltaTime = UnityEngine::Time::get_deltaTime();
+            time.fixedDeltaTime = UnityEngine::Time::get_fixedDeltaTime();
+        }
+    }
+
+    void FrameClock::BeginFrame() {
+        clock.Advance(static_cast<uint64_t>(UnityEngine::Time::get_frameCount()), SampleEngineTime);
+    }
+
+    void FrameClock::SampleBeforeFirstFrame() {
+        // Unity frame ids start at 1
+        clock.Advance(0, SampleEngineTime);
+    }
+
+    void FrameClock::Invalidate() {
+        if (clock.GetFrameCount() > 0) {
+            Logger.info("FrameClock: {} frames sampled, {} begin calls",
+                clock.GetFrameCount(), clock.GetBeginCount());
+        }
+
+        clock.Reset();
+    }
+}
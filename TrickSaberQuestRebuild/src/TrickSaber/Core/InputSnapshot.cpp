@@ -0,0 +1,52 @@
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "main.hpp"
+
+#include "GlobalNamespace/OVRInput.hpp"
+#include "UnityEngine/Vector2.hpp"
+
+using namespace GlobalNamespace;
+
+namespace {
+    // Reads are unconditional so a controller that reports disconnected but
+    // still delivers input is handled the way the old per-manager fallback did
+    uint32_t SampleController(OVRInput::Controller controller, TrickSaber::Native::ControllerSample& sample) {
+        using TrickSaber::Native::Trace::InputButton;
+
+        sample.connected = OVRInput::IsControllerConnected(controller);
+        sample.trigger = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, controller);
+        sample.grip = OVRInput::Get(OVRInput::Axis1D::PrimaryHandTrigger, controller);
+        auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, controller);
+        sample.stickX = stick.x;
+        sample.stickY = stick.y;
+
+        uint32_t buttons = 0;
+        if (OVRInput::Get(OVRInput::Button::PrimaryIndexTrigger, controller)) buttons |= InputButton::TriggerButton;
+        if (OVRInput::Get(OVRInput::Button::PrimaryHandTrigger, controller)) buttons |= InputButton::GripButton;
+        if (OVRInput::Get(OVRInput::Button::One, controller)) buttons |= InputButton::ButtonOne;
+        if (OVRInput::Get(OVRInput::Button::Two, controller)) buttons |= InputButton::ButtonTwo;
+        if (OVRInput::Get(OVRInput::Button::PrimaryThumbstick, controller)) buttons |= InputButton::ThumbstickClick;
+        sample.buttons = buttons;
+
+        return 9;
+    }
+}
+
+namespace TrickSaber::Core {
+    const Native::InputSnapshot& InputSnapshotService::Get() {
+        // Keyed on the frame the clock already stamped; no engine call here
+        return buffer.Acquire(FrameClock::Frame(), FrameClock::Now(), [](Native::InputSnapshot& snapshot) {
+            return SampleController(OVRInput::Controller::LTouch, snapshot.hands[Native::LeftHand]) +
+                   SampleController(OVRInput::Controller::RTouch, snapshot.hands[Native::RightHand]);
+        });
+    }
+
+    void InputSnapshotService::Invalidate() {
+        if (buffer.GetSampleCount() > 0) {
+            Logger.info("InputSnapshot: {} OVRInput calls over {} frames, {} reads served",
+                buffer.GetInteropCallCount(), buffer.GetSampleCount(), buffer.GetReadCount());
+        }
+
+        buffer.Reset();
+    }
+}
@@ -0,0 +1,41 @@
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
+#include "main.hpp"
+
+#include <cassert>
+
+namespace TrickSaber::Core {
+    void SaberManagerRegistry::Join(SaberTrickManager* manager, bool isLeft) {
+        if (!manager) return;
+
+        auto* previous = slots.Join(isLeft ? Native::LeftHand : Native::RightHand, manager);
+        if (previous && previous != manager) {
+            Logger.warn("SaberManagerRegistry: {} slot replaced without leaving", isLeft ? "left" : "right");
+        }
+    }
+
+    void SaberManagerRegistry::Leave(SaberTrickManager* manager, bool isLeft) {
+        slots.Leave(isLeft ? Native::LeftHand : Native::RightHand, manager);
+    }
+
+    void SaberManagerRegistry::RecordObjectScan(const char* site) {
+        objectScans++;
+        if (slots.Count() == 0) return;
+
+        // First one per scene is enough to find the caller
+        if (gameplayScans++ == 0) {
+            Logger.warn("FindObjectsOfType during gameplay from {}", site);
+        }
+        assert(!"FindObjectsOfType during gameplay");
+    }
+
+    void SaberManagerRegistry::Invalidate() {
+        if (objectScans > 0 || slots.GetJoinCount() > 0) {
+            Logger.info("SaberManagerRegistry: {} joins, {} leaves, {} object scans ({} during gameplay)",
+                slots.GetJoinCount(), slots.GetLeaveCount(), objectScans, gameplayScans);
+        }
+
+        slots.ResetCounters();
+        objectScans = 0;
+        gameplayScans = 0;
+    }
+}
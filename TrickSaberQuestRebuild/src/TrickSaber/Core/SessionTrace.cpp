@@ -0,0 +1,38 @@
+#include "TrickSaber/Core/SessionTrace.hpp"
+#include "TrickSaber/Native/TraceRecorder.hpp"
+#include "TrickSaber/Config.hpp"
+#include "TrickSaber/Constants.hpp"
+#include "main.hpp"
+
+#include <ctime>
+#include <filesystem>
+
+namespace TrickSaber::Core {
+    void SessionTrace::Begin() {
+        End();
+        if (!config.enableTraceRecording) return;
+        
+        std::error_code error;
+        std::filesystem::create_directories(Constants::TRACE_DIRECTORY, error);
+        if (error) {
+            Logger.error("SessionTrace: cannot create {}: {}", Constants::TRACE_DIRECTORY, error.message());
+            return;
+        }
+        
+        auto path = fmt::format("{}/trace_{}.tstrace", Constants::TRACE_DIRECTORY, static_cast<long long>(std::time(nullptr)));
+        if (Native::TraceRecorder::GetInstance().Start(path, Constants::TRACE_RING_BYTES)) {
+            Logger.info("SessionTrace: recording to {}", path);
+        } else {
+            Logger.error("SessionTrace: failed to open {}", path);
+        }
+    }
+    
+    void SessionTrace::End() {
+        auto& recorder = Native::TraceRecorder::GetInstance();
+        if (!recorder.IsRecording()) return;
+        
+        recorder.Stop();
+        Logger.info("SessionTrace: {} records written to {}, {} dropped",
+            recorder.GetRecordCount(), recorder.GetPath(), recorder.GetDroppedCount());
+    }
+}
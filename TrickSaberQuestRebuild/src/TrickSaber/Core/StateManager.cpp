@@ -1,4 +1,5 @@
 #include "TrickSaber/Core/StateManager.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/Constants.hpp"
 #include "TrickSaber/Utils/ObjectCache.hpp"
 #include "TrickSaber/BurnMarkHandler.hpp"
@@ -38,13 +39,13 @@ namespace TrickSaber::Core {
     }
 
     bool StateManager::ShouldValidateCache() const {
-        auto now = std::chrono::steady_clock::now();
+        auto now = FrameClock::SteadyNow();
         auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - lastCacheValidation);
         return elapsed.count() > Constants::CACHE_VALIDATION_INTERVAL_SEC;
     }
 
     void StateManager::UpdateCacheValidationTime() {
-        lastCacheValidation = std::chrono::steady_clock::now();
+        lastCacheValidation = FrameClock::SteadyNow();
     }
 
     void StateManager::Reset() {
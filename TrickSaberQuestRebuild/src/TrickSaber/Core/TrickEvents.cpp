@@ -0,0 +1,18 @@
+#include "TrickSaber/Core/TrickEvents.hpp"
+#include "main.hpp"
+
+namespace TrickSaber::Core {
+    void TrickEvents::Invalidate() {
+        if (bus.GetPublishCount() > 0) {
+            Logger.info("TrickEvents: {} started, {} ending, {} ended ({}/{}/{} subscribers)",
+                bus.Get<Native::TrickStartedEvent>().GetPublishCount(),
+                bus.Get<Native::TrickEndingEvent>().GetPublishCount(),
+                bus.Get<Native::TrickEndedEvent>().GetPublishCount(),
+                bus.Get<Native::TrickStartedEvent>().Count(),
+                bus.Get<Native::TrickEndingEvent>().Count(),
+                bus.Get<Native::TrickEndedEvent>().Count());
+        }
+
+        bus.ResetCounters();
+    }
+}
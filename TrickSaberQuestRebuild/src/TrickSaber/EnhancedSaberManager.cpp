@@ -1,5 +1,7 @@
 #include "TrickSaber/EnhancedSaberManager.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/Config.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
 #include "main.hpp"
 
 #include "GlobalNamespace/OVRInput.hpp"
@@ -48,6 +50,7 @@ void EnhancedSaberManager::InitializeSaberState(SaberPhysicsState& state, Global
 void EnhancedSaberManager::FixedUpdate() {
     if (!initialized || !config.trickSaberEnabled) return;
     
+    // Fixed phase: read the step directly rather than stamping the frame clock
     float deltaTime = UnityEngine::Time::get_fixedDeltaTime();
     if (deltaTime <= 0.00001f) deltaTime = 1.0f / 90.0f;
     
@@ -71,14 +74,12 @@ void EnhancedSaberManager::ProcessSaberInput(int saberIndex) {
     auto& state = GetSaberState(saberIndex);
     if (!state.saberTransform) return;
     
-    bool isLeft = saberIndex == 0;
-    auto controller = isLeft ? OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
+    const auto& input = Core::InputSnapshotService::Get(saberIndex == 0);
     
     // Handle throw input
     bool throwPressed = false;
     if (config.triggerAction == TrickAction::Throw) {
-        float triggerValue = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, controller);
-        throwPressed = triggerValue >= config.triggerThreshold;
+        throwPressed = input.trigger >= config.triggerThreshold;
     }
     
     HandleThrowInput(state, saberIndex, throwPressed);
@@ -86,9 +87,8 @@ void EnhancedSaberManager::ProcessSaberInput(int saberIndex) {
     // Handle spin input
     bool spinPressed = false;
     if (config.thumbstickAction == TrickAction::Spin) {
-        auto thumbstick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, controller);
         float magnitude = config.thumbstickDirection == ThumbstickDir::Horizontal ? 
-            abs(thumbstick.x) : abs(thumbstick.y);
+            abs(input.stickX) : abs(input.stickY);
         spinPressed = magnitude >= config.thumbstickThreshold;
     }
     
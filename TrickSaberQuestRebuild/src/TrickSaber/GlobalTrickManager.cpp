@@ -4,13 +4,13 @@
 #include "TrickSaber/Tricks/Trick.hpp"
 #include "TrickSaber/Config.hpp"
 #include "TrickSaber/Configuration.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
 #include "main.hpp"
 #include "UnityEngine/Object.hpp"
 #include "UnityEngine/GameObject.hpp"
-#include "UnityEngine/Time.hpp"
 #include "UnityEngine/AudioSource.hpp"
 #include "beatsaber-hook/shared/utils/il2cpp-utils.hpp"
-#include <algorithm>
 
 DEFINE_TYPE(TrickSaber, GlobalTrickManager);
 
@@ -20,19 +20,15 @@ void GlobalTrickManager::Awake() {
     instance = this;
     saberClashEnabled = true;
     timeSinceLastNote = 0.0f;
-    lastCacheUpdate = std::chrono::steady_clock::now();
-    RefreshManagerCache();
-}
-
-void GlobalTrickManager::Update() {
-    ValidateManagerCache();
     
-    if (config.disableIfNotesOnScreen) {
-        timeSinceLastNote += UnityEngine::Time::get_deltaTime();
-    }
+    Core::TrickEvents::Subscribe<Native::TrickStartedEvent>(&GlobalTrickManager::HandleTrickStarted, this);
+    Core::TrickEvents::Subscribe<Native::TrickEndedEvent>(&GlobalTrickManager::HandleTrickEnded, this);
 }
 
 void GlobalTrickManager::OnDestroy() {
+    Core::TrickEvents::Unsubscribe<Native::TrickStartedEvent>(&GlobalTrickManager::HandleTrickStarted, this);
+    Core::TrickEvents::Unsubscribe<Native::TrickEndedEvent>(&GlobalTrickManager::HandleTrickEnded, this);
+    
     if (instance == this) {
         instance = nullptr;
     }
@@ -59,7 +55,16 @@ void GlobalTrickManager::Cleanup() {
     }
 }
 
-void GlobalTrickManager::OnTrickStarted(TrickAction action) {
+void GlobalTrickManager::HandleTrickStarted(void* context, const Native::TrickStartedEvent& event) {
+    static_cast<GlobalTrickManager*>(context)->OnTrickStarted(event.action, event.hand == Native::LeftHand);
+}
+
+void GlobalTrickManager::HandleTrickEnded(void* context, const Native::TrickEndedEvent& event) {
+    static_cast<GlobalTrickManager*>(context)->OnTrickEnded(event.action, event.hand == Native::LeftHand);
+}
+
+void GlobalTrickManager::OnTrickStarted(TrickAction action, bool isLeft) {
+    trickState.Started(isLeft ? Native::LeftHand : Native::RightHand, action);
     saberClashEnabled = false;
     
     // Apply slowmo for throw tricks if enabled
@@ -98,13 +103,15 @@ void GlobalTrickManager::OnTrickEndRequested(TrickAction action) {
     Logger.debug("Trick end requested: {}", static_cast<int>(action));
 }
 
-void GlobalTrickManager::OnTrickEnded(TrickAction action) {
+void GlobalTrickManager::OnTrickEnded(TrickAction action, bool isLeft) {
+    trickState.Ended(isLeft ? Native::LeftHand : Native::RightHand, action);
+    
     // Re-enable clash only when no tricks are active
     if (!IsDoingTrick()) {
         saberClashEnabled = true;
         
         // Clean up any lingering effects using cached managers
-        auto managers = GetCachedManagers();
+        const auto& managers = Core::SaberManagerRegistry::All();
         for (auto manager : managers) {
             if (manager && manager->saberTrickModel) {
                 // Ensure proper cleanup of trick models
@@ -118,28 +125,6 @@ void GlobalTrickManager::OnTrickEnded(TrickAction action) {
     }
 }
 
-bool GlobalTrickManager::IsTrickInState(TrickAction action, TrickState state) {
-    auto managers = GetCachedManagers();
-    
-    for (auto manager : managers) {
-        if (manager && manager->IsTrickInState(action, state)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool GlobalTrickManager::IsDoingTrick() {
-    auto managers = GetCachedManagers();
-    
-    for (auto manager : managers) {
-        if (manager && manager->IsDoingTrick()) {
-            return true;
-        }
-    }
-    return false;
-}
-
 bool GlobalTrickManager::CanDoTrick() {
     if (!config.disableIfNotesOnScreen) return true;
     return timeSinceLastNote > 1.0f;
@@ -149,23 +134,17 @@ bool GlobalTrickManager::CanStartTrick(TrickAction action, int saberType) {
     if (!CanDoTrick()) return false;
     
     // Prevent conflicting tricks on same saber
-    auto managers = GetCachedManagers();
-    
-    for (auto manager : managers) {
-        if (!manager || !manager->saber) continue;
-        
-        int managerSaberType = static_cast<int>(manager->saber->get_saberType());
-        if (managerSaberType == saberType && manager->IsDoingTrick()) {
-            Logger.debug("Cannot start trick - saber {} already doing trick", saberType);
-            return false;
-        }
+    int hand = saberType == static_cast<int>(GlobalNamespace::SaberType::SaberA) ? Native::LeftHand : Native::RightHand;
+    if (trickState.IsHandActive(hand)) {
+        Logger.debug("Cannot start trick - saber {} already doing trick", saberType);
+        return false;
     }
     
     return true;
 }
 
 void GlobalTrickManager::EndAllTricks() {
-    auto managers = GetCachedManagers();
+    const auto& managers = Core::SaberManagerRegistry::All();
     
     for (auto manager : managers) {
         if (manager) {
@@ -180,6 +159,7 @@ void GlobalTrickManager::EndAllTricks() {
     }
     
     // Reset global state
+    trickState.Clear();
     saberClashEnabled = true;
     timeSinceLastNote = 0.0f;
     
@@ -194,53 +174,6 @@ void GlobalTrickManager::OnNoteSpawned() {
     timeSinceLastNote = 0.0f;
 }
 
-void GlobalTrickManager::RefreshManagerCache() {
-    cachedManagers.clear();
-    
-    // Use FindObjectsOfType as fallback when cache needs refresh
-    auto managers = UnityEngine::Object::FindObjectsOfType<SaberTrickManager*>();
-    if (managers) {
-        cachedManagers.reserve(managers->get_Length());
-        for (int i = 0; i < managers->get_Length(); i++) {
-            if (managers->_values[i]) {
-                cachedManagers.push_back(managers->_values[i]);
-            }
-        }
-    }
-    
-    lastCacheUpdate = std::chrono::steady_clock::now();
-    Logger.debug("Manager cache refreshed: {} managers", cachedManagers.size());
-}
-
-void GlobalTrickManager::ValidateManagerCache() {
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - lastCacheUpdate);
-    
-    if (elapsed.count() > 5) { // Refresh every 5 seconds
-        RefreshManagerCache();
-    } else {
-        // Quick validation - remove null managers
-        cachedManagers.erase(
-            std::remove_if(cachedManagers.begin(), cachedManagers.end(),
-                [](SaberTrickManager* manager) { return !manager; }),
-            cachedManagers.end());
-    }
-}
-
-std::vector<TrickSaber::SaberTrickManager*> GlobalTrickManager::GetCachedManagers() {
-    ValidateManagerCache();
-    return cachedManagers;
-}
-
-void GlobalTrickManager::UpdateTricks() {
-    auto managers = GetCachedManagers();
-    
-    for (auto manager : managers) {
-        if (manager && manager->enabled) {
-            manager->UpdateActiveTricks();
-        }
-    }
-}
 void GlobalTrickManager::StartSlowmo(float targetTimeScale) {
     if (!audioController) return;
     
@@ -267,25 +200,3 @@ void GlobalTrickManager::SetTimeScale(float timeScale) {
         Logger.debug("No audio source found for slowmo effect");
     }
 }
-
-int GlobalTrickManager::GetActiveThrowCount() {
-    int count = 0;
-    auto managers = GetCachedManagers();
-    for (auto manager : managers) {
-        if (manager && manager->IsTrickInState(TrickAction::Throw, TrickState::Started)) {
-            count++;
-        }
-    }
-    return count;
-}
-
-int GlobalTrickManager::GetActiveSpinCount() {
-    int count = 0;
-    auto managers = GetCachedManagers();
-    for (auto manager : managers) {
-        if (manager && manager->IsTrickInState(TrickAction::Spin, TrickState::Started)) {
-            count++;
-        }
-    }
-    return count;
-}
\ No newline at end of file
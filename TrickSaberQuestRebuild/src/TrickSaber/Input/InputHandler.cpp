@@ -1,8 +1,9 @@
 #include "TrickSaber/Input/InputHandler.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
 #include "UnityEngine/XR/InputTracking.hpp"
 #include <cmath>
 
+using namespace TrickSaber;
 using namespace TrickSaber::Input;
 using namespace GlobalNamespace;
 
@@ -10,10 +11,9 @@ TriggerHandler::TriggerHandler(UnityEngine::XR::XRNode node, float threshold)
     : node(node), threshold(threshold), wasPressed(false) {}
 
 bool TriggerHandler::IsActivated(float& value) {
-    auto controller = (node == UnityEngine::XR::XRNode::LeftHand) ? 
-        OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
+    const auto& input = Core::InputSnapshotService::Get(node == UnityEngine::XR::XRNode::LeftHand);
     
-    value = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, controller);
+    value = input.trigger;
     bool isPressed = value >= threshold;
     
     if (isPressed && !wasPressed) {
@@ -26,10 +26,9 @@ bool TriggerHandler::IsActivated(float& value) {
 
 bool TriggerHandler::IsDeactivated() {
     float value;
-    auto controller = (node == UnityEngine::XR::XRNode::LeftHand) ? 
-        OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
+    const auto& input = Core::InputSnapshotService::Get(node == UnityEngine::XR::XRNode::LeftHand);
     
-    value = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, controller);
+    value = input.trigger;
     bool isPressed = value >= threshold;
     
     if (!isPressed && wasPressed) {
@@ -44,15 +43,12 @@ ThumbstickHandler::ThumbstickHandler(UnityEngine::XR::XRNode node, float thresho
     : node(node), threshold(threshold), direction(direction), wasPressed(false) {}
 
 bool ThumbstickHandler::IsActivated(float& value) {
-    auto controller = (node == UnityEngine::XR::XRNode::LeftHand) ? 
-        OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
-    
-    auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, controller);
+    const auto& input = Core::InputSnapshotService::Get(node == UnityEngine::XR::XRNode::LeftHand);
     
     if (direction == ThumbstickDir::Horizontal) {
-        value = stick.x;
+        value = input.stickX;
     } else {
-        value = stick.y;
+        value = input.stickY;
     }
     
     bool isPressed = std::abs(value) >= threshold;
@@ -66,12 +62,9 @@ bool ThumbstickHandler::IsActivated(float& value) {
 }
 
 bool ThumbstickHandler::IsDeactivated() {
-    auto controller = (node == UnityEngine::XR::XRNode::LeftHand) ? 
-        OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
-    
-    auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, controller);
+    const auto& input = Core::InputSnapshotService::Get(node == UnityEngine::XR::XRNode::LeftHand);
     
-    float value = (direction == ThumbstickDir::Horizontal) ? stick.x : stick.y;
+    float value = (direction == ThumbstickDir::Horizontal) ? input.stickX : input.stickY;
     bool isPressed = std::abs(value) >= threshold;
     
     if (!isPressed && wasPressed) {
@@ -86,7 +79,7 @@ GripHandler::GripHandler(GlobalNamespace::OVRInput::Controller controller, float
     : controller(controller), threshold(threshold), wasPressed(false) {}
 
 bool GripHandler::IsActivated(float& value) {
-    value = OVRInput::Get(OVRInput::Axis1D::PrimaryHandTrigger, controller);
+    value = Core::InputSnapshotService::Get(controller == OVRInput::Controller::LTouch).grip;
     bool isPressed = value >= threshold;
     
     if (isPressed && !wasPressed) {
@@ -98,7 +91,7 @@ bool GripHandler::IsActivated(float& value) {
 }
 
 bool GripHandler::IsDeactivated() {
-    float value = OVRInput::Get(OVRInput::Axis1D::PrimaryHandTrigger, controller);
+    float value = Core::InputSnapshotService::Get(controller == OVRInput::Controller::LTouch).grip;
     bool isPressed = value >= threshold;
     
     if (!isPressed && wasPressed) {
@@ -2,11 +2,13 @@
 #include "TrickSaber/Config.hpp"
 #include "TrickSaber/Configuration.hpp"
 #include "TrickSaber/Constants.hpp"
+#include "TrickSaber/Core/ChordService.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Native/InputChannels.hpp"
 #include "main.hpp"
 
-#include "UnityEngine/Vector2.hpp"
 #include "GlobalNamespace/SaberType.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
 #include <cmath>
 
 DEFINE_TYPE(TrickSaber, InputManager);
@@ -16,22 +18,16 @@ using namespace GlobalNamespace;
 
 void InputManager::Awake() {
     // Initialize input states
-    triggerState = {};
-    gripState = {};
-    thumbstickState = {};
-    buttonOneState = {};
-    buttonTwoState = {};
-    
+    // May run before the frame clock is first stamped
     auto now = std::chrono::steady_clock::now();
-    triggerState.lastChangeTime = now;
-    gripState.lastChangeTime = now;
-    thumbstickState.lastChangeTime = now;
-    buttonOneState.lastChangeTime = now;
-    buttonTwoState.lastChangeTime = now;
+    for (auto& state : states) {
+        state = {};
+        state.lastChangeTime = now;
+    }
     lastConnectionCheck = now;
     
     wasConnected = false;
-    activeCombination = {};
+    activeChordAction = TrickAction::None;
 }
 
 void InputManager::Update() {
@@ -41,7 +37,7 @@ void InputManager::Update() {
     
     try {
         // Check controller connection periodically
-        auto now = std::chrono::steady_clock::now();
+        auto now = Core::FrameClock::SteadyNow();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastConnectionCheck);
         
         if (elapsed.count() >= Constants::CONNECTION_CHECK_INTERVAL_MS) {
@@ -76,33 +72,36 @@ void InputManager::Initialize(GlobalNamespace::VRController* vrController, Globa
     controller = vrController;
     this->saberType = static_cast<int>(saberType);
     
-    // Set OVR controller based on saber type
-    ovrController = (saberType == GlobalNamespace::SaberType::SaberA) ? 
-        OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
-    
     Logger.info("InputManager initialized for {} saber", 
         saberType == GlobalNamespace::SaberType::SaberA ? "left" : "right");
 }
 
 void InputManager::CheckInputs() {
-    // Check each configured input type with debouncing
-    CheckInput([this](float& v) { return GetTriggerValue(v); }, triggerState, config.triggerAction);
-    CheckInput([this](float& v) { return GetGripValue(v); }, gripState, config.gripAction);
-    CheckInput([this](float& v) { return GetThumbstickValue(v); }, thumbstickState, config.thumbstickAction);
-    CheckInput([this](float& v) { return GetButtonOneValue(v); }, buttonOneState, config.buttonOneAction);
-    CheckInput([this](float& v) { return GetButtonTwoValue(v); }, buttonTwoState, config.buttonTwoAction);
+    // Each configured channel from the table, unrolled at compile time
+    const auto& sample = GetSample();
+    bool detected = IsControllerDetected();
+    Native::ChannelContext context{
+        &config,
+        saberType == 0,
+        TrickSaber::Configuration::GetTriggerThreshold(),
+        TrickSaber::Configuration::GetThumbstickThreshold()
+    };
+    
+    Native::VisitChannels<Native::DirectInputChannels>([&]<Native::InputChannel Channel>() {
+        TrickAction action = config.*(Channel.action);
+        if (action == TrickAction::None) return;
+        
+        float value = 0.0f;
+        bool isPressed = detected && Native::ReadChannel<Channel>(sample, context, value);
+        CheckInput(isPressed, value, states[Channel.slot], action);
+    });
     
     // Check for multi-input combinations
     CheckMultiInputCombinations();
 }
 
-void InputManager::CheckInput(std::function<bool(float&)> getValue, InputState& state, TrickAction action) {
-    if (action == TrickAction::None || !getValue) return;
-    
+void InputManager::CheckInput(bool isPressed, float value, InputState& state, TrickAction action) {
     try {
-        float value = 0.0f;
-        bool isPressed = getValue(value);
-        
         // Validate value is finite
         if (!std::isfinite(value)) {
             value = 0.0f;
@@ -113,7 +112,7 @@ void InputManager::CheckInput(std::function<bool(float&)> getValue, InputState&
         if (isPressed != state.pressed && IsDebounceTimeElapsed(state)) {
             state.pressed = isPressed;
             state.lastValue = value;
-            state.lastChangeTime = std::chrono::steady_clock::now();
+            state.lastChangeTime = Core::FrameClock::SteadyNow();
             
             if (isPressed) {
                 if (onTrickActivated) {
@@ -134,132 +133,12 @@ void InputManager::CheckInput(std::function<bool(float&)> getValue, InputState&
     } catch (...) {
         Logger.error("Error checking input for action {}", static_cast<int>(action));
         state.pressed = false; // Reset to safe state
-        state.lastChangeTime = std::chrono::steady_clock::now();
-    }
-}
-
-bool InputManager::GetTriggerValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        value = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, ovrController);
-        
-        // Clamp value to valid range
-        value = std::clamp(value, 0.0f, 1.0f);
-        
-        if (config.reverseTrigger) {
-            value = 1.0f - value;
-        }
-        
-        return value >= TrickSaber::Configuration::GetTriggerThreshold();
-    } catch (...) {
-        Logger.error("Error reading trigger value");
-        value = 0.0f;
-        return false;
-    }
-}
-
-bool InputManager::GetGripValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        value = OVRInput::Get(OVRInput::Axis1D::PrimaryHandTrigger, ovrController);
-        
-        // Clamp value to valid range
-        value = std::clamp(value, 0.0f, 1.0f);
-        
-        if (config.reverseGrip) {
-            value = 1.0f - value;
-        }
-        
-        return value >= TrickSaber::Configuration::GetTriggerThreshold(); // Using trigger threshold for grip
-    } catch (...) {
-        Logger.error("Error reading grip value");
-        value = 0.0f;
-        return false;
-    }
-}
-
-bool InputManager::GetThumbstickValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-    
-    // Check for momentum spin mode with thumbstick press
-    if (config.spinMode == SpinMode::Momentum && config.thumbstickAction == TrickAction::Spin) {
-        bool thumbstickPressed = OVRInput::Get(OVRInput::Button::PrimaryThumbstick, ovrController);
-        value = thumbstickPressed ? 1.0f : 0.0f;
-        return thumbstickPressed;
-    }
-    
-    auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, ovrController);
-    
-    // Check if thumbstick is outside deadzone
-    if (stick.get_magnitude() < config.thumbstickDeadzone) {
-        value = 0.0f;
-        return false;
-    }
-    
-    switch (config.spinMode) {
-        case SpinMode::OmniDirectional: {
-            float xValue = std::abs(stick.x);
-            float yValue = std::abs(stick.y);
-            
-            if (xValue > yValue && xValue >= TrickSaber::Configuration::GetThumbstickThreshold()) {
-                value = stick.x;
-            } else if (yValue >= TrickSaber::Configuration::GetThumbstickThreshold()) {
-                value = stick.y;
-            } else {
-                value = 0.0f;
-                return false;
-            }
-            break;
-        }
-        case SpinMode::AngleSpeed:
-            value = stick.get_magnitude() >= TrickSaber::Configuration::GetThumbstickThreshold() ? 
-                   (std::atan2(stick.y, stick.x) * Constants::RADIANS_TO_DEGREES) : 0.0f;
-            break;
-            
-        case SpinMode::Traditional:
-        default: {
-            bool correctDirection = (saberType == 0) ? 
-                (stick.x < -config.thumbstickDeadzone) : (stick.x > config.thumbstickDeadzone);
-            
-            if (!correctDirection || std::abs(stick.x) < TrickSaber::Configuration::GetThumbstickThreshold()) {
-                value = 0.0f;
-                return false;
-            }
-            
-            value = stick.x;
-            break;
-        }
-    }
-    
-    // Apply reverse if configured
-    if (config.reverseThumbstick) {
-        value = -value;
-    }
-    
-    return std::abs(value) >= TrickSaber::Configuration::GetThumbstickThreshold();
-    
-    } catch (...) {
-        Logger.error("Error reading thumbstick value");
-        value = 0.0f;
-        return false;
+        state.lastChangeTime = Core::FrameClock::SteadyNow();
     }
 }
 
 bool InputManager::IsDebounceTimeElapsed(const InputState& state) const {
-    auto now = std::chrono::steady_clock::now();
+    auto now = Core::FrameClock::SteadyNow();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - state.lastChangeTime);
     return elapsed.count() >= Constants::DEBOUNCE_TIME_MS;
 }
@@ -268,24 +147,20 @@ bool InputManager::IsControllerConnected() const {
     return wasConnected;
 }
 
+const Native::ControllerSample& InputManager::GetSample() const {
+    return Core::InputSnapshotService::Get(saberType == 0);
+}
+
 bool InputManager::IsControllerDetected() {
+    const auto& sample = GetSample();
+    
     // Primary detection method
-    if (OVRInput::IsControllerConnected(ovrController)) {
+    if (sample.connected) {
         return true;
     }
     
-    // Fallback: Check if VRController is enabled and tracking
-    if (controller && controller->get_enabled()) {
-        // Additional validation - check if we can get any input
-        try {
-            float testValue = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, ovrController);
-            return std::isfinite(testValue);
-        } catch (...) {
-            // If we can't read input, controller likely not connected
-        }
-    }
-    
-    return false;
+    // Fallback: VRController is enabled and the runtime still reports input
+    return controller && controller->get_enabled() && std::isfinite(sample.trigger);
 }
 
 void InputManager::HandleControllerConnectionChange(bool connected) {
@@ -294,54 +169,35 @@ void InputManager::HandleControllerConnectionChange(bool connected) {
             saberType == 0 ? "left" : "right");
         
         // Reset input states on reconnection
-        triggerState = {};
-        gripState = {};
-        thumbstickState = {};
-        buttonOneState = {};
-        buttonTwoState = {};
-        
-        auto now = std::chrono::steady_clock::now();
-        triggerState.lastChangeTime = now;
-        gripState.lastChangeTime = now;
-        thumbstickState.lastChangeTime = now;
-        buttonOneState.lastChangeTime = now;
-        buttonTwoState.lastChangeTime = now;
+        auto now = Core::FrameClock::SteadyNow();
+        for (auto& state : states) {
+            state = {};
+            state.lastChangeTime = now;
+        }
         
-        activeCombination = {};
+        activeChordAction = TrickAction::None;
         
     } else if (!connected && wasConnected) {
         Logger.warn("Controller {} disconnected", 
             saberType == 0 ? "left" : "right");
         
         // End any active tricks when controller disconnects
-        if (triggerState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.triggerAction);
-        }
-        if (gripState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.gripAction);
-        }
-        if (thumbstickState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.thumbstickAction);
-        }
-        if (buttonOneState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.buttonOneAction);
-        }
-        if (buttonTwoState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.buttonTwoAction);
-        }
+        Native::VisitChannels<Native::DirectInputChannels>([&]<Native::InputChannel Channel>() {
+            if (states[Channel.slot].pressed && onTrickDeactivated) {
+                onTrickDeactivated(config.*(Channel.action));
+            }
+        });
         
-        // End any active combination
-        if (activeCombination.active && onTrickDeactivated) {
-            onTrickDeactivated(activeCombination.primaryAction);
+        // End any active chord
+        if (activeChordAction != TrickAction::None && onTrickDeactivated) {
+            onTrickDeactivated(activeChordAction);
         }
         
         // Reset all states
-        triggerState.pressed = false;
-        gripState.pressed = false;
-        thumbstickState.pressed = false;
-        buttonOneState.pressed = false;
-        buttonTwoState.pressed = false;
-        activeCombination = {};
+        for (auto& state : states) {
+            state.pressed = false;
+        }
+        activeChordAction = TrickAction::None;
     }
 }
 
@@ -351,8 +207,8 @@ void InputManager::CheckInputsSimplified() {
     float triggerValue = 0.0f;
     bool triggerPressed = GetTriggerValueSimplified(triggerValue);
     
-    if (triggerPressed != triggerState.pressed) {
-        triggerState.pressed = triggerPressed;
+    if (triggerPressed != states[Native::TriggerSlot].pressed) {
+        states[Native::TriggerSlot].pressed = triggerPressed;
         if (triggerPressed && onTrickActivated) {
             onTrickActivated(config.triggerAction, triggerValue);
         } else if (!triggerPressed && onTrickDeactivated) {
@@ -363,8 +219,8 @@ void InputManager::CheckInputsSimplified() {
     float thumbstickValue = 0.0f;
     bool thumbstickPressed = GetThumbstickValueSimplified(thumbstickValue);
     
-    if (thumbstickPressed != thumbstickState.pressed) {
-        thumbstickState.pressed = thumbstickPressed;
+    if (thumbstickPressed != states[Native::ThumbstickSlot].pressed) {
+        states[Native::ThumbstickSlot].pressed = thumbstickPressed;
         if (thumbstickPressed && onTrickActivated) {
             onTrickActivated(config.thumbstickAction, thumbstickValue);
         } else if (!thumbstickPressed && onTrickDeactivated) {
@@ -379,7 +235,7 @@ bool InputManager::GetTriggerValueSimplified(float& value) {
         return false;
     }
     
-    value = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, ovrController);
+    value = GetSample().trigger;
     return value >= Constants::SIMPLIFIED_TRIGGER_THRESHOLD;
 }
 
@@ -389,140 +245,33 @@ bool InputManager::GetThumbstickValueSimplified(float& value) {
         return false;
     }
     
-    auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, ovrController);
+    const auto& sample = GetSample();
     
     // Simple horizontal check
-    bool correctDirection = (saberType == 0) ? (stick.x < -Constants::SIMPLIFIED_THUMBSTICK_THRESHOLD) : (stick.x > Constants::SIMPLIFIED_THUMBSTICK_THRESHOLD);
-    value = correctDirection ? stick.x : 0.0f;
+    bool correctDirection = (saberType == 0) ? (sample.stickX < -Constants::SIMPLIFIED_THUMBSTICK_THRESHOLD) : (sample.stickX > Constants::SIMPLIFIED_THUMBSTICK_THRESHOLD);
+    value = correctDirection ? sample.stickX : 0.0f;
     return correctDirection;
 }
 
 void InputManager::CheckMultiInputCombinations() {
-    auto now = std::chrono::steady_clock::now();
-    
-    // Check if current combination is still active
-    if (activeCombination.active) {
-        bool primaryStillPressed = GetInputState(activeCombination.primaryAction).pressed;
-        bool secondaryStillPressed = GetInputState(activeCombination.secondaryAction).pressed;
-        
-        if (!primaryStillPressed || !secondaryStillPressed) {
-            // End combination
-            if (onTrickDeactivated) {
-                onTrickDeactivated(activeCombination.primaryAction);
-            }
-            activeCombination.active = false;
-            Logger.debug("Multi-input combination ended: {} + {}", 
-                static_cast<int>(activeCombination.primaryAction), 
-                static_cast<int>(activeCombination.secondaryAction));
-        }
+    const auto& chord = Core::ChordService::Update();
+    int hand = saberType == 0 ? Native::LeftHand : Native::RightHand;
+    if (chord.transition == Native::ChordTransition::None || !(chord.binding.mask & Native::HandChordMask(hand))) {
         return;
     }
     
-    // Check for new combinations
-    struct InputPair {
-        TrickAction action1, action2;
-        InputState* state1;
-        InputState* state2;
-        const char* name;
-    };
-    
-    InputPair combinations[] = {
-        {config.triggerAction, config.gripAction, &triggerState, &gripState, "trigger+grip"},
-        {config.triggerAction, config.thumbstickAction, &triggerState, &thumbstickState, "trigger+thumbstick"},
-        {config.gripAction, config.thumbstickAction, &gripState, &thumbstickState, "grip+thumbstick"},
-        {config.triggerAction, config.buttonOneAction, &triggerState, &buttonOneState, "trigger+button1"},
-        {config.gripAction, config.buttonOneAction, &gripState, &buttonOneState, "grip+button1"}
-    };
-    
-    for (const auto& combo : combinations) {
-        if (combo.action1 == TrickAction::None || combo.action2 == TrickAction::None) continue;
-        if (combo.action1 == combo.action2) continue; // Same action on different inputs
-        
-        if (combo.state1->pressed && combo.state2->pressed) {
-            // Check if both inputs were pressed within combination window
-            auto timeDiff = std::abs(std::chrono::duration_cast<std::chrono::milliseconds>(
-                combo.state1->lastChangeTime - combo.state2->lastChangeTime).count());
-            
-            if (timeDiff <= Constants::COMBINATION_WINDOW_MS) {
-                // Start combination - prioritize primary action
-                activeCombination.active = true;
-                activeCombination.primaryAction = combo.action1;
-                activeCombination.secondaryAction = combo.action2;
-                activeCombination.startTime = now;
-                
-                if (onTrickActivated) {
-                    float combinedValue = (combo.state1->lastValue + combo.state2->lastValue) / 2.0f;
-                    onTrickActivated(combo.action1, combinedValue);
-                }
-                
-                Logger.debug("Multi-input combination started: {} ({})", combo.name, timeDiff);
-                break;
-            }
-        }
-    }
-}
-
-InputManager::InputState& InputManager::GetInputState(TrickAction action) {
-    switch (action) {
-        case TrickAction::Throw:
-            if (config.triggerAction == TrickAction::Throw) return triggerState;
-            if (config.gripAction == TrickAction::Throw) return gripState;
-            if (config.buttonOneAction == TrickAction::Throw) return buttonOneState;
-            break;
-        case TrickAction::Spin:
-            if (config.thumbstickAction == TrickAction::Spin) return thumbstickState;
-            if (config.triggerAction == TrickAction::Spin) return triggerState;
-            if (config.gripAction == TrickAction::Spin) return gripState;
-            break;
-        default:
-            break;
-    }
-    return triggerState; // Fallback
-}
-
-bool InputManager::GetButtonOneValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        // Button One is typically the A/X button
-        bool pressed = OVRInput::Get(OVRInput::Button::One, ovrController);
-        value = pressed ? 1.0f : 0.0f;
-        
-        if (config.reverseButtonOne) {
-            value = 1.0f - value;
+    if (chord.transition == Native::ChordTransition::Started) {
+        activeChordAction = chord.binding.action;
+        if (onTrickActivated) {
+            onTrickActivated(chord.binding.action, chord.value);
         }
-        
-        return pressed;
-    } catch (...) {
-        Logger.error("Error reading button one value");
-        value = 0.0f;
-        return false;
-    }
-}
-
-bool InputManager::GetButtonTwoValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        // Button Two is typically the B/Y button
-        bool pressed = OVRInput::Get(OVRInput::Button::Two, ovrController);
-        value = pressed ? 1.0f : 0.0f;
-        
-        if (config.reverseButtonTwo) {
-            value = 1.0f - value;
+        Logger.debug("Multi-input chord started: mask {:#x} -> {}", chord.binding.mask, static_cast<int>(chord.binding.action));
+    } else if (activeChordAction != TrickAction::None) {
+        if (onTrickDeactivated) {
+            onTrickDeactivated(activeChordAction);
         }
-        
-        return pressed;
-    } catch (...) {
-        Logger.error("Error reading button two value");
-        value = 0.0f;
-        return false;
+        activeChordAction = TrickAction::None;
+        Logger.debug("Multi-input chord ended: mask {:#x}", chord.binding.mask);
     }
 }
 
@@ -1,11 +1,13 @@
 #include "TrickSaber/InputManager_Enhanced.hpp"
 #include "TrickSaber/Config.hpp"
 #include "TrickSaber/Configuration.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Native/InputChannels.hpp"
 #include "main.hpp"
 
 #include "UnityEngine/Vector2.hpp"
 #include "GlobalNamespace/SaberType.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -37,14 +39,12 @@ bool InputManagerEnhanced::EnhancedInputState::ValidateStateChange(bool newState
 
 void InputManagerEnhanced::Awake() {
     // Initialize enhanced input states
-    triggerState = {};
-    gripState = {};
-    thumbstickState = {};
-    
+    // May run before the frame clock is first stamped
     auto now = std::chrono::steady_clock::now();
-    triggerState.lastChangeTime = now;
-    gripState.lastChangeTime = now;
-    thumbstickState.lastChangeTime = now;
+    for (auto& state : states) {
+        state = {};
+        state.lastChangeTime = now;
+    }
     lastConnectionCheck = now;
     
     wasConnected = false;
@@ -57,7 +57,7 @@ void InputManagerEnhanced::Update() {
     
     try {
         // Check controller connection periodically
-        auto now = std::chrono::steady_clock::now();
+        auto now = Core::FrameClock::SteadyNow();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastConnectionCheck);
         
         if (elapsed.count() >= CONNECTION_CHECK_INTERVAL_MS) {
@@ -75,9 +75,9 @@ void InputManagerEnhanced::Update() {
     } catch (const std::bad_alloc& e) {
         Logger.error("Memory allocation failed in InputManagerEnhanced::Update: {}", e.what());
         // Reset input states to prevent memory issues
-        triggerState = {};
-        gripState = {};
-        thumbstickState = {};
+        for (auto& state : states) {
+            state = {};
+        }
     } catch (const std::runtime_error& e) {
         Logger.error("Runtime error in InputManagerEnhanced::Update: {}", e.what());
         // Log controller state for debugging
@@ -88,9 +88,9 @@ void InputManagerEnhanced::Update() {
     } catch (...) {
         Logger.error("Unknown error in InputManagerEnhanced::Update - resetting input states");
         // Reset states as recovery measure
-        triggerState.pressed = false;
-        gripState.pressed = false;
-        thumbstickState.pressed = false;
+        for (auto& state : states) {
+            state.pressed = false;
+        }
     }
 }
 
@@ -103,28 +103,33 @@ void InputManagerEnhanced::Initialize(GlobalNamespace::VRController* vrControlle
     controller = vrController;
     this->saberType = static_cast<int>(saberType);
     
-    // Set OVR controller based on saber type
-    ovrController = (saberType == GlobalNamespace::SaberType::SaberA) ? 
-        OVRInput::Controller::LTouch : OVRInput::Controller::RTouch;
-    
     Logger.info("InputManagerEnhanced initialized for {} saber", 
         saberType == GlobalNamespace::SaberType::SaberA ? "left" : "right");
 }
 
 void InputManagerEnhanced::CheckInputs() {
-    // Check each configured input type with enhanced processing
-    CheckEnhancedInput([this](float& v) { return GetTriggerValue(v); }, triggerState, config.triggerAction);
-    CheckEnhancedInput([this](float& v) { return GetGripValue(v); }, gripState, config.gripAction);
-    CheckEnhancedInput([this](float& v) { return GetThumbstickValue(v); }, thumbstickState, config.thumbstickAction);
+    // Check each configured channel with enhanced processing
+    const auto& sample = GetSample();
+    bool detected = IsControllerDetected();
+    Native::ChannelContext context{
+        &config,
+        saberType == 0,
+        Configuration::GetTriggerThreshold(),
+        Configuration::GetThumbstickThreshold()
+    };
+    
+    Native::VisitChannels<Native::SmoothedInputChannels>([&]<Native::InputChannel Channel>() {
+        TrickAction action = config.*(Channel.action);
+        if (action == TrickAction::None) return;
+        
+        float value = 0.0f;
+        bool isPressed = detected && Native::ReadChannel<Channel>(sample, context, value);
+        CheckEnhancedInput(isPressed, value, states[Channel.slot], action);
+    });
 }
 
-void InputManagerEnhanced::CheckEnhancedInput(std::function<bool(float&)> getValue, EnhancedInputState& state, TrickAction action) {
-    if (action == TrickAction::None || !getValue) return;
-    
+void InputManagerEnhanced::CheckEnhancedInput(bool rawPressed, float rawValue, EnhancedInputState& state, TrickAction action) {
     try {
-        float rawValue = 0.0f;
-        bool rawPressed = getValue(rawValue);
-        
         // Validate value is finite
         if (!std::isfinite(rawValue)) {
             rawValue = 0.0f;
@@ -136,12 +141,7 @@ void InputManagerEnhanced::CheckEnhancedInput(std::function<bool(float&)> getVal
         float smoothedValue = state.GetSmoothedValue();
         
         // Apply hysteresis for state determination
-        bool hysteresisPressed;
-        if (state.pressed) {
-            hysteresisPressed = smoothedValue >= state.releaseThreshold;
-        } else {
-            hysteresisPressed = smoothedValue >= state.pressThreshold;
-        }
+        bool hysteresisPressed = state.hysteresis.Next(state.pressed, smoothedValue);
         
         // Validate state change (require 2 consecutive frames)
         if (state.ValidateStateChange(hysteresisPressed) && 
@@ -150,7 +150,7 @@ void InputManagerEnhanced::CheckEnhancedInput(std::function<bool(float&)> getVal
             
             state.pressed = hysteresisPressed;
             state.lastValue = smoothedValue;
-            state.lastChangeTime = std::chrono::steady_clock::now();
+            state.lastChangeTime = Core::FrameClock::SteadyNow();
             
 #ifdef DEBUG
             LogInputDiagnostics(state, action, smoothedValue);
@@ -175,114 +175,31 @@ void InputManagerEnhanced::CheckEnhancedInput(std::function<bool(float&)> getVal
     } catch (const std::runtime_error& e) {
         Logger.error("Runtime error checking input for action {}: {}", static_cast<int>(action), e.what());
         state.pressed = false;
-        state.lastChangeTime = std::chrono::steady_clock::now();
+        state.lastChangeTime = Core::FrameClock::SteadyNow();
     } catch (const std::exception& e) {
         Logger.error("Exception checking input for action {}: {}", static_cast<int>(action), e.what());
         state.pressed = false;
-        state.lastChangeTime = std::chrono::steady_clock::now();
+        state.lastChangeTime = Core::FrameClock::SteadyNow();
     } catch (...) {
         Logger.error("Unknown error checking enhanced input for action {} - resetting state", static_cast<int>(action));
         state.pressed = false;
-        state.lastChangeTime = std::chrono::steady_clock::now();
-    }
-}
-
-bool InputManagerEnhanced::GetTriggerValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        value = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, ovrController);
-        value = std::clamp(value, 0.0f, 1.0f);
-        
-        if (config.reverseTrigger) {
-            value = 1.0f - value;
-        }
-        
-        return value >= Configuration::GetTriggerThreshold();
-    } catch (const std::exception& e) {
-        Logger.debug("Exception getting trigger value: {}", e.what());
-        value = 0.0f;
-        return false;
-    } catch (...) {
-        value = 0.0f;
-        return false;
-    }
-}
-
-bool InputManagerEnhanced::GetGripValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        value = OVRInput::Get(OVRInput::Axis1D::PrimaryHandTrigger, ovrController);
-        value = std::clamp(value, 0.0f, 1.0f);
-        
-        if (config.reverseGrip) {
-            value = 1.0f - value;
-        }
-        
-        return value >= Configuration::GetTriggerThreshold();
-    } catch (const std::exception& e) {
-        Logger.debug("Exception getting grip value: {}", e.what());
-        value = 0.0f;
-        return false;
-    } catch (...) {
-        value = 0.0f;
-        return false;
-    }
-}
-
-bool InputManagerEnhanced::GetThumbstickValue(float& value) {
-    if (!IsControllerDetected()) {
-        value = 0.0f;
-        return false;
-    }
-    
-    try {
-        auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, ovrController);
-        
-        if (stick.get_magnitude() < config.thumbstickDeadzone) {
-            value = 0.0f;
-            return false;
-        }
-        
-        // Use horizontal component for traditional spin
-        value = stick.x;
-        
-        if (config.reverseThumbstick) {
-            value = -value;
-        }
-        
-        return std::abs(value) >= Configuration::GetThumbstickThreshold();
-        
-    } catch (const std::exception& e) {
-        Logger.debug("Exception getting thumbstick value: {}", e.what());
-        value = 0.0f;
-        return false;
-    } catch (...) {
-        value = 0.0f;
-        return false;
+        state.lastChangeTime = Core::FrameClock::SteadyNow();
     }
 }
 
 UnityEngine::Vector2 InputManagerEnhanced::GetThumbstickVector2() const {
-    if (!const_cast<InputManagerEnhanced*>(this)->IsControllerDetected()) {
+    if (!IsControllerDetected()) {
         return UnityEngine::Vector2::get_zero();
     }
     
     try {
-        auto stick = OVRInput::Get(OVRInput::Axis2D::PrimaryThumbstick, ovrController);
+        const auto& sample = GetSample();
         
-        if (stick.get_magnitude() < config.thumbstickDeadzone) {
+        if (std::hypot(sample.stickX, sample.stickY) < config.thumbstickDeadzone) {
             return UnityEngine::Vector2::get_zero();
         }
         
-        return stick;
+        return UnityEngine::Vector2(sample.stickX, sample.stickY);
     } catch (const std::exception& e) {
         Logger.debug("Exception getting thumbstick vector: {}", e.what());
         return UnityEngine::Vector2::get_zero();
@@ -292,7 +209,7 @@ UnityEngine::Vector2 InputManagerEnhanced::GetThumbstickVector2() const {
 }
 
 bool InputManagerEnhanced::IsDebounceTimeElapsed(const EnhancedInputState& state) const {
-    auto now = std::chrono::steady_clock::now();
+    auto now = Core::FrameClock::SteadyNow();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - state.lastChangeTime);
     return elapsed.count() >= DEBOUNCE_TIME_MS;
 }
@@ -301,21 +218,18 @@ bool InputManagerEnhanced::IsControllerConnected() const {
     return wasConnected;
 }
 
+const Native::ControllerSample& InputManagerEnhanced::GetSample() const {
+    return Core::InputSnapshotService::Get(saberType == 0);
+}
+
 bool InputManagerEnhanced::IsControllerDetected() const {
-    if (OVRInput::IsControllerConnected(ovrController)) {
+    const auto& sample = GetSample();
+    if (sample.connected) {
         return true;
     }
     
-    if (controller && controller->get_enabled()) {
-        try {
-            float testValue = OVRInput::Get(OVRInput::Axis1D::PrimaryIndexTrigger, ovrController);
-            return std::isfinite(testValue);
-        } catch (...) {
-            // Controller not responding
-        }
-    }
-    
-    return false;
+    // Controller enabled and the runtime still reports input
+    return controller && controller->get_enabled() && std::isfinite(sample.trigger);
 }
 
 void InputManagerEnhanced::HandleControllerConnectionChange(bool connected) {
@@ -324,34 +238,27 @@ void InputManagerEnhanced::HandleControllerConnectionChange(bool connected) {
             saberType == 0 ? "left" : "right");
         
         // Reset enhanced input states
-        triggerState = {};
-        gripState = {};
-        thumbstickState = {};
-        
-        auto now = std::chrono::steady_clock::now();
-        triggerState.lastChangeTime = now;
-        gripState.lastChangeTime = now;
-        thumbstickState.lastChangeTime = now;
+        auto now = Core::FrameClock::SteadyNow();
+        for (auto& state : states) {
+            state = {};
+            state.lastChangeTime = now;
+        }
         
     } else if (!connected && wasConnected) {
         Logger.warn("Enhanced controller {} disconnected", 
             saberType == 0 ? "left" : "right");
         
         // End active tricks
-        if (triggerState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.triggerAction);
-        }
-        if (gripState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.gripAction);
-        }
-        if (thumbstickState.pressed && onTrickDeactivated) {
-            onTrickDeactivated(config.thumbstickAction);
-        }
+        Native::VisitChannels<Native::SmoothedInputChannels>([&]<Native::InputChannel Channel>() {
+            if (states[Channel.slot].pressed && onTrickDeactivated) {
+                onTrickDeactivated(config.*(Channel.action));
+            }
+        });
         
         // Reset states
-        triggerState.pressed = false;
-        gripState.pressed = false;
-        thumbstickState.pressed = false;
+        for (auto& state : states) {
+            state.pressed = false;
+        }
     }
 }
 
@@ -1,6 +1,9 @@
 #include "TrickSaber/MovementController.hpp"
+#include "TrickSaber/Config.hpp"
 #include "TrickSaber/Configuration.hpp"
 #include "TrickSaber/Utils/MemoryManager.hpp"
+#include "TrickSaber/Utils/NativeConversions.hpp"
+#include "TrickSaber/Native/TraceRecorder.hpp"
 #include "UnityEngine/Vector3.hpp"
 #include "UnityEngine/Quaternion.hpp"
 #include "UnityEngine/Mathf.hpp"
@@ -10,38 +13,43 @@
 
 using namespace TrickSaber;
 
-// Static variable definitions with velocity buffering
-std::vector<UnityEngine::Vector3> MovementController::leftVelocityBuffer;
-std::vector<UnityEngine::Vector3> MovementController::rightVelocityBuffer;
-std::vector<UnityEngine::Vector3> MovementController::leftAngularVelocityBuffer;
-std::vector<UnityEngine::Vector3> MovementController::rightAngularVelocityBuffer;
+// Static variable definitions
+Native::HandTracker MovementController::tracker;
 
 UnityEngine::Vector3 MovementController::leftControllerVelocity = UnityEngine::Vector3::get_zero();
 UnityEngine::Vector3 MovementController::rightControllerVelocity = UnityEngine::Vector3::get_zero();
 UnityEngine::Vector3 MovementController::leftAngularVelocity = UnityEngine::Vector3::get_zero();
 UnityEngine::Vector3 MovementController::rightAngularVelocity = UnityEngine::Vector3::get_zero();
 
-UnityEngine::Vector3 MovementController::prevLeftHandPos = UnityEngine::Vector3::get_zero();
-UnityEngine::Vector3 MovementController::prevRightHandPos = UnityEngine::Vector3::get_zero();
-UnityEngine::Quaternion MovementController::prevLeftHandRot = UnityEngine::Quaternion::get_identity();
-UnityEngine::Quaternion MovementController::prevRightHandRot = UnityEngine::Quaternion::get_identity();
-
-int MovementController::leftBufferIndex = 0;
-int MovementController::rightBufferIndex = 0;
 bool MovementController::initialized = false;
 
+Native::FlickDetector MovementController::flickDetectors[2];
+Native::FlickEvent MovementController::pendingFlicks[2];
+bool MovementController::hasPendingFlick[2] = {false, false};
+
 void MovementController::Initialize() {
     if (initialized) return;
     
     int bufferSize = Configuration::config.velocityBufferSize;
     
-    leftVelocityBuffer.resize(bufferSize, UnityEngine::Vector3::get_zero());
-    rightVelocityBuffer.resize(bufferSize, UnityEngine::Vector3::get_zero());
-    leftAngularVelocityBuffer.resize(bufferSize, UnityEngine::Vector3::get_zero());
-    rightAngularVelocityBuffer.resize(bufferSize, UnityEngine::Vector3::get_zero());
+    Native::VelocityFilterParams params;
+    params.boxcarWindow = bufferSize;
+    params.oneEuroMinCutoff = config.oneEuroMinCutoff;
+    params.oneEuroBeta = config.oneEuroBeta;
+    params.kalmanProcessNoise = config.kalmanProcessNoise;
+    params.kalmanMeasurementNoise = config.kalmanMeasurementNoise;
+    
+    tracker.Configure(config.velocityFilterMode, params);
+    
+    Native::FlickParams flickParams;
+    flickParams.minPeakSpeed = config.flickMinPeakSpeed;
+    flickParams.minPeakJerk = config.flickMinPeakJerk;
+    flickParams.cooldown = config.flickCooldown;
+    for (auto& detector : flickDetectors) detector.Configure(flickParams);
     
     initialized = true;
-    Logger.debug("MovementController initialized with buffer size: {}", bufferSize);
+    Logger.debug("MovementController initialized with buffer size: {}, filter mode: {}", 
+        bufferSize, static_cast<int>(config.velocityFilterMode));
 }
 
 void MovementController::UpdateVelocities(UnityEngine::Transform* leftHand, UnityEngine::Transform* rightHand, float deltaTime) {
@@ -49,102 +57,84 @@ void MovementController::UpdateVelocities(UnityEngine::Transform* leftHand, Unit
     
     if (deltaTime <= 0.0001f) deltaTime = 1.0f / 90.0f; // Fallback for invalid deltaTime
     
+    double timestamp = GetTimestamp();
+    
+    // Read the transforms once; missing hands keep their previous state
+    uint32_t handMask = 0;
+    Native::Vec3 positions[2] = {tracker.Position(Native::LeftHand), tracker.Position(Native::RightHand)};
+    Native::Quat rotations[2] = {tracker.Rotation(Native::LeftHand), tracker.Rotation(Native::RightHand)};
     if (leftHand) {
-        // Calculate linear velocity
-        auto currentPos = Utils::MemoryManager::GetCachedPosition(leftHand);
-        auto velocity = UnityEngine::Vector3::op_Division(
-            UnityEngine::Vector3::op_Subtraction(currentPos, prevLeftHandPos), deltaTime);
-        
-        // Calculate angular velocity
-        auto currentRot = Utils::MemoryManager::GetCachedRotation(leftHand);
-        auto angularVel = CalculateAngularVelocity(prevLeftHandRot, currentRot, deltaTime);
-        
-        // Add to circular buffers
-        AddVelocityProbe(velocity, angularVel, true);
-        
-        // Update cached values
-        leftControllerVelocity = GetAverageVelocity(true);
-        leftAngularVelocity = GetAverageAngularVelocity(true);
-        
-        prevLeftHandPos = currentPos;
-        prevLeftHandRot = currentRot;
+        handMask |= Native::HandTracker::LeftMask;
+        positions[Native::LeftHand] = Utils::ToNative(Utils::MemoryManager::GetCachedPosition(leftHand));
+        rotations[Native::LeftHand] = Utils::ToNative(Utils::MemoryManager::GetCachedRotation(leftHand));
     }
-    
     if (rightHand) {
-        // Calculate linear velocity
-        auto currentPos = Utils::MemoryManager::GetCachedPosition(rightHand);
-        auto velocity = UnityEngine::Vector3::op_Division(
-            UnityEngine::Vector3::op_Subtraction(currentPos, prevRightHandPos), deltaTime);
-        
-        // Calculate angular velocity
-        auto currentRot = Utils::MemoryManager::GetCachedRotation(rightHand);
-        auto angularVel = CalculateAngularVelocity(prevRightHandRot, currentRot, deltaTime);
-        
-        // Add to circular buffers
-        AddVelocityProbe(velocity, angularVel, false);
-        
-        // Update cached values
-        rightControllerVelocity = GetAverageVelocity(false);
-        rightAngularVelocity = GetAverageAngularVelocity(false);
-        
-        prevRightHandPos = currentPos;
-        prevRightHandRot = currentRot;
+        handMask |= Native::HandTracker::RightMask;
+        positions[Native::RightHand] = Utils::ToNative(Utils::MemoryManager::GetCachedPosition(rightHand));
+        rotations[Native::RightHand] = Utils::ToNative(Utils::MemoryManager::GetCachedRotation(rightHand));
     }
-}
-
-UnityEngine::Vector3 MovementController::CalculateAngularVelocity(UnityEngine::Quaternion prevRot, UnityEngine::Quaternion currentRot, float deltaTime) {
-    auto q = UnityEngine::Quaternion::op_Multiply(currentRot, UnityEngine::Quaternion::Inverse(prevRot));
     
-    if (std::abs(q.w) > 1023.5f / 1024.0f) {
-        return UnityEngine::Vector3::get_zero();
-    }
+    tracker.Update(timestamp, deltaTime, handMask, positions, rotations);
+    CacheVelocities();
     
-    float gain;
-    if (q.w < 0.0f) {
-        float angle = std::acos(-q.w);
-        gain = -2.0f * angle / (std::sin(angle) * deltaTime);
-    } else {
-        float angle = std::acos(q.w);
-        gain = 2.0f * angle / (std::sin(angle) * deltaTime);
+    if (config.enableFlickThrow) {
+        DetectFlicks(timestamp, handMask, positions);
     }
     
-    return UnityEngine::Vector3(q.x * gain, q.y * gain, q.z * gain);
+    auto& recorder = Native::TraceRecorder::GetInstance();
+    if (recorder.IsRecording()) {
+        recorder.RecordPose(timestamp, deltaTime, handMask, positions, rotations);
+    }
 }
 
-void MovementController::AddVelocityProbe(UnityEngine::Vector3 velocity, UnityEngine::Vector3 angularVelocity, bool isLeft) {
-    if (isLeft) {
-        if (leftBufferIndex >= leftVelocityBuffer.size()) leftBufferIndex = 0;
-        leftVelocityBuffer[leftBufferIndex] = velocity;
-        leftAngularVelocityBuffer[leftBufferIndex] = angularVelocity;
-        leftBufferIndex++;
-    } else {
-        if (rightBufferIndex >= rightVelocityBuffer.size()) rightBufferIndex = 0;
-        rightVelocityBuffer[rightBufferIndex] = velocity;
-        rightAngularVelocityBuffer[rightBufferIndex] = angularVelocity;
-        rightBufferIndex++;
-    }
+void MovementController::CacheVelocities() {
+    leftControllerVelocity = Utils::ToUnity(tracker.Velocity(Native::LeftHand));
+    rightControllerVelocity = Utils::ToUnity(tracker.Velocity(Native::RightHand));
+    leftAngularVelocity = Utils::ToUnity(tracker.AngularVelocity(Native::LeftHand));
+    rightAngularVelocity = Utils::ToUnity(tracker.AngularVelocity(Native::RightHand));
 }
 
-UnityEngine::Vector3 MovementController::GetAverageVelocity(bool isLeft) {
-    auto& buffer = isLeft ? leftVelocityBuffer : rightVelocityBuffer;
-    
-    UnityEngine::Vector3 avg = UnityEngine::Vector3::get_zero();
-    for (const auto& vel : buffer) {
-        avg = UnityEngine::Vector3::op_Addition(avg, vel);
+void MovementController::DetectFlicks(double timestamp, uint32_t handMask, const Native::Vec3 positions[2]) {
+    for (int hand = 0; hand < 2; ++hand) {
+        if (!(handMask & (1u << hand))) continue;
+        
+        Native::FlickEvent flick;
+        if (flickDetectors[hand].Update(timestamp, positions[hand], flick)) {
+            pendingFlicks[hand] = flick;
+            hasPendingFlick[hand] = true;
+        }
     }
+}
+
+bool MovementController::ConsumeFlick(bool isLeft, Native::FlickEvent& flick) {
+    int hand = isLeft ? Native::LeftHand : Native::RightHand;
+    if (!hasPendingFlick[hand]) return false;
     
-    return UnityEngine::Vector3::op_Division(avg, static_cast<float>(buffer.size()));
+    flick = pendingFlicks[hand];
+    hasPendingFlick[hand] = false;
+    return true;
+}
+
+UnityEngine::Vector3 MovementController::GetAverageVelocity(bool isLeft) {
+    return isLeft ? leftControllerVelocity : rightControllerVelocity;
 }
 
 UnityEngine::Vector3 MovementController::GetAverageAngularVelocity(bool isLeft) {
-    auto& buffer = isLeft ? leftAngularVelocityBuffer : rightAngularVelocityBuffer;
-    
-    UnityEngine::Vector3 avg = UnityEngine::Vector3::get_zero();
-    for (const auto& vel : buffer) {
-        avg = UnityEngine::Vector3::op_Addition(avg, vel);
-    }
+    return isLeft ? leftAngularVelocity : rightAngularVelocity;
+}
+
+double MovementController::GetTimestamp() {
+    return Native::MonotonicSeconds();
+}
+
+bool MovementController::VelocityAt(bool isLeft, double time, float windowMs,
+    UnityEngine::Vector3& velocity, UnityEngine::Vector3& angularVelocity) {
+    Native::Vec3 linear, angular;
+    if (!tracker.VelocityAt(isLeft ? Native::LeftHand : Native::RightHand, time, windowMs / 1000.0, linear, angular)) return false;
     
-    return UnityEngine::Vector3::op_Division(avg, static_cast<float>(buffer.size()));
+    velocity = Utils::ToUnity(linear);
+    angularVelocity = Utils::ToUnity(angular);
+    return true;
 }
 
 // Legacy compatibility methods
@@ -175,28 +165,17 @@ float MovementController::GetAngularVelocity(bool isRight) {
 }
 
 void MovementController::ClearBuffers() {
-    // Clear all velocity buffers
-    leftVelocityBuffer.clear();
-    rightVelocityBuffer.clear();
-    leftAngularVelocityBuffer.clear();
-    rightAngularVelocityBuffer.clear();
-    
-    // Reset current velocity values
-    leftControllerVelocity = UnityEngine::Vector3::get_zero();
-    rightControllerVelocity = UnityEngine::Vector3::get_zero();
-    leftAngularVelocity = UnityEngine::Vector3::get_zero();
-    rightAngularVelocity = UnityEngine::Vector3::get_zero();
-    
-    // Reset previous transform data
-    prevLeftHandPos = UnityEngine::Vector3::get_zero();
-    prevRightHandPos = UnityEngine::Vector3::get_zero();
-    prevLeftHandRot = UnityEngine::Quaternion::get_identity();
-    prevRightHandRot = UnityEngine::Quaternion::get_identity();
-    
-    // Reset buffer indices and initialization flag
-    leftBufferIndex = 0;
-    rightBufferIndex = 0;
+    // Clear velocity smoothing, pose history and previous poses
+    tracker.Reset();
+    CacheVelocities();
+    
+    for (int hand = 0; hand < 2; ++hand) {
+        flickDetectors[hand].Reset();
+        hasPendingFlick[hand] = false;
+    }
+    
+    // Reset initialization flag so the window size is re-read from config
     initialized = false;
     
     Logger.debug("MovementController buffers cleared");
-}
\ No newline at end of file
+}
@@ -0,0 +1,110 @@
+#include "TrickSaber/Native/ChordMatcher.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace TrickSaber::Native {
+    void ChordMatcher::SetBindings(const ChordBinding* source, int count) {
+        bindingCount = 0;
+        for (int i = 0; i < count && bindingCount < MaxBindings; ++i) {
+            // A chord needs at least two inputs; single inputs go through the channels
+            if (source[i].action == TrickAction::None || std::popcount(source[i].mask) < 2) continue;
+            bindings[bindingCount++] = source[i];
+        }
+
+        // Most specific binding contained in each mask; earlier bindings win ties
+        for (uint32_t mask = 0; mask <= FullMask; ++mask) {
+            int best = -1;
+            int bestBits = 0;
+            for (int i = 0; i < bindingCount; ++i) {
+                if ((bindings[i].mask & ~mask) != 0) continue;
+                int bits = std::popcount(bindings[i].mask);
+                if (bits > bestBits) {
+                    best = i;
+                    bestBits = bits;
+                }
+            }
+            table[mask] = static_cast<uint8_t>(best + 1);
+        }
+
+        active = -1;
+    }
+
+    void ChordMatcher::Reset() {
+        held = 0;
+        active = -1;
+        std::fill(std::begin(pressTimes), std::end(pressTimes), 0.0);
+    }
+
+    bool ChordMatcher::WithinWindow(const ChordBinding& binding) const {
+        double first = 0.0;
+        double last = 0.0;
+        bool any = false;
+        for (ChordMask bits = binding.mask; bits != 0; bits &= bits - 1) {
+            double time = pressTimes[std::countr_zero(bits)];
+            first = any ? std::min(first, time) : time;
+            last = any ? std::max(last, time) : time;
+            any = true;
+        }
+        return last - first <= binding.window;
+    }
+
+    ChordTransition ChordMatcher::Update(ChordMask pressed, double time, ChordBinding& binding) {
+        pressed &= FullMask;
+        ChordMask rising = pressed & ~held;
+        for (ChordMask bits = rising; bits != 0; bits &= bits - 1) {
+            pressTimes[std::countr_zero(bits)] = time;
+        }
+        held = pressed;
+
+        if (active >= 0) {
+            if ((pressed & bindings[active].mask) == bindings[active].mask) return ChordTransition::None;
+            binding = bindings[active];
+            active = -1;
+            return ChordTransition::Ended;
+        }
+
+        // Releasing part of a larger chord must not start a smaller one
+        if (rising == 0) return ChordTransition::None;
+
+        uint8_t entry = table[pressed];
+        if (entry == 0 || !WithinWindow(bindings[entry - 1])) return ChordTransition::None;
+
+        active = entry - 1;
+        binding = bindings[active];
+        return ChordTransition::Started;
+    }
+
+    int BuildConfigChords(const Config& config, ChordBinding* out, int capacity) {
+        struct Pair {
+            InputSlot first;
+            InputSlot second;
+        };
+        static constexpr Pair pairs[] = {
+            {TriggerSlot, GripSlot},
+            {TriggerSlot, ThumbstickSlot},
+            {GripSlot, ThumbstickSlot},
+            {TriggerSlot, ButtonOneSlot},
+            {GripSlot, ButtonOneSlot}
+        };
+
+        auto actionFor = [&config](InputSlot slot) {
+            for (const auto& channel : DirectInputChannels) {
+                if (channel.slot == slot) return config.*(channel.action);
+            }
+            return TrickAction::None;
+        };
+
+        int count = 0;
+        for (int hand = LeftHand; hand <= RightHand; ++hand) {
+            for (const auto& pair : pairs) {
+                TrickAction first = actionFor(pair.first);
+                TrickAction second = actionFor(pair.second);
+                if (first == TrickAction::None || second == TrickAction::None || first == second) continue;
+                if (count == capacity) return count;
+                out[count++] = {static_cast<ChordMask>(ChordBit(hand, pair.first) | ChordBit(hand, pair.second)), first};
+            }
+        }
+        return count;
+    }
+}
@@ -0,0 +1,52 @@
+#include "TrickSaber/Native/FlickDetector.hpp"
+
+namespace TrickSaber::Native {
+    void FlickDetector::Reset() {
+        samples = 0;
+        lastTime = 0.0;
+        lastPosition = Zero3();
+        velocity = Zero3();
+        speed = 0.0f;
+        acceleration = 0.0f;
+        cooldownUntil = 0.0;
+    }
+
+    bool FlickDetector::Update(double time, const Vec3& position, FlickEvent& event) {
+        if (samples > 0 && time <= lastTime) return false;
+
+        if (samples == 0) {
+            lastTime = time;
+            lastPosition = position;
+            samples = 1;
+            return false;
+        }
+
+        float dt = static_cast<float>(time - lastTime);
+        Vec3 rawVelocity = (position - lastPosition) * (1.0f / dt);
+        Vec3 previousVelocity = velocity;
+        float previousSpeed = speed;
+        float previousAcceleration = acceleration;
+
+        velocity = samples == 1 ? rawVelocity : previousVelocity + (rawVelocity - previousVelocity) * params.smoothing;
+        speed = Magnitude(velocity);
+        acceleration = samples >= 2 ? (speed - previousSpeed) / dt : 0.0f;
+        float jerk = (acceleration - previousAcceleration) / dt;
+
+        // Rising into the previous sample and falling out of it
+        bool fired = samples >= 3 &&
+            time >= cooldownUntil &&
+            previousAcceleration > 0.0f && acceleration <= 0.0f &&
+            previousSpeed >= params.minPeakSpeed &&
+            -jerk >= params.minPeakJerk;
+
+        if (fired) {
+            event = FlickEvent{lastTime, previousVelocity, previousSpeed};
+            cooldownUntil = time + params.cooldown;
+        }
+
+        lastTime = time;
+        lastPosition = position;
+        if (samples < 3) samples++;
+        return fired;
+    }
+}
@@ -0,0 +1,43 @@
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/AngularVelocityKernel.hpp"
+
+namespace TrickSaber::Native {
+    void HandTracker::Configure(VelocityFilterMode mode, const VelocityFilterParams& params) {
+        for (auto& estimator : estimators) estimator.Configure(mode, params);
+    }
+
+    void HandTracker::Reset() {
+        for (int hand = 0; hand < 2; ++hand) {
+            estimators[hand].Active().Reset();
+            history[hand].Clear();
+            position[hand] = Zero3();
+            rotation[hand] = IdentityQuat();
+            velocity[hand] = Zero3();
+            angularVelocity[hand] = Zero3();
+        }
+    }
+
+    void HandTracker::Update(double time, float deltaTime, uint32_t handMask, const Vec3 positions[2], const Quat rotations[2]) {
+        // Absent hands compare against themselves, so the kernel yields zero for them
+        Quat current[2];
+        for (int hand = 0; hand < 2; ++hand) {
+            current[hand] = (handMask & (1u << hand)) ? rotations[hand] : rotation[hand];
+        }
+        Vec3 angular[2];
+        AngularVelocity2(rotation, current, 1.0f / deltaTime, angular);
+
+        for (int hand = 0; hand < 2; ++hand) {
+            if (!(handMask & (1u << hand))) continue;
+
+            Vec3 linear = (positions[hand] - position[hand]) / deltaTime;
+            auto& estimator = estimators[hand].Active();
+            estimator.Push(linear, angular[hand], deltaTime);
+            history[hand].Push(time, positions[hand], current[hand]);
+
+            velocity[hand] = estimator.Linear();
+            angularVelocity[hand] = estimator.Angular();
+            position[hand] = positions[hand];
+            rotation[hand] = current[hand];
+        }
+    }
+}
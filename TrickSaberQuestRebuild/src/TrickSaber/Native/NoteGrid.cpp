@@ -0,0 +1,199 @@
+#include "TrickSaber/Native/NoteGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace TrickSaber::Native {
+    namespace {
+        constexpr uint16_t FreeCell = 0xFFFF;
+        constexpr float MIN_SPEED = 0.1f;          // m/s, keeps the time range finite
+        constexpr float UNROTATED_W = 1.0f - 1e-6f;
+
+        Vec3 ClosestOnSegment(const Vec3& p, const Vec3& a, const Vec3& b) {
+            Vec3 ab = b - a;
+            float length = Dot(ab, ab);
+            if (length <= 1e-12f) return a;
+            float t = std::clamp(Dot(p - a, ab) / length, 0.0f, 1.0f);
+            return a + ab * t;
+        }
+
+        // Real-Time Collision Detection 5.1.5, with degenerate (zero area)
+        // triangles falling back to their edges
+        Vec3 ClosestOnTriangle(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c) {
+            Vec3 ab = b - a, ac = c - a, ap = p - a;
+            float d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+            if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+            Vec3 bp = p - b;
+            float d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+            if (d3 >= 0.0f && d4 <= d3) return b;
+
+            float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+
+            Vec3 cp = p - c;
+            float d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+            if (d6 >= 0.0f && d5 <= d6) return c;
+
+            float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+
+            float va = d3 * d6 - d5 * d4;
+            if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+                return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+            }
+
+            float area = va + vb + vc;
+            if (area <= 1e-12f) {
+                Vec3 best = ClosestOnSegment(p, a, b);
+                for (Vec3 q : {ClosestOnSegment(p, b, c), ClosestOnSegment(p, c, a)}) {
+                    if (SqrMagnitude(q - p) < SqrMagnitude(best - p)) best = q;
+                }
+                return best;
+            }
+            return a + ab * (vb / area) + ac * (vc / area);
+        }
+    }
+
+    bool SweptBladeHits(const SweptBlade& blade, const Vec3& center, float radius, Vec3& point) {
+        Vec3 first = ClosestOnTriangle(center, blade.base0, blade.tip0, blade.tip1);
+        Vec3 second = ClosestOnTriangle(center, blade.base0, blade.tip1, blade.base1);
+        point = SqrMagnitude(first - center) <= SqrMagnitude(second - center) ? first : second;
+        return SqrMagnitude(point - center) <= radius * radius;
+    }
+
+    NoteGrid::NoteGrid(const Layout& layout) : layout(layout) {
+        Clear();
+    }
+
+    void NoteGrid::Clear() {
+        heads.fill(None);
+        index.fill(None);
+        for (int i = 0; i < Capacity; ++i) {
+            links[i] = {None, static_cast<Handle>(i + 1 < Capacity ? i + 1 : None), FreeCell};
+        }
+        freeList = 0;
+        count = 0;
+        minSpeed = std::numeric_limits<float>::max();
+        maxSpeed = 0.0f;
+        maxVerticalSpeed = 0.0f;
+        maxGravity = 0.0f;
+        rotated = false;
+        candidates = 0;
+    }
+
+    int NoteGrid::ClampX(float x) const {
+        return std::clamp(static_cast<int>(std::floor((x - layout.minX) / layout.cellSize)), 0, XCells - 1);
+    }
+
+    int NoteGrid::ClampY(float y) const {
+        return std::clamp(static_cast<int>(std::floor((y - layout.minY) / layout.cellSize)), 0, YCells - 1);
+    }
+
+    int NoteGrid::TimeIndex(float time) const {
+        return static_cast<int>(std::floor(time / layout.timeCell));
+    }
+
+    NoteGrid::Handle NoteGrid::Insert(const Note& note) {
+        if (freeList == None) return None;
+
+        Handle handle = freeList;
+        freeList = links[handle].next;
+
+        Note& stored = notes[handle];
+        stored = note;
+        stored.speed = std::max(note.speed, MIN_SPEED);
+        minSpeed = std::min(minSpeed, stored.speed);
+        maxSpeed = std::max(maxSpeed, stored.speed);
+        maxVerticalSpeed = std::max(maxVerticalSpeed, std::abs(note.verticalVelocity));
+        maxGravity = std::max(maxGravity, std::abs(note.gravity));
+        rotated = rotated || std::abs(note.rotation.w) < UNROTATED_W;
+
+        int ring = ((TimeIndex(note.arrival) % TimeCells) + TimeCells) % TimeCells;
+        auto cell = static_cast<uint16_t>(Cell(ClampX(note.x), ClampY(note.y), ring));
+        links[handle] = {None, heads[cell], cell};
+        if (heads[cell] != None) links[heads[cell]].prev = handle;
+        heads[cell] = handle;
+
+        int slot = Home(note.key);
+        while (index[slot] != None) slot = (slot + 1) & (IndexSize - 1);
+        index[slot] = handle;
+
+        count++;
+        return handle;
+    }
+
+    NoteGrid::Handle NoteGrid::Find(uint64_t key) const {
+        for (int slot = Home(key); index[slot] != None; slot = (slot + 1) & (IndexSize - 1)) {
+            if (notes[index[slot]].key == key) return index[slot];
+        }
+        return None;
+    }
+
+    bool NoteGrid::Remove(Handle handle, uint64_t key) {
+        if (handle >= Capacity || links[handle].cell == FreeCell || notes[handle].key != key) return false;
+
+        Link& link = links[handle];
+        if (link.prev != None) links[link.prev].next = link.next; else heads[link.cell] = link.next;
+        if (link.next != None) links[link.next].prev = link.prev;
+
+        // Linear probing with backward shift, so the index never fills with
+        // tombstones: later entries of the run move up into the hole
+        int hole = Home(key);
+        while (index[hole] != handle) hole = (hole + 1) & (IndexSize - 1);
+        for (int slot = (hole + 1) & (IndexSize - 1); index[slot] != None; slot = (slot + 1) & (IndexSize - 1)) {
+            int home = Home(notes[index[slot]].key);
+            if (((slot - home) & (IndexSize - 1)) >= ((slot - hole) & (IndexSize - 1))) {
+                index[hole] = index[slot];
+                hole = slot;
+            }
+        }
+        index[hole] = None;
+
+        link = {None, freeList, FreeCell};
+        freeList = handle;
+        count--;
+        return true;
+    }
+
+    bool NoteGrid::Bounds(const SweptBlade& blade, float songTime, float deltaTime, Range& range) const {
+        Vec3 low = blade.base0, high = blade.base0;
+        for (const Vec3& p : {blade.tip0, blade.base1, blade.tip1}) {
+            low = {std::min(low.x, p.x), std::min(low.y, p.y), std::min(low.z, p.z)};
+            high = {std::max(high.x, p.x), std::max(high.y, p.y), std::max(high.z, p.z)};
+        }
+        float r = layout.radius;
+        if (rotated) {
+            // A note's move frame is turned about +y through the origin, so
+            // in any of them the blade's x and z are within its horizontal reach
+            float reach = 0.0f;
+            for (const Vec3& p : {blade.base0, blade.tip0, blade.base1, blade.tip1}) {
+                reach = std::max(reach, std::sqrt(p.x * p.x + p.z * p.z));
+            }
+            low.x = low.z = -reach;
+            high.x = high.z = reach;
+        }
+        range.x0 = ClampX(low.x - r);
+        range.x1 = ClampX(high.x + r);
+
+        // A note is in [low.z, high.z] at some time t in the frame when its
+        // arrival is t + (z - cutPlaneZ) / speed, over every speed in the grid
+        float near = low.z - r - layout.cutPlaneZ;
+        float far = high.z + r - layout.cutPlaneZ;
+        if (maxSpeed <= 0.0f) return false;
+        float startTime = songTime - std::max(deltaTime, 0.0f);
+        float earliest = startTime + near / (near >= 0.0f ? maxSpeed : minSpeed);
+        float latest = songTime + far / (far >= 0.0f ? minSpeed : maxSpeed);
+        range.t0 = TimeIndex(earliest);
+        range.t1 = std::min(TimeIndex(latest), range.t0 + TimeCells - 1);
+
+        // Notes are bucketed by their height at arrival; over the frame they
+        // are at most this far from it, for any arrival in the time range
+        float s = std::max(songTime - range.t0 * layout.timeCell, (range.t1 + 1) * layout.timeCell - startTime);
+        float drift = (maxVerticalSpeed + 0.5f * maxGravity * s) * s;
+        range.y0 = ClampY(low.y - r - drift);
+        range.y1 = ClampY(high.y + r + drift);
+        return true;
+    }
+}
@@ -0,0 +1,82 @@
+#include "TrickSaber/Native/ReturnSpring.hpp"
+#include "TrickSaber/Constants.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace TrickSaber::Native {
+    namespace {
+        constexpr int RATE_ITERATIONS = 8;
+    }
+
+    float CriticalSpringRate(float ratio, float duration) {
+        if (duration <= 0.0f || ratio >= 1.0f) return 0.0f;
+
+        // With x = w t: x - ln(1 + x) = -ln(ratio). The left side is convex
+        // and increasing, so Newton from above converges without overshoot.
+        float target = -std::log(std::max(ratio, 1e-9f));
+        float x = target + std::log1p(target) + 1.0f;
+        for (int i = 0; i < RATE_ITERATIONS; ++i) {
+            x -= (x - std::log1p(x) - target) * (1.0f + x) / x;
+        }
+        return x / duration;
+    }
+
+    void ReturnSpring::Begin(const Vec3& startPosition, const Quat& startRotation, const Vec3& targetPosition, const Quat& targetRotation,
+        float duration, float maxReturnTime, Tolerance tolerance, const Vec3& startAngularVelocity) {
+        position = startPosition;
+        rotation = startRotation;
+        velocity = Zero3();
+        angularVelocity = startAngularVelocity;
+        elapsed = 0.0f;
+        maxTime = maxReturnTime;
+        distanceSq = tolerance.distance * tolerance.distance;
+        angle = tolerance.angle * Constants::DEG_TO_RAD;
+
+        // The larger of the two errors, relative to its tolerance, sets the rate
+        float distance = Distance(startPosition, targetPosition);
+        float turn = Magnitude(RotationError(startRotation, targetRotation));
+        float ratio = 1.0f;
+        if (distance > tolerance.distance) ratio = std::min(ratio, tolerance.distance / distance);
+        if (turn > angle) ratio = std::min(ratio, angle / turn);
+
+        rate = CriticalSpringRate(ratio, duration);
+        arrived = rate <= 0.0f;    // already there, or no time to get there
+        if (arrived) {
+            position = targetPosition;
+            rotation = targetRotation;
+        }
+    }
+
+    bool ReturnSpring::Step(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation) {
+        if (!arrived) {
+            elapsed += deltaTime;
+
+            // e(t) = (e0 + (v0 + w e0) t) e^-wt, v(t) = (v0 - w (v0 + w e0) t) e^-wt
+            float decay = std::exp(-rate * deltaTime);
+            float pull = rate * deltaTime;
+
+            Vec3 error = position - targetPosition;
+            Vec3 impulse = velocity + error * rate;
+            error = (error + impulse * deltaTime) * decay;
+            velocity = (velocity - impulse * pull) * decay;
+
+            Vec3 turn = RotationError(rotation, targetRotation);
+            Vec3 angularImpulse = angularVelocity + turn * rate;
+            turn = (turn + angularImpulse * deltaTime) * decay;
+            angularVelocity = (angularVelocity - angularImpulse * pull) * decay;
+
+            position = targetPosition + error;
+            rotation = targetRotation * ExpMap(turn);
+
+            arrived = (SqrMagnitude(error) <= distanceSq && SqrMagnitude(turn) <= angle * angle) || elapsed >= maxTime;
+            if (!arrived) return false;
+        }
+
+        position = targetPosition;
+        rotation = targetRotation;
+        velocity = Zero3();
+        angularVelocity = Zero3();
+        return true;
+    }
+}
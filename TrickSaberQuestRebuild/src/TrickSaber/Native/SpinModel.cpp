@@ -0,0 +1,132 @@
+#include "TrickSaber/Native/SpinModel.hpp"
+#include "TrickSaber/Constants.hpp"
+
+namespace TrickSaber::Native {
+    namespace {
+        constexpr Vec3 SaberForward{0.0f, 0.0f, 1.0f};
+        constexpr float SPIN_ACCELERATION = 300.0f;       // deg/s^2 towards target and to rest
+        constexpr float MIN_VELOCITY_SPIN_SPEED = 5.0f;   // deg/s floor against jitter
+        constexpr float FIXED_SPIN_SPEED = 60.0f;         // deg/s at full input, spinSpeed 1
+        constexpr float MIN_COMPLETION_SPEED = 30.0f;     // deg/s
+        constexpr float GRADUAL_STOP_SPEED = 60.0f;       // wind down above this on release
+        constexpr float ALIGNED_ANGLE = 5.0f;             // degrees
+        constexpr float RETURN_LERP_RATE = 20.0f;
+    }
+
+    float ComputeSpinTargetSpeed(const SpinParams& params, float input, const Vec3& angularVelocity) {
+        if (params.velocityDependent) {
+            float speed;
+            if (params.mode == SpinMode::OmniDirectional) {
+                speed = std::sqrt(angularVelocity.x * angularVelocity.x + angularVelocity.y * angularVelocity.y);
+                if (input < 0.0f) speed = -speed;
+            } else {
+                speed = params.direction == SpinDir::Forward ? angularVelocity.x : -angularVelocity.x;
+            }
+
+            float velocityScale = params.spinSpeed * std::fabs(input);
+            float finalSpeed = speed * velocityScale * Constants::RADIANS_TO_DEGREES;
+            if (std::fabs(finalSpeed) < MIN_VELOCITY_SPIN_SPEED && std::fabs(input) > 0.1f) {
+                finalSpeed = (finalSpeed < 0.0f ? -MIN_VELOCITY_SPIN_SPEED : MIN_VELOCITY_SPIN_SPEED) * velocityScale;
+            }
+            return finalSpeed;
+        }
+
+        // Fixed speed with squared input for finer control near the deadzone
+        float baseSpeed = FIXED_SPIN_SPEED * params.spinSpeed;
+        if (params.direction == SpinDir::Backward) baseSpeed = -baseSpeed;
+        float inputScale = input * input;
+        if (input < 0.0f) inputScale = -inputScale;
+        return baseSpeed * inputScale;
+    }
+
+    const SpinModel::Machine::Handlers SpinModel::Steps{
+        &SpinModel::StepIdle, &SpinModel::StepSpinning, &SpinModel::StepStopping,
+        &SpinModel::StepCompleting, &SpinModel::StepIdle};
+
+    void SpinModel::Start(const SpinParams& spinParams, const Quat& localRotation, float value, const Vec3& angularVelocity) {
+        params = spinParams;
+        rotation = localRotation;
+        originalRotation = localRotation;
+        input = value;
+        currentSpeed = 0.0f;
+        largestSpeed = 0.0f;
+        targetSpeed = ComputeSpinTargetSpeed(params, value, angularVelocity);
+        machine.Reset();
+        machine.Go<SpinPhase::Idle, SpinPhase::Spinning>();
+    }
+
+    bool SpinModel::Release() {
+        if (machine.Get() == SpinPhase::Spinning) {
+            if (params.completeRotation) {
+                if (std::fabs(largestSpeed) < MIN_COMPLETION_SPEED) {
+                    largestSpeed = largestSpeed < 0.0f ? -MIN_COMPLETION_SPEED : MIN_COMPLETION_SPEED;
+                }
+                currentSpeed = largestSpeed;
+                machine.Go<SpinPhase::Spinning, SpinPhase::Completing>();
+                return false;
+            }
+            if (std::fabs(currentSpeed) > GRADUAL_STOP_SPEED) {
+                targetSpeed = 0.0f;
+                machine.Go<SpinPhase::Spinning, SpinPhase::Stopping>();
+                return false;
+            }
+        }
+        Finish();
+        return true;
+    }
+
+    void SpinModel::Finish() {
+        rotation = originalRotation;
+        currentSpeed = 0.0f;
+        targetSpeed = 0.0f;
+        // Idle and Done have nothing to finish and stay put
+        machine.TryGo(SpinPhase::Done);
+    }
+
+    SpinPhase SpinModel::Step(float deltaTime, const Vec3& angularVelocity) {
+        (this->*machine.Handler())(deltaTime, angularVelocity);
+        return machine.Get();
+    }
+
+    void SpinModel::StepSpinning(float deltaTime, const Vec3& angularVelocity) {
+        targetSpeed = ComputeSpinTargetSpeed(params, input, angularVelocity);
+        currentSpeed = MoveTowards(currentSpeed, targetSpeed, SPIN_ACCELERATION * deltaTime);
+        if (std::fabs(currentSpeed) > std::fabs(largestSpeed)) largestSpeed = currentSpeed;
+        ApplyRotation(deltaTime);
+    }
+
+    void SpinModel::StepStopping(float deltaTime, const Vec3& angularVelocity) {
+        if (std::fabs(currentSpeed) > 0.1f) {
+            currentSpeed = MoveTowards(currentSpeed, 0.0f, SPIN_ACCELERATION * deltaTime);
+            ApplyRotation(deltaTime);
+        } else {
+            ReturnToOriginal(deltaTime);
+        }
+    }
+
+    void SpinModel::StepCompleting(float deltaTime, const Vec3& angularVelocity) {
+        if (AngleDegrees(rotation, originalRotation) > ALIGNED_ANGLE) {
+            currentSpeed = largestSpeed;
+            ApplyRotation(deltaTime);
+        } else {
+            rotation = originalRotation;
+            machine.Go<SpinPhase::Completing, SpinPhase::Done>();
+        }
+    }
+
+    void SpinModel::ApplyRotation(float deltaTime) {
+        // Matches the previous SpinTrick: only positive speeds turn the saber
+        if (currentSpeed < 0.1f) return;
+        rotation = rotation * AxisAngle(SaberForward, currentSpeed * deltaTime * Constants::DEG_TO_RAD);
+    }
+
+    void SpinModel::ReturnToOriginal(float deltaTime) {
+        // Only reached from Stopping
+        if (AngleDegrees(rotation, originalRotation) > ALIGNED_ANGLE) {
+            rotation = Nlerp(rotation, originalRotation, deltaTime * RETURN_LERP_RATE);
+        } else {
+            rotation = originalRotation;
+            machine.Go<SpinPhase::Stopping, SpinPhase::Done>();
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#include "TrickSaber/Native/ThrowModel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace TrickSaber::Native {
+    namespace {
+        constexpr Vec3 SaberRight{1.0f, 0.0f, 0.0f};
+        constexpr float MIN_RATE = 1e-6f;          // below this a rate is treated as zero
+        constexpr float DISTANCE_SCAN_STEP = 1.0f / 60.0f;
+        constexpr int DISTANCE_BISECTIONS = 24;
+
+        // Integral of e^(-rate * s) over [0, t]: (1 - e^(-rate t)) / rate
+        float DecayIntegral(float rate, float t) {
+            if (rate < MIN_RATE) return t;
+            return -std::expm1(-rate * t) / rate;
+        }
+    }
+
+    float BallisticFlight::RateFromRetention(float retention) {
+        if (retention >= 1.0f) return 0.0f;
+        return -std::log(std::max(retention, 1e-3f));
+    }
+
+    Vec3 BallisticFlight::PositionAt(float t) const {
+        // p = p0 + g t / k + (v0 - g / k)(1 - e^-kt) / k, or p0 + v0 t + g t^2 / 2 without drag
+        float decay = DecayIntegral(drag, t);
+        if (drag < MIN_RATE) return origin + velocity * t + gravity * (0.5f * t * t);
+        return origin + velocity * decay + gravity * ((t - decay) / drag);
+    }
+
+    Vec3 BallisticFlight::VelocityAt(float t) const {
+        if (drag < MIN_RATE) return velocity + gravity * t;
+        float keep = std::exp(-drag * t);
+        return velocity * keep + gravity * (-std::expm1(-drag * t) / drag);
+    }
+
+    float BallisticFlight::SpinAngleAt(float t) const {
+        return spin * DecayIntegral(spinDamping, t);
+    }
+
+    Quat BallisticFlight::RotationAt(float t) const {
+        float angle = SpinAngleAt(t);
+        if (angle == 0.0f) return orientation;
+        Quat turn = AxisAngle(SaberRight, angle * Constants::DEG_TO_RAD);
+        return worldSpin ? turn * orientation : orientation * turn;
+    }
+
+    float BallisticFlight::TimeToDistance(float distance, float maxTime) const {
+        constexpr float never = std::numeric_limits<float>::infinity();
+        if (distance <= 0.0f) return 0.0f;
+
+        if (SqrMagnitude(gravity) == 0.0f) {
+            // Straight line: |v0| (1 - e^-kt) / k = d
+            float speed = Magnitude(velocity);
+            if (speed <= 0.0f) return never;
+            float t;
+            if (drag < MIN_RATE) {
+                t = distance / speed;
+            } else {
+                float reach = distance * drag / speed;
+                if (reach >= 1.0f) return never;    // drag stops it short
+                t = -std::log1p(-reach) / drag;
+            }
+            return t <= maxTime ? t : never;
+        }
+
+        // Curved path: find the first scan step past the distance, then bisect
+        float squared = distance * distance;
+        float low = 0.0f;
+        for (float high = DISTANCE_SCAN_STEP; low < maxTime; low = high, high += DISTANCE_SCAN_STEP) {
+            high = std::min(high, maxTime);
+            if (SqrMagnitude(PositionAt(high) - origin) < squared) continue;
+            for (int i = 0; i < DISTANCE_BISECTIONS; ++i) {
+                float mid = 0.5f * (low + high);
+                if (SqrMagnitude(PositionAt(mid) - origin) < squared) low = mid; else high = mid;
+            }
+            return high;
+        }
+        return never;
+    }
+
+    ThrowLaunch ComputeThrowLaunch(const ThrowParams& params, const Vec3& controllerVelocity,
+        const Vec3& controllerAngularVelocity, const Vec3& saberForward) {
+        ThrowLaunch launch;
+
+        if (params.velocityDependent) {
+            // Actual controller movement, with a floor along the saber's forward
+            launch.velocity = controllerVelocity * (params.throwVelocity * 2.0f);
+            if (Magnitude(launch.velocity) < params.velocityThreshold) {
+                launch.velocity = saberForward * (params.velocityThreshold * params.throwVelocity);
+            }
+            launch.spinSpeed = Magnitude(controllerAngularVelocity) * Constants::RADIANS_TO_DEGREES;
+        } else {
+            // Controller direction at a fixed configured speed
+            Vec3 direction = Normalized(controllerVelocity);
+            if (Magnitude(direction) < 0.1f) direction = saberForward;
+            launch.velocity = direction * (params.throwVelocity * params.throwVelocityMultiplier);
+            launch.spinSpeed = params.throwVelocity * Constants::SPIN_VELOCITY_SCALE;
+        }
+
+        if (controllerAngularVelocity.x < 0.0f) launch.spinSpeed = -launch.spinSpeed;
+        return launch;
+    }
+
+    const ThrowModel::Machine::Handlers ThrowModel::Steps{
+        &ThrowModel::StepIdle, &ThrowModel::StepThrown, &ThrowModel::StepReturning, &ThrowModel::StepIdle};
+
+    void ThrowModel::Launch(const ThrowParams& throwParams, const Vec3& startPosition, const Quat& startRotation, const ThrowLaunch& throwLaunch) {
+        params = throwParams;
+        launch = throwLaunch;
+        position = startPosition;
+        rotation = startRotation;
+        previousPosition = startPosition;
+        previousRotation = startRotation;
+        velocity = throwLaunch.velocity;
+        clock.Reset();
+        returnStarted = false;
+        flightSteps = 0;
+
+        // Simplified flight falls under gravity and spins about world right;
+        // the standard one flies straight and spins about its own right axis
+        flight.origin = startPosition;
+        flight.orientation = startRotation;
+        flight.velocity = throwLaunch.velocity;
+        flight.gravity = params.simplified ?
+            Vec3{0.0f, -Constants::GRAVITY_ACCELERATION * params.gravityScale, 0.0f} : Zero3();
+        flight.drag = BallisticFlight::RateFromRetention(params.airResistance);
+        flight.spin = throwLaunch.spinSpeed;
+        flight.spinDamping = BallisticFlight::RateFromRetention(params.angularDamping);
+        flight.worldSpin = params.simplified;
+
+        float snapDistance = params.snapBackDistance > 0.0f ? params.snapBackDistance : Constants::DEFAULT_SNAP_BACK_DISTANCE;
+        if (params.maxThrowDistance > 0.0f) snapDistance = std::min(snapDistance, params.maxThrowDistance);
+        snapTime = flight.TimeToDistance(snapDistance, Constants::THROW_MAX_FLIGHT_TIME);
+
+        machine.Reset();
+        machine.Go<ThrowPhase::Idle, ThrowPhase::Thrown>();
+    }
+
+    void ThrowModel::BeginReturn() {
+        if (machine.Get() != ThrowPhase::Thrown) return;
+        returnStarted = false;
+        returnDuration = params.simplified ? Constants::SIMPLIFIED_RETURN_DURATION : params.returnDuration;
+
+        returnSpinSpeed = 0.0f;
+        if (params.returnSpinMultiplier > 0.0f) {
+            float scale = params.simplified ? Constants::SIMPLIFIED_RETURN_SPIN_SCALE : Constants::RETURN_SPIN_SCALE;
+            returnSpinSpeed = Magnitude(launch.velocity) * params.returnSpinMultiplier * scale;
+        }
+
+        machine.Go<ThrowPhase::Thrown, ThrowPhase::Returning>();
+    }
+
+    ThrowPhase ThrowModel::Step(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation) {
+        auto phase = machine.Get();
+        if (phase == ThrowPhase::Idle || phase == ThrowPhase::Done) return phase;
+
+        int substeps = clock.Advance(deltaTime);
+        float step = clock.Step();
+        for (int i = 0; i < substeps; ++i) {
+            previousPosition = position;
+            previousRotation = rotation;
+            (this->*machine.Handler())(step, targetPosition, targetRotation);
+
+            if (machine.Get() == ThrowPhase::Done) {
+                // Landed: render the final pose, not a blend towards it
+                previousPosition = position;
+                previousRotation = rotation;
+                break;
+            }
+        }
+        return machine.Get();
+    }
+
+    void ThrowModel::StepThrown(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation) {
+        // Evaluated at the substep time, not integrated
+        float t = static_cast<float>(++flightSteps) * deltaTime;
+        position = flight.PositionAt(t);
+        rotation = flight.RotationAt(t);
+        velocity = flight.VelocityAt(t);
+
+        if (t >= snapTime) BeginReturn();
+    }
+
+    Vec3 ThrowModel::RenderPosition() const {
+        float alpha = clock.Alpha();
+        if (machine.Get() == ThrowPhase::Thrown) {
+            return flight.PositionAt(std::max(FlightTime() - (1.0f - alpha) * clock.Step(), 0.0f));
+        }
+        return Lerp(previousPosition, position, alpha);
+    }
+
+    Quat ThrowModel::RenderRotation() const {
+        float alpha = clock.Alpha();
+        if (machine.Get() == ThrowPhase::Thrown) {
+            return flight.RotationAt(std::max(FlightTime() - (1.0f - alpha) * clock.Step(), 0.0f));
+        }
+        return Slerp(previousRotation, rotation, alpha);
+    }
+
+    void ThrowModel::StepReturning(float deltaTime, const Vec3& targetPosition, const Quat& targetRotation) {
+        if (!returnStarted) {
+            // Leaves at rest, with the return spin as a twist the spring damps out
+            spring.Begin(position, rotation, targetPosition, targetRotation, returnDuration,
+                returnDuration * Constants::RETURN_MAX_TIME_SCALE,
+                {Constants::RETURN_ARRIVAL_DISTANCE, Constants::RETURN_ARRIVAL_ANGLE},
+                SaberRight * (returnSpinSpeed * Constants::DEG_TO_RAD));
+            returnStarted = true;
+        }
+
+        bool arrived = spring.Step(deltaTime, targetPosition, targetRotation);
+        position = spring.Position();
+        rotation = spring.Rotation();
+
+        if (arrived) machine.Go<ThrowPhase::Returning, ThrowPhase::Done>();
+    }
+}
@@ -0,0 +1,67 @@
+#include "TrickSaber/Native/TraceReader.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace TrickSaber::Native {
+    TraceReader::~TraceReader() {
+        Close();
+    }
+
+    bool TraceReader::Open(const std::string& path) {
+        Close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Trace::FileHeader)) {
+            ::close(fd);
+            return false;
+        }
+
+        void* mapped = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) return false;
+
+        data = static_cast<const uint8_t*>(mapped);
+        length = static_cast<size_t>(info.st_size);
+
+        const auto& header = Header();
+        if (std::memcmp(header.magic, Trace::Magic, sizeof(header.magic)) != 0 ||
+            header.version != Trace::Version || header.headerSize < sizeof(Trace::FileHeader) ||
+            header.headerSize > length) {
+            Close();
+            return false;
+        }
+
+        Rewind();
+        return true;
+    }
+
+    void TraceReader::Close() {
+        if (data) ::munmap(const_cast<uint8_t*>(data), length);
+        data = nullptr;
+        length = 0;
+        cursor = 0;
+    }
+
+    void TraceReader::Rewind() {
+        cursor = data ? Header().headerSize : 0;
+    }
+
+    bool TraceReader::Next(RecordView& out) {
+        if (!data || length - cursor < sizeof(Trace::RecordHeader)) return false;
+
+        const auto* header = reinterpret_cast<const Trace::RecordHeader*>(data + cursor);
+        size_t payloadStart = cursor + sizeof(Trace::RecordHeader);
+        if (length - payloadStart < header->size) return false;
+
+        out = {header->type, header->size, data + payloadStart};
+        cursor = payloadStart + header->size;
+        return true;
+    }
+}
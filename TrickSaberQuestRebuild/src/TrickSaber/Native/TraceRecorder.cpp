@@ -0,0 +1,140 @@
+#include "TrickSaber/Native/TraceRecorder.hpp"
+#include "TrickSaber/Native/PoseHistory.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace TrickSaber::Native {
+    namespace {
+        constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(4);
+
+        size_t RoundUpToPowerOfTwo(size_t value) {
+            size_t result = 1;
+            while (result < value) result <<= 1;
+            return result;
+        }
+    }
+
+    TraceRecorder::~TraceRecorder() {
+        Stop();
+    }
+
+    TraceRecorder& TraceRecorder::GetInstance() {
+        static TraceRecorder instance;
+        return instance;
+    }
+
+    bool TraceRecorder::Start(const std::string& outputPath, size_t ringBytes) {
+        if (IsRecording()) return false;
+
+        file = std::fopen(outputPath.c_str(), "wb");
+        if (!file) return false;
+
+        Trace::FileHeader header{};
+        std::memcpy(header.magic, Trace::Magic, sizeof(header.magic));
+        header.version = Trace::Version;
+        header.headerSize = sizeof(Trace::FileHeader);
+        header.startTime = MonotonicSeconds();
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+            std::fclose(file);
+            file = nullptr;
+            return false;
+        }
+
+        size_t capacity = RoundUpToPowerOfTwo(std::max<size_t>(ringBytes, 4096));
+        ring = std::make_unique<uint8_t[]>(capacity);
+        ringMask = capacity - 1;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        recordCount.store(0, std::memory_order_relaxed);
+        droppedCount.store(0, std::memory_order_relaxed);
+        path = outputPath;
+
+        stopRequested.store(false, std::memory_order_relaxed);
+        writer = std::thread(&TraceRecorder::WriterLoop, this);
+        recording.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void TraceRecorder::Stop() {
+        if (!IsRecording()) return;
+        recording.store(false, std::memory_order_release);
+        stopRequested.store(true, std::memory_order_release);
+        if (writer.joinable()) writer.join();
+
+        std::fclose(file);
+        file = nullptr;
+        ring.reset();
+        ringMask = 0;
+    }
+
+    template <typename T>
+    void TraceRecorder::Append(const T& payload) {
+        constexpr size_t recordSize = sizeof(Trace::RecordHeader) + sizeof(T);
+        const size_t capacity = ringMask + 1;
+
+        uint64_t writePos = head.load(std::memory_order_relaxed);
+        uint64_t readPos = tail.load(std::memory_order_acquire);
+        if (capacity - (writePos - readPos) < recordSize) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        uint8_t bytes[recordSize];
+        Trace::RecordHeader header{Trace::RecordTypeOf<T>(), static_cast<uint16_t>(sizeof(T)), 0};
+        std::memcpy(bytes, &header, sizeof(header));
+        std::memcpy(bytes + sizeof(header), &payload, sizeof(T));
+
+        size_t offset = writePos & ringMask;
+        size_t firstPart = std::min(recordSize, capacity - offset);
+        std::memcpy(ring.get() + offset, bytes, firstPart);
+        std::memcpy(ring.get(), bytes + firstPart, recordSize - firstPart);
+
+        head.store(writePos + recordSize, std::memory_order_release);
+        recordCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void TraceRecorder::RecordPose(double time, float deltaTime, uint32_t handMask, const Vec3 positions[2], const Quat rotations[2]) {
+        if (!IsRecording()) return;
+        Trace::PoseRecord record{time, deltaTime, handMask, {positions[0], positions[1]}, {rotations[0], rotations[1]}};
+        Append(record);
+    }
+
+    void TraceRecorder::RecordInput(double time, uint8_t hand, uint32_t buttons, float trigger, float grip, float stickX, float stickY) {
+        if (!IsRecording()) return;
+        Trace::InputRecord record{time, hand, {}, buttons, trigger, grip, stickX, stickY};
+        Append(record);
+    }
+
+    void TraceRecorder::RecordTrickEvent(double time, uint8_t hand, uint8_t action, Trace::TrickPhase phase) {
+        if (!IsRecording()) return;
+        Trace::TrickEventRecord record{time, hand, action, phase, {}};
+        Append(record);
+    }
+
+    // Writes everything published so far; returns the number of bytes written
+    size_t TraceRecorder::Drain() {
+        uint64_t readPos = tail.load(std::memory_order_relaxed);
+        uint64_t writePos = head.load(std::memory_order_acquire);
+        size_t pending = static_cast<size_t>(writePos - readPos);
+        if (pending == 0) return 0;
+
+        const size_t capacity = ringMask + 1;
+        size_t offset = readPos & ringMask;
+        size_t firstPart = std::min(pending, capacity - offset);
+        std::fwrite(ring.get() + offset, 1, firstPart, file);
+        if (pending > firstPart) std::fwrite(ring.get(), 1, pending - firstPart, file);
+
+        tail.store(writePos, std::memory_order_release);
+        return pending;
+    }
+
+    void TraceRecorder::WriterLoop() {
+        while (!stopRequested.load(std::memory_order_acquire)) {
+            if (Drain() == 0) std::this_thread::sleep_for(WRITER_INTERVAL);
+        }
+        Drain();
+        std::fflush(file);
+    }
+}
@@ -1,6 +1,8 @@
 #include "TrickSaber/PhysicsHandler.hpp"
 #include "TrickSaber/Config.hpp"
 #include "TrickSaber/Utils/MemoryManager.hpp"
+#include "TrickSaber/Utils/NativeConversions.hpp"
+#include "TrickSaber/Constants.hpp"
 #include "main.hpp"
 
 #include "UnityEngine/Time.hpp"
@@ -136,34 +138,36 @@ void PhysicsHandler::UpdateSaberPhysics(SaberPhysicsState& state, float deltaTim
 void PhysicsHandler::UpdateReturnMotion(SaberPhysicsState& state, float returnDuration, float deltaTime) {
     if (!state.saberTransform || !state.handTransform) return;
     
-    state.returnTime += deltaTime;
     if (returnDuration < 0.01f) returnDuration = 0.01f;
     
-    float t = UnityEngine::Mathf::Clamp01(state.returnTime / returnDuration);
+    // Two transform reads a frame; the slot pose is native math
+    auto handPos = Utils::ToNative(state.handTransform->get_position());
+    auto handRot = Utils::ToNative(state.handTransform->get_rotation());
     
-    UnityEngine::Vector3 targetPos = state.handTransform->TransformPoint(state.originalLocalPosition);
-    UnityEngine::Quaternion targetRot = UnityEngine::Quaternion::op_Multiply(
-        state.handTransform->get_rotation(), state.originalLocalRotation);
+    if (state.returnTime == 0.0f) {
+        // Slot offset with the hand's scale, worked out once per return
+        auto slot = Utils::ToNative(state.handTransform->TransformPoint(state.originalLocalPosition));
+        state.returnSlotOffset = Native::Rotate(Native::Conjugate(handRot), slot - handPos);
+    }
     
-    state.saberTransform->set_position(UnityEngine::Vector3::Lerp(
-        state.throwReleasePosition, targetPos, t));
+    auto targetPos = handPos + Native::Rotate(handRot, state.returnSlotOffset);
+    auto targetRot = handRot * Utils::ToNative(state.originalLocalRotation);
     
-    if (state.angularVelocity.get_sqrMagnitude() > 0.0001f && t < 0.95f) {
-        // Continue spinning while returning
-        float angle = state.angularVelocity.get_magnitude() * deltaTime * RAD2DEG_CONSTANT;
-        UnityEngine::Vector3 axis = state.angularVelocity.get_normalized();
-        UnityEngine::Quaternion deltaRotation = UnityEngine::Quaternion::AngleAxis(angle, axis);
-        state.saberTransform->set_rotation(UnityEngine::Quaternion::op_Multiply(
-            deltaRotation, state.saberTransform->get_rotation()));
-        state.saberTransform->set_rotation(UnityEngine::Quaternion::Slerp(
-            state.saberTransform->get_rotation(), targetRot, t * t * t));
-    } else {
-        state.saberTransform->set_rotation(UnityEngine::Quaternion::Slerp(
-            state.throwReleaseRotation, targetRot, t));
+    if (state.returnTime == 0.0f) {
+        // Keeps spinning at first, in the target's frame, and the spring damps it out
+        auto spin = Native::Rotate(Native::Conjugate(targetRot), Utils::ToNative(state.angularVelocity));
+        state.returnSpring.Begin(Utils::ToNative(state.throwReleasePosition), Utils::ToNative(state.throwReleaseRotation),
+            targetPos, targetRot, returnDuration, returnDuration * Constants::RETURN_MAX_TIME_SCALE,
+            {Constants::RETURN_ARRIVAL_DISTANCE, Constants::RETURN_ARRIVAL_ANGLE}, spin);
     }
+    state.returnTime += deltaTime;
+    
+    bool arrived = state.returnSpring.Step(deltaTime, targetPos, targetRot);
+    state.saberTransform->set_position(Utils::ToUnity(state.returnSpring.Position()));
+    state.saberTransform->set_rotation(Utils::ToUnity(state.returnSpring.Rotation()));
     
-    if (t >= 1.0f) {
+    if (arrived) {
         state.state = SaberInteractionState::Held;
         state.returnTime = 0.0f;
     }
-}
\ No newline at end of file
+}
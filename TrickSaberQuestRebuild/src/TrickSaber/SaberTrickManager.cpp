@@ -1,18 +1,22 @@
 #include "TrickSaber/SaberTrickManager.hpp"
 #include "TrickSaber/Core/TrickSaberManager.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
 #include "TrickSaber/GlobalTrickManager.hpp"
 #include "TrickSaber/SaberTrickModel.hpp"
 #include "TrickSaber/TrailHandler.hpp"
 #include "TrickSaber/MovementController.hpp"
+#include "TrickSaber/Native/TraceRecorder.hpp"
+#include "TrickSaber/Native/PoseHistory.hpp"
 #include "TrickSaber/Tricks/Trick.hpp"
 #include "TrickSaber/Tricks/SpinTrick.hpp"
 #include "TrickSaber/Tricks/ThrowTrick.hpp"
-#include "TrickSaber/Utils/HapticFeedbackHelper.hpp"
+#include "TrickSaber/Tricks/FreezeThrowTrick.hpp"
 #include "TrickSaber/Utils/PerformanceMetrics.hpp"
-#include "TrickSaber/BurnMarkHandler.hpp"
 #include "TrickSaber/Config.hpp"
 #include "TrickSaber/Constants.hpp"
-#include "GlobalNamespace/OVRInput.hpp"
 #include "main.hpp"
 
 #include "UnityEngine/Time.hpp"
@@ -26,62 +30,161 @@ DEFINE_TYPE(TrickSaber, SaberTrickManager);
 using namespace TrickSaber;
 using namespace GlobalNamespace;
 
+namespace {
+    void TraceTrickEvent(Saber* saber, TrickAction action, Native::Trace::TrickPhase phase) {
+        auto& recorder = Native::TraceRecorder::GetInstance();
+        if (!recorder.IsRecording() || !saber) return;
+        uint8_t hand = saber->get_saberType() == GlobalNamespace::SaberType::SaberA ? 0 : 1;
+        recorder.RecordTrickEvent(MovementController::GetTimestamp(), hand, static_cast<uint8_t>(action), phase);
+    }
+}
+
+// AddComponent only runs the C# .ctor; without this the trick table, input
+// queue and arming state would stay zeroed instead of taking their defaults
+void SaberTrickManager::ctor() {
+    INVOKE_CTOR();
+}
+
 void SaberTrickManager::Awake() {
     enabled = true;
-    currentTrick = TrickAction::None;
 }
 
-void SaberTrickManager::Update() {
+void SaberTrickManager::Tick() {
     if (!enabled || !config.trickSaberEnabled) return;
     
     ValidateComponents();
+    
+    // Input is sampled into the queue first, then applied in order
     CheckDirectInput();
+    DrainInputEvents();
 }
 
 void SaberTrickManager::CheckDirectInput() {
     if (!saber) return;
     
     // Determine controller based on saber type
-    auto ovrController = (saber->get_saberType() == GlobalNamespace::SaberType::SaberA) ? 
-        GlobalNamespace::OVRInput::Controller::LTouch : GlobalNamespace::OVRInput::Controller::RTouch;
+    bool isLeftSaber = (saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
+    const auto& snapshot = Core::InputSnapshotService::Get();
+    const auto& input = snapshot.hands[isLeftSaber ? Native::LeftHand : Native::RightHand];
+    bool triggerPressed = input.Pressed(Native::Trace::TriggerButton);
+    
+    auto& recorder = Native::TraceRecorder::GetInstance();
+    if (recorder.IsRecording()) {
+        recorder.RecordInput(snapshot.time, isLeftSaber ? 0 : 1,
+            input.buttons, input.trigger, input.grip, input.stickX, input.stickY);
+    }
+    
+    auto edges = directInput.Update(triggerPressed, isLeftSaber ? -input.stickX : input.stickX);
+    
+    // Trigger and thumbstick drive whichever tricks they are bound to
+    auto triggerAction = config.triggerAction;
+    auto thumbstickAction = config.thumbstickAction;
+    auto triggerTrick = TrickTable::Describe(triggerAction);
+    auto thumbstickTrick = TrickTable::Describe(thumbstickAction);
+    
+    // Arm on a partial pull so the press frame only commits
+    if (config.enableThrowPreArm && triggerTrick.Has(Native::TrickInput::PreArm)) {
+        throwArming.Configure(config.throwArmThreshold);
+        auto arm = throwArming.Update(input.trigger, triggerPressed);
+        if (arm == Native::ArmEdge::Armed) {
+            EnqueueInput(Native::InputEdge::Arm, triggerAction, input.trigger, snapshot.time);
+        } else if (arm == Native::ArmEdge::Disarmed) {
+            EnqueueInput(Native::InputEdge::Disarm, triggerAction, 0.0f, snapshot.time);
+        }
+    }
     
-    // Check trigger for throw trick
-    bool triggerPressed = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Button::PrimaryIndexTrigger, ovrController);
+    if (edges.triggerPressed) {
+        flickHold.Cancel();
+        EnqueueInput(Native::InputEdge::Press, triggerAction, 1.0f, snapshot.time);
+    } else if (edges.triggerReleased) {
+        flickHold.Cancel();
+        EnqueueInput(Native::InputEdge::Release, triggerAction, 0.0f, snapshot.time);
+    }
     
-    if (triggerPressed && !triggerWasPressed && CanDoTrick(TrickAction::Throw)) {
-        OnTrickActivated(TrickAction::Throw, 1.0f);
-    } else if (!triggerPressed && triggerWasPressed && currentTrick == TrickAction::Throw) {
-        OnTrickDeactivated(TrickAction::Throw);
+    // A flick peak throws as if the trigger was pressed at the peak and held
+    // for flickHoldTime. Ignored while the trigger itself is held.
+    Native::FlickEvent flick;
+    if (config.enableFlickThrow && triggerTrick.Has(Native::TrickInput::Flick) &&
+        MovementController::ConsumeFlick(isLeftSaber, flick) && !triggerPressed) {
+        EnqueueInput(Native::InputEdge::Press, triggerAction, 1.0f, flick.time);
+        flickHold.Start(flick.time, config.flickHoldTime);
+    }
+    if (flickHold.Expired(snapshot.time)) {
+        EnqueueInput(Native::InputEdge::Release, triggerAction, 0.0f, snapshot.time);
     }
-    triggerWasPressed = triggerPressed;
     
-    // Check thumbstick for spin trick
-    auto stick = GlobalNamespace::OVRInput::Get(
-        GlobalNamespace::OVRInput::Axis2D::PrimaryThumbstick, ovrController);
+    if (edges.thumbstickPressed) {
+        EnqueueInput(Native::InputEdge::Press, thumbstickAction, edges.thumbstickValue, snapshot.time);
+    } else if (edges.thumbstickReleased) {
+        EnqueueInput(Native::InputEdge::Release, thumbstickAction, 0.0f, snapshot.time);
+    } else if (edges.thumbstickActive && thumbstickTrick.Has(Native::TrickInput::Analog)) {
+        EnqueueInput(Native::InputEdge::Update, thumbstickAction, edges.thumbstickValue, snapshot.time);
+    }
+}
+
+bool SaberTrickManager::EnqueueInput(Native::InputEdge edge, TrickAction action, float value, double time) {
+    if (!TrickTable::IsRegistered(action)) return false;
     
-    bool isLeftSaber = (saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
-    float thumbstickValue = isLeftSaber ? -stick.x : stick.x;
-    bool thumbstickActive = (thumbstickValue > TrickSaber::Constants::SIMPLIFIED_THUMBSTICK_THRESHOLD);
-    
-    if (thumbstickActive && !thumbstickWasActive && CanDoTrick(TrickAction::Spin)) {
-        OnTrickActivated(TrickAction::Spin, thumbstickValue);
-    } else if (!thumbstickActive && thumbstickWasActive && currentTrick == TrickAction::Spin) {
-        OnTrickDeactivated(TrickAction::Spin);
-    } else if (thumbstickActive && currentTrick == TrickAction::Spin) {
-        // Update spin trick with new input value
-        auto it = tricks.find(TrickAction::Spin);
-        if (it != tricks.end() && it->second) {
-            auto spinTrick = static_cast<Tricks::SpinTrick*>(it->second);
-            if (spinTrick) {
-                spinTrick->inputValue = thumbstickValue;
+    uint8_t hand = saber && saber->get_saberType() == GlobalNamespace::SaberType::SaberB ? 1 : 0;
+    return inputEvents.Push({time, value, hand, static_cast<uint8_t>(action), edge, 0});
+}
+
+void SaberTrickManager::DrainInputEvents() {
+    Native::InputEvent event;
+    while (inputEvents.Pop(event)) {
+        ApplyInputEvent(event);
+    }
+}
+
+void SaberTrickManager::ApplyInputEvent(const Native::InputEvent& event) {
+    auto action = static_cast<TrickAction>(event.action);
+    
+    switch (event.edge) {
+        case Native::InputEdge::Press:
+            if (!CanDoTrick(action)) break;
+            if (action == TrickAction::Throw) {
+                lastInputEdgeTime = event.time;
             }
-        }
+            inputLatency.Record(Native::MonotonicSeconds() - event.time);
+            if (TrickTable::Describe(action).Has(Native::TrickInput::PreArm)) {
+                bool armed = tricks.IsArmed(action);
+                double start = Native::MonotonicSeconds();
+                OnTrickActivated(action, event.value);
+                throwPressCost[armed ? 1 : 0].Record(Native::MonotonicSeconds() - start);
+            } else {
+                OnTrickActivated(action, event.value);
+            }
+            break;
+            
+        case Native::InputEdge::Release:
+            if (lifecycle.Current() == action && TrickTable::Describe(action).Has(Native::TrickInput::Hold)) {
+                OnTrickDeactivated(action);
+            }
+            break;
+            
+        case Native::InputEdge::Update:
+            // Analog tricks take the new input value while running
+            if (lifecycle.Current() == action) {
+                tricks.SetInput(action, event.value);
+            }
+            break;
+            
+        case Native::InputEdge::Arm:
+            if (!lifecycle.IsRunning() && CanDoTrick(action)) {
+                tricks.Arm(action, true);
+            }
+            break;
+            
+        case Native::InputEdge::Disarm:
+            tricks.Arm(action, false);
+            break;
     }
-    thumbstickWasActive = thumbstickActive;
 }
 
 void SaberTrickManager::OnDestroy() {
+    if (saber) {
+        Core::SaberManagerRegistry::Leave(this, saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
+    }
     EndAllTricks();
     Cleanup();
 }
@@ -94,6 +197,7 @@ void SaberTrickManager::Initialize(Saber* saber) {
     }
     
     this->saber = saber;
+    hand = saber->get_saberType() == GlobalNamespace::SaberType::SaberA ? Native::LeftHand : Native::RightHand;
     this->vrController = saber->get_transform()->GetComponentInParent<VRController*>();
     
     if (!vrController) {
@@ -106,6 +210,7 @@ void SaberTrickManager::Initialize(Saber* saber) {
         InitializeComponents();
         InitializeTricks();
         ConnectInputEvents();
+        Core::SaberManagerRegistry::Join(this, saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
         
         Logger.info("SaberTrickManager initialized for {} saber", 
             saber->get_saberType() == GlobalNamespace::SaberType::SaberA ? "left" : "right");
@@ -119,8 +224,8 @@ void SaberTrickManager::Initialize(Saber* saber) {
 void SaberTrickManager::InitializeComponents() {
     auto gameObject = get_gameObject();
     
-    // No InputManager needed - using direct OVRInput
-    Logger.debug("Using direct OVRInput - no InputManager needed");
+    // No InputManager needed - input comes from the shared snapshot
+    Logger.debug("Using InputSnapshotService - no InputManager needed");
     
     // MovementController is now static - no component needed
     
@@ -141,26 +246,22 @@ void SaberTrickManager::InitializeComponents() {
 void SaberTrickManager::InitializeTricks() {
     auto gameObject = get_gameObject();
     
-    // Create SpinTrick using template AddComponent
-    auto spinTrick = gameObject->AddComponent<Tricks::SpinTrick*>();
-    if (spinTrick) {
-        spinTrick->Initialize(this, saberTrickModel);
-        tricks[TrickAction::Spin] = spinTrick;
-    }
-    
-    // Create ThrowTrick using template AddComponent
-    auto throwTrick = gameObject->AddComponent<Tricks::ThrowTrick*>();
-    if (throwTrick) {
-        throwTrick->Initialize(this, saberTrickModel);
-        tricks[TrickAction::Throw] = throwTrick;
-    }
+    // One instance of every registered trick, built now and kept for the map
+    int built = tricks.Build([&](auto type) {
+        using T = typename decltype(type)::type;
+        auto trick = gameObject->AddComponent<T*>();
+        if (trick) {
+            trick->Initialize(this, saberTrickModel);
+        }
+        return trick;
+    });
     
-    Logger.debug("Tricks initialized: {}", tricks.size());
+    Logger.debug("Tricks initialized: {}/{}", built, TrickTable::Size());
 }
 
 void SaberTrickManager::ConnectInputEvents() {
     // Direct input - no callbacks needed
-    Logger.debug("Using direct OVRInput - no callbacks needed");
+    Logger.debug("Using InputSnapshotService - no callbacks needed");
 }
 
 void SaberTrickManager::OnTrickActivated(TrickAction action, float value) {
@@ -174,7 +275,7 @@ void SaberTrickManager::OnTrickActivated(TrickAction action, float value) {
     
     if (!CanDoTrick(action)) {
         Logger.debug("Cannot start trick {} - conditions not met (current: {})", 
-            static_cast<int>(action), static_cast<int>(currentTrick));
+            static_cast<int>(action), static_cast<int>(lifecycle.Current()));
         
         // Record failed trick attempt
         auto perfMetrics = Utils::PerformanceMetrics::GetInstance();
@@ -184,26 +285,18 @@ void SaberTrickManager::OnTrickActivated(TrickAction action, float value) {
         return;
     }
     
-    // Handle special case for spin trick continuous input
-    if (action == TrickAction::Spin && currentTrick == TrickAction::Spin) {
-        // Update existing spin trick with new input value
-        auto it = tricks.find(action);
-        if (it != tricks.end() && it->second) {
-            auto spinTrick = static_cast<Tricks::SpinTrick*>(it->second);
-            if (spinTrick) {
-                spinTrick->inputValue = value;
-                Logger.debug("Updated spin trick input: {:.2f}", value);
-            }
-        }
+    // A repeated press on a running analog trick (spin) only updates its input
+    if (lifecycle.Current() == action && TrickTable::Describe(action).Has(Native::TrickInput::Analog)) {
+        tricks.SetInput(action, value);
+        Logger.debug("Updated trick {} input: {:.2f}", static_cast<int>(action), value);
         return;
     }
     
-    auto it = tricks.find(action);
-    if (it != tricks.end() && it->second) {
+    if (tricks.Get(action)) {
         try {
             Logger.debug("Starting trick {} with value {:.2f}", static_cast<int>(action), value);
-            if (it->second->StartTrick(value)) {
-                currentTrick = action;
+            if (tricks.Start(action, value)) {
+                lifecycle.Start(action);
                 OnTrickStarted(action);
                 Logger.info("Trick {} started successfully", static_cast<int>(action));
             } else {
@@ -235,97 +328,55 @@ void SaberTrickManager::OnTrickDeactivated(TrickAction action) {
     if (!enabled || !saber || action == TrickAction::None) return;
     
     // Only end trick if it's currently active
-    if (currentTrick != action) {
+    if (lifecycle.Current() != action) {
         Logger.debug("Trick deactivation ignored - not current trick (current: {}, deactivating: {})", 
-            static_cast<int>(currentTrick), static_cast<int>(action));
+            static_cast<int>(lifecycle.Current()), static_cast<int>(action));
         return;
     }
     
-    auto it = tricks.find(action);
-    if (it != tricks.end() && it->second && it->second->IsActive()) {
-        try {
-            OnTrickEnding(action);
-            it->second->EndTrick();
-            Logger.debug("Trick {} deactivated", static_cast<int>(action));
-        } catch (const std::exception& e) {
-            Logger.error("Error ending trick {}: {}", static_cast<int>(action), e.what());
-            it->second->EndTrickImmediately();
-            OnTrickEnded(action); // Ensure state is cleaned up
-        }
+    if (!tricks.IsActive(action)) return;
+    try {
+        OnTrickEnding(action);
+        tricks.End(action);
+        Logger.debug("Trick {} deactivated", static_cast<int>(action));
+    } catch (const std::exception& e) {
+        Logger.error("Error ending trick {}: {}", static_cast<int>(action), e.what());
+        tricks.EndImmediately(action);
+        OnTrickEnded(action); // Ensure state is cleaned up
     }
 }
 
 void SaberTrickManager::OnTrickStarted(TrickAction action) {
-    // Record trick start time for performance metrics
-    trickStartTime = std::chrono::high_resolution_clock::now();
-    
-    // Disable burn marks during trick
-    BurnMarkHandler::DisableBurnMarks(static_cast<int>(saber->get_saberType()));
+    TraceTrickEvent(saber, action, Native::Trace::TrickPhase::Started);
     
-    // Trigger haptic feedback
-    Utils::HapticFeedbackHelper::TriggerHaptic(saber->get_saberType(), 
-        Utils::HapticFeedbackHelper::HapticType::TrickStart);
+    // Record trick start time for the duration in TrickEndedEvent
+    trickStartTime = Core::FrameClock::SteadyNow();
     
-    // Notify global manager
-    auto globalManager = GlobalTrickManager::GetInstance();
-    if (globalManager) {
-        globalManager->OnTrickStarted(action);
-    }
-    
-    if (onTrickStarted) {
-        onTrickStarted(action);
-    }
+    // Burn marks, haptics, GlobalTrickManager and metrics subscribe to this
+    Core::TrickEvents::Publish(Native::TrickStartedEvent{Core::FrameClock::Now(), action, hand});
     
     Logger.debug("Trick started: {}", static_cast<int>(action));
 }
 
 void SaberTrickManager::OnTrickEnding(TrickAction action) {
-    if (onTrickEnding) {
-        onTrickEnding(action);
-    }
+    TraceTrickEvent(saber, action, Native::Trace::TrickPhase::Ending);
+    
+    Core::TrickEvents::Publish(Native::TrickEndingEvent{Core::FrameClock::Now(), action, hand});
     
     Logger.debug("Trick ending: {}", static_cast<int>(action));
 }
 
 void SaberTrickManager::OnTrickEnded(TrickAction action) {
-    // Calculate trick duration and record performance metrics
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - trickStartTime).count() / 1000.0f;
-    
-    auto perfMetrics = Utils::PerformanceMetrics::GetInstance();
-    if (perfMetrics) {
-        if (action == TrickAction::Throw) {
-            // Get throw velocity from static movement controller
-            float velocity = 0.0f;
-            if (saber->get_saberType() == GlobalNamespace::SaberType::SaberA) {
-                velocity = MovementController::GetLeftVelocity().get_magnitude();
-            } else {
-                velocity = MovementController::GetRightVelocity().get_magnitude();
-            }
-            perfMetrics->RecordThrowTrick(velocity, duration);
-        } else if (action == TrickAction::Spin) {
-            perfMetrics->RecordSpinTrick(duration);
-        }
-    }
-    
-    currentTrick = TrickAction::None;
-    
-    // Re-enable burn marks
-    BurnMarkHandler::EnableBurnMarks(static_cast<int>(saber->get_saberType()));
-    
-    // Trigger return haptic feedback
-    Utils::HapticFeedbackHelper::TriggerHaptic(saber->get_saberType(), 
-        Utils::HapticFeedbackHelper::HapticType::SaberReturn);
+    // Nothing if already reported or not running
+    if (lifecycle.End(action)) PublishTrickEnded(action);
+}
+
+void SaberTrickManager::PublishTrickEnded(TrickAction action) {
+    TraceTrickEvent(saber, action, Native::Trace::TrickPhase::Ended);
     
-    // Notify global manager
-    auto globalManager = GlobalTrickManager::GetInstance();
-    if (globalManager) {
-        globalManager->OnTrickEnded(action);
-    }
+    auto duration = std::chrono::duration<float>(Core::FrameClock::SteadyNow() - trickStartTime).count();
     
-    if (onTrickEnded) {
-        onTrickEnded(action);
-    }
+    Core::TrickEvents::Publish(Native::TrickEndedEvent{Core::FrameClock::Now(), duration, action, hand});
     
     Logger.debug("Trick ended: {} (duration: {:.2f}s)", static_cast<int>(action), duration);
 }
@@ -335,8 +386,8 @@ bool SaberTrickManager::CanDoTrick(TrickAction action) const {
     
     // Controller connection is handled internally by OVRInput
     
-    // Special case: allow spin trick updates while spinning
-    if (action == TrickAction::Spin && currentTrick == TrickAction::Spin) {
+    // Special case: allow input updates to a running analog trick
+    if (lifecycle.Current() == action && TrickTable::Describe(action).Has(Native::TrickInput::Analog)) {
         return true;
     }
     
@@ -359,7 +410,7 @@ bool SaberTrickManager::CanDoTrick(TrickAction action) const {
 }
 
 bool SaberTrickManager::IsAnyTrickActive() const {
-    return currentTrick != TrickAction::None;
+    return lifecycle.IsRunning();
 }
 
 bool SaberTrickManager::IsDoingTrick() {
@@ -367,22 +418,15 @@ bool SaberTrickManager::IsDoingTrick() {
 }
 
 void SaberTrickManager::EndAllTricks() {
-    for (auto& [action, trick] : tricks) {
-        if (trick && trick->IsActive()) {
-            OnTrickEnding(action);
-            trick->EndTrickImmediately();
-            OnTrickEnded(action);
-        }
-    }
-    currentTrick = TrickAction::None;
+    // Throw and FreezeThrow report their own end from EndTrickImmediately;
+    // the lifecycle publishes Ended only for the tricks that did not
+    lifecycle.EndAll(tricks,
+        [&](TrickAction action) { OnTrickEnding(action); },
+        [&](TrickAction action) { PublishTrickEnded(action); });
 }
 
 bool SaberTrickManager::IsTrickInState(TrickAction action, TrickState state) {
-    auto it = tricks.find(action);
-    if (it != tricks.end() && it->second) {
-        return it->second->IsTrickInState(static_cast<int>(state));
-    }
-    return false;
+    return tricks.IsInState(action, state);
 }
 
 void SaberTrickManager::ValidateComponents() {
@@ -398,18 +442,26 @@ void SaberTrickManager::ValidateComponents() {
     // Direct OVRInput - no validation needed
 }
 
-void SaberTrickManager::UpdateActiveTricks() {
-    for (auto& [action, trick] : tricks) {
-        if (trick && trick->IsActive()) {
-            trick->Update();
-        }
-    }
+void SaberTrickManager::TickTrick(TrickAction action) {
+    tricks.Tick(action);
 }
 
 void SaberTrickManager::Cleanup() {
     // No InputManager to clean up
+    inputEvents.Clear();
+    if (inputLatency.count > 0) {
+        Logger.info("Input latency: {} presses, mean {:.2f} ms, max {:.2f} ms, {} events dropped",
+            inputLatency.count, inputLatency.Mean() * 1000.0, inputLatency.max * 1000.0, inputEvents.GetDroppedCount());
+    }
+    inputLatency.Reset();
     
-    onTrickStarted = nullptr;
-    onTrickEnding = nullptr;
-    onTrickEnded = nullptr;
+    if (throwPressCost[0].count > 0 || throwPressCost[1].count > 0) {
+        Logger.info("Throw press-frame cost: armed {} mean {:.3f} ms max {:.3f} ms, cold {} mean {:.3f} ms max {:.3f} ms",
+            throwPressCost[1].count, throwPressCost[1].Mean() * 1000.0, throwPressCost[1].max * 1000.0,
+            throwPressCost[0].count, throwPressCost[0].Mean() * 1000.0, throwPressCost[0].max * 1000.0);
+    }
+    throwPressCost[0].Reset();
+    throwPressCost[1].Reset();
+    throwArming.Reset();
+    flickHold.Cancel();
 }
\ No newline at end of file
@@ -50,11 +50,11 @@ void SaberTrickModel::ChangeToActualSaber() {
     if (!saberTransform || !originalParent) return;
     
     // Restore original saber
-    if (saber) {
-        auto saberModelController = saber->GetComponentInChildren<GlobalNamespace::SaberModelController*>();
-        if (saberModelController) {
-            saberModelController->get_gameObject()->SetActive(true);
-        }
+    if (saber && !saberModelController) {
+        saberModelController = saber->GetComponentInChildren<GlobalNamespace::SaberModelController*>();
+    }
+    if (saberModelController) {
+        saberModelController->get_gameObject()->SetActive(true);
     }
     
     // Disable trick model
@@ -71,20 +71,28 @@ void SaberTrickModel::ChangeToActualSaber() {
     Logger.debug("Switched to actual saber");
 }
 
+void SaberTrickModel::Prepare() {
+    // The pose is left to ChangeToTrickModel; the hand keeps moving until the press
+    if (saber && !saberModelController) {
+        saberModelController = saber->GetComponentInChildren<GlobalNamespace::SaberModelController*>();
+    }
+}
+
 void SaberTrickModel::ChangeToTrickModel() {
     if (!trickModel || !saberTransform) return;
     
+    if (saber && !saberModelController) {
+        saberModelController = saber->GetComponentInChildren<GlobalNamespace::SaberModelController*>();
+    }
+    
     // Position trick model at saber location
     trickModelTransform->set_position(saberTransform->get_position());
     trickModelTransform->set_rotation(saberTransform->get_rotation());
     
     // Enable trick model, disable original
     trickModel->SetActive(true);
-    if (saber) {
-        auto saberModelController = saber->GetComponentInChildren<GlobalNamespace::SaberModelController*>();
-        if (saberModelController) {
-            saberModelController->get_gameObject()->SetActive(false);
-        }
+    if (saberModelController) {
+        saberModelController->get_gameObject()->SetActive(false);
     }
     
     usingTrickModel = true;
@@ -0,0 +1,169 @@
+#include "TrickSaber/ThrownSaberCutter.hpp"
+#include "TrickSaber/Utils/NativeConversions.hpp"
+#include "TrickSaber/Constants.hpp"
+#include "main.hpp"
+
+#include "GlobalNamespace/NoteData.hpp"
+#include "GlobalNamespace/ColorType.hpp"
+#include "GlobalNamespace/NoteLineLayer.hpp"
+#include "UnityEngine/Transform.hpp"
+#include "UnityEngine/Vector3.hpp"
+#include "UnityEngine/Quaternion.hpp"
+#include "beatsaber-hook/shared/utils/il2cpp-utils.hpp"
+
+#include <algorithm>
+#include <array>
+
+using namespace TrickSaber;
+using namespace GlobalNamespace;
+
+std::unique_ptr<Native::NoteGrid> ThrownSaberCutter::grid;
+AudioTimeSyncController* ThrownSaberCutter::audioController = nullptr;
+
+namespace {
+    // More than this many notes in one frame's sweep are left for the next
+    constexpr int MAX_CUTS_PER_FRAME = 8;
+    constexpr float MIN_TIME_TO_ARRIVAL = 0.01f;
+    constexpr float MIN_JUMP_SPEED = 0.1f;     // m/s
+}
+
+void ThrownSaberCutter::Initialize(AudioTimeSyncController* controller) {
+    audioController = controller;
+    if (!grid) grid = std::make_unique<Native::NoteGrid>(Native::NoteGrid::DefaultLayout());
+    Clear();
+}
+
+void ThrownSaberCutter::Clear() {
+    if (grid) grid->Clear();
+}
+
+float ThrownSaberCutter::SongTime() {
+    return audioController ? audioController->get_songTime() : 0.0f;
+}
+
+bool ThrownSaberCutter::ReadJump(NoteController* noteController, float beatTime, Native::NoteGrid::Note& note) {
+    // NoteJump keeps its arc in private fields; resolved once, like HandleCut
+    static FieldInfo* movementField = nullptr;
+    static FieldInfo* jumpField = nullptr;
+    static FieldInfo* startField = nullptr;
+    static FieldInfo* endField = nullptr;
+    static FieldInfo* durationField = nullptr;
+    static FieldInfo* gravityField = nullptr;
+    static FieldInfo* verticalVelocityField = nullptr;
+    static FieldInfo* rotationField = nullptr;
+
+    if (!movementField) movementField = il2cpp_utils::FindField(noteController, "_noteMovement");
+    if (!movementField) return false;
+    auto movement = il2cpp_utils::GetFieldValue<Il2CppObject*>(noteController, movementField);
+    if (!movement.has_value() || !movement.value()) return false;
+
+    if (!jumpField) jumpField = il2cpp_utils::FindField(movement.value(), "_jump");
+    if (!jumpField) return false;
+    auto jumpValue = il2cpp_utils::GetFieldValue<Il2CppObject*>(movement.value(), jumpField);
+    if (!jumpValue.has_value() || !jumpValue.value()) return false;
+    auto jump = jumpValue.value();
+
+    if (!startField) {
+        startField = il2cpp_utils::FindField(jump, "_startPos");
+        endField = il2cpp_utils::FindField(jump, "_endPos");
+        durationField = il2cpp_utils::FindField(jump, "_jumpDuration");
+        gravityField = il2cpp_utils::FindField(jump, "_gravity");
+        verticalVelocityField = il2cpp_utils::FindField(jump, "_startVerticalVelocity");
+        rotationField = il2cpp_utils::FindField(jump, "_worldRotation");
+    }
+    if (!startField || !endField || !durationField || !gravityField || !verticalVelocityField || !rotationField) return false;
+
+    auto start = il2cpp_utils::GetFieldValue<UnityEngine::Vector3>(jump, startField);
+    auto end = il2cpp_utils::GetFieldValue<UnityEngine::Vector3>(jump, endField);
+    auto duration = il2cpp_utils::GetFieldValue<float>(jump, durationField);
+    auto gravity = il2cpp_utils::GetFieldValue<float>(jump, gravityField);
+    auto verticalVelocity = il2cpp_utils::GetFieldValue<float>(jump, verticalVelocityField);
+    auto rotation = il2cpp_utils::GetFieldValue<UnityEngine::Quaternion>(jump, rotationField);
+    if (!start || !end || !duration || !gravity || !verticalVelocity || !rotation || *duration <= 0.0f) return false;
+
+    // The jump starts half its duration before the beat and runs straight
+    // from start to end in z; taken about where it crosses the cut plane
+    float speed = (start->z - end->z) / *duration;
+    if (speed < MIN_JUMP_SPEED) return false;
+    float crossing = (start->z - Native::NoteGrid::DefaultLayout().cutPlaneZ) / speed;
+    float along = crossing / *duration;
+
+    note.x = start->x + (end->x - start->x) * along;
+    note.y = start->y + (*verticalVelocity - 0.5f * *gravity * crossing) * crossing;
+    note.arrival = beatTime - 0.5f * *duration + crossing;
+    note.speed = speed;
+    note.verticalVelocity = *verticalVelocity - *gravity * crossing;
+    note.gravity = *gravity;
+    note.rotation = Utils::ToNative(*rotation);
+    return true;
+}
+
+void ThrownSaberCutter::OnNoteDidStartJump(NoteController* noteController) {
+    if (!grid || !audioController || !noteController) return;
+
+    auto noteData = noteController->get_noteData();
+    if (!noteData || noteData->get_colorType() == ColorType::None) return;    // bombs are never cut
+
+    float arrival = noteData->get_time();
+    float remaining = arrival - audioController->get_songTime();
+    if (remaining < MIN_TIME_TO_ARRIVAL) return;
+
+    Native::NoteGrid::Note note{reinterpret_cast<uint64_t>(noteController), 0.0f, 0.0f, arrival, 0.0f};
+    if (!ReadJump(noteController, arrival, note)) {
+        // Straight along -z in its lane on an unrotated map: speed from how
+        // far out the note starts and how long it has to reach the cut plane
+        int line = std::clamp(noteData->get_lineIndex(), 0, 3);
+        int layer = std::clamp(static_cast<int>(noteData->get_noteLineLayer().value__), 0, 2);
+        float z = noteController->get_transform()->get_position().z;
+        note.x = (static_cast<float>(line) - 1.5f) * Constants::NOTE_LINE_SPACING;
+        note.y = Constants::NOTE_LAYER_HEIGHTS[layer];
+        note.speed = (z - Native::NoteGrid::DefaultLayout().cutPlaneZ) / remaining;
+    }
+
+    // A full pool leaves the note uncuttable
+    grid->Insert(note);
+}
+
+void ThrownSaberCutter::OnNoteRemoved(NoteController* noteController) {
+    if (!grid) return;
+    auto key = reinterpret_cast<uint64_t>(noteController);
+    grid->Remove(grid->Find(key), key);
+}
+
+int ThrownSaberCutter::Cut(Saber* saber, const Native::SweptBlade& blade, const Native::Quat& rotation,
+    float fromSongTime, float toSongTime) {
+    if (!grid || !audioController || !saber || grid->Size() == 0) return 0;
+
+    // Collected first: cutting a note runs the cut hook, which removes it
+    // from the grid being walked
+    std::array<std::pair<NoteController*, Native::Vec3>, MAX_CUTS_PER_FRAME> cuts;
+    int count = 0;
+    // Song time, not frame time: notes move with the song under slowmo pitch
+    grid->Query(blade, toSongTime, toSongTime - fromSongTime, [&](const Native::NoteGrid::Note& note, const Native::Vec3& point) {
+        if (count < MAX_CUTS_PER_FRAME) cuts[count++] = {reinterpret_cast<NoteController*>(note.key), point};
+    });
+
+    auto direction = Native::Normalized(blade.tip1 - blade.tip0);
+    for (int i = 0; i < count; ++i) {
+        CutNote(cuts[i].first, saber, cuts[i].second, rotation, direction);
+    }
+    return count;
+}
+
+void ThrownSaberCutter::CutNote(NoteController* noteController, Saber* saber,
+    const Native::Vec3& point, const Native::Quat& rotation, const Native::Vec3& direction) {
+    // Same entry point the game's own NoteCutter reaches through the note's
+    // CuttableBySaber; resolved once per note class
+    static Il2CppClass* cachedClass = nullptr;
+    static const MethodInfo* handleCut = nullptr;
+
+    auto klass = il2cpp_functions::object_get_class(reinterpret_cast<Il2CppObject*>(noteController));
+    if (klass != cachedClass) {
+        cachedClass = klass;
+        handleCut = il2cpp_utils::FindMethodUnsafe(noteController, "HandleCut", 5);
+    }
+    if (!handleCut) return;
+
+    il2cpp_utils::RunMethod(noteController, handleCut, saber, Utils::ToUnity(point), Utils::ToUnity(rotation),
+        Utils::ToUnity(direction), true);
+}
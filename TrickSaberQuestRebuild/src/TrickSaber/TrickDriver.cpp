@@ -0,0 +1,101 @@
+#include "TrickSaber/TrickDriver.hpp"
+#include "TrickSaber/GlobalTrickManager.hpp"
+#include "TrickSaber/SaberTrickManager.hpp"
+#include "TrickSaber/Config.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
+#include "main.hpp"
+
+#include "UnityEngine/GameObject.hpp"
+
+DEFINE_TYPE(TrickSaber, TrickDriver);
+
+using namespace TrickSaber;
+
+void TrickDriver::Initialize() {
+    if (instance) return;
+    
+    auto go = UnityEngine::GameObject::New_ctor("TrickSaberDriver");
+    go->AddComponent<TrickDriver*>();
+}
+
+void TrickDriver::Awake() {
+    instance = this;
+    activeTricks.Clear();
+    
+    Core::TrickEvents::Subscribe<Native::TrickStartedEvent>(&TrickDriver::HandleTrickStarted, this);
+    Core::TrickEvents::Subscribe<Native::TrickEndedEvent>(&TrickDriver::HandleTrickEnded, this);
+}
+
+void TrickDriver::OnDestroy() {
+    Core::TrickEvents::Unsubscribe<Native::TrickStartedEvent>(&TrickDriver::HandleTrickStarted, this);
+    Core::TrickEvents::Unsubscribe<Native::TrickEndedEvent>(&TrickDriver::HandleTrickEnded, this);
+    
+    if (frameCount > 0) {
+        Logger.info("TrickDriver: {} frames ({} idle), {} trick ticks, {} Unity Update callbacks replaced ({:.1f}/frame)",
+            frameCount, idleFrameCount, trickTickCount, replacedCallbackCount,
+            static_cast<double>(replacedCallbackCount) / frameCount);
+    }
+    
+    if (instance == this) {
+        instance = nullptr;
+    }
+}
+
+void TrickDriver::HandleTrickStarted(void* context, const Native::TrickStartedEvent& event) {
+    static_cast<TrickDriver*>(context)->activeTricks.Started(event.hand, event.action);
+}
+
+void TrickDriver::HandleTrickEnded(void* context, const Native::TrickEndedEvent& event) {
+    static_cast<TrickDriver*>(context)->activeTricks.Ended(event.hand, event.action);
+}
+
+void TrickDriver::Update() {
+    // Usually already stamped by the VRController hook this frame
+    Core::FrameClock::BeginFrame();
+    if (!config.trickSaberEnabled) return;
+    
+    frameCount++;
+    
+    // Callbacks this frame would have cost, less the driver's own
+    int replaced = -1;
+    
+    auto globalManager = GlobalTrickManager::GetInstance();
+    if (globalManager) {
+        if (config.disableIfNotesOnScreen) {
+            globalManager->UpdateNoteTimer(Core::FrameClock::DeltaTime());
+        }
+        replaced++;
+    }
+    
+    // Input first, so a press this frame starts its trick before the step
+    for (auto manager : Core::SaberManagerRegistry::All()) {
+        if (!manager) continue;
+        manager->Tick();
+        replaced += UpdatesPerManager;
+    }
+    
+    if (replaced > 0) replacedCallbackCount += replaced;
+    
+    if (!activeTricks.Any()) {
+        idleFrameCount++;
+        return;
+    }
+    
+    activeTricks.ForEachActive([this](int hand, TrickAction action) {
+        auto manager = Core::SaberManagerRegistry::Get(hand == Native::LeftHand);
+        if (!manager) {
+            activeTricks.Ended(hand, action);
+            return;
+        }
+        
+        try {
+            manager->TickTrick(action);
+            trickTickCount++;
+        } catch (const std::exception& e) {
+            Logger.error("Trick {} tick failed: {}", static_cast<int>(action), e.what());
+            manager->EndAllTricks();
+        }
+    });
+}
@@ -1,7 +1,9 @@
 #include "TrickSaber/Tricks/FreezeThrowTrick.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/SaberTrickManager.hpp"
 #include "TrickSaber/Core/TrickSaberManager.hpp"
 #include "TrickSaber/Config.hpp"
+#include "TrickSaber/Utils/NativeConversions.hpp"
 #include "main.hpp"
 
 #include "UnityEngine/GameObject.hpp"
@@ -11,17 +13,46 @@
 #include "UnityEngine/Mathf.hpp"
 #include "GlobalNamespace/Saber.hpp"
 
+#include <algorithm>
+
 DEFINE_TYPE(TrickSaber::Tricks, FreezeThrowTrick);
 
 using namespace TrickSaber::Tricks;
 using namespace TrickSaber;
 
+void FreezeThrowTrick::ctor() {
+    INVOKE_CTOR();
+}
+
 void FreezeThrowTrick::Awake() {
     isFrozen = false;
+    returning = false;
     rigidbody = nullptr;
 }
 
-void FreezeThrowTrick::Update() {
+bool FreezeThrowTrick::StartTrick(float value) {
+    if (active || !saberTrickManager || !saberTrickManager->saber) return false;
+    
+    Trick::StartTrick(value);
+    OnTrickStart();
+    return true;
+}
+
+void FreezeThrowTrick::EndTrick() {
+    if (!active || returning) return;
+    OnTrickEndRequested();
+}
+
+void FreezeThrowTrick::EndTrickImmediately() {
+    OnTrickEndImmediately();
+}
+
+void FreezeThrowTrick::Tick() {
+    if (returning) {
+        StepReturn();
+        if (!active) return;
+    }
+    
     if (active && isFrozen && saberTrickManager && saberTrickManager->saber) {
         // Keep saber frozen in position
         auto transform = saberTrickManager->saber->get_transform();
@@ -67,13 +98,31 @@ void FreezeThrowTrick::OnTrickStart() {
 }
 
 void FreezeThrowTrick::OnTrickEndRequested() {
-    active = false;
-    StartCoroutine(custom_types::Helpers::CoroutineHelper::New(ReturnSaber()));
+    if (!saberTrickManager || !saberTrickManager->saber || !saberTrickManager->vrController) {
+        OnTrickEndImmediately();
+        return;
+    }
+    
+    // Remove slowmo effect
+    if (config.slowmoDuringThrow) {
+        auto manager = Core::TrickSaberManager::GetInstance();
+        if (manager) {
+            manager->RemoveSlowmo();
+        }
+    }
+    
+    // Stays active until the return lands, so Tick keeps running
+    returnStart = frozenPosition;
+    returnStartRotation = frozenRotation;
+    returnTime = 0.0f;
+    returning = true;
 }
 
 void FreezeThrowTrick::OnTrickEndImmediately() {
-    StopAllCoroutines();
+    bool wasActive = active;
+    returning = false;
     UnfreezeSaber();
+    if (wasActive) RestoreLocalPose();
     
     // Remove slowmo
     if (config.slowmoDuringThrow) {
@@ -84,6 +133,9 @@ void FreezeThrowTrick::OnTrickEndImmediately() {
     }
     
     active = false;
+    if (wasActive && saberTrickManager) {
+        saberTrickManager->OnTrickEnded(TrickAction::FreezeThrow);
+    }
     Logger.debug("Freeze throw trick ended immediately");
 }
 
@@ -101,6 +153,17 @@ void FreezeThrowTrick::FreezeSaber() {
     frozenPosition = transform->get_position();
     frozenRotation = transform->get_rotation();
     
+    // Where the saber sits in the hand, for the return and the restore
+    originalLocalPosition = transform->get_localPosition();
+    originalLocalRotation = transform->get_localRotation();
+    handTransform = transform->get_parent();
+    if (handTransform) {
+        auto handPos = Utils::ToNative(handTransform->get_position());
+        auto handRot = Native::Conjugate(Utils::ToNative(handTransform->get_rotation()));
+        slotOffset = Native::Rotate(handRot, Utils::ToNative(frozenPosition) - handPos);
+        slotRotation = handRot * Utils::ToNative(frozenRotation);
+    }
+    
     // Get or add rigidbody for physics control
     rigidbody = saberGO->GetComponent<UnityEngine::Rigidbody*>();
     if (!rigidbody) {
@@ -126,47 +189,48 @@ void FreezeThrowTrick::UnfreezeSaber() {
     }
 }
 
-custom_types::Helpers::Coroutine FreezeThrowTrick::ReturnSaber() {
-    if (!saberTrickManager || !saberTrickManager->vrController) {
-        OnTrickEndImmediately();
-        co_return;
+void FreezeThrowTrick::StepReturn() {
+    if (!saberTrickManager || !saberTrickManager->saber) {
+        FinishReturn();
+        return;
     }
     
-    // Remove slowmo effect
-    if (config.slowmoDuringThrow) {
-        auto manager = Core::TrickSaberManager::GetInstance();
-        if (manager) {
-            manager->RemoveSlowmo();
-        }
-    }
-    
-    auto transform = saberTrickManager->saber->get_transform();
-    auto startPos = transform->get_position();
-    auto targetPos = saberTrickManager->vrController->get_position();
-    
-    float returnTime = 0.0f;
-    const float returnDuration = 1.0f / config.returnSpeed;
+    // Same 1..50 range the settings clamp to
+    const float returnDuration = 1.0f / std::clamp(config.returnSpeed, 1.0f, 50.0f);
+    returnTime += Core::FrameClock::DeltaTime();
+    float t = std::min(returnTime / returnDuration, 1.0f);
+    t = t * t * (3.0f - 2.0f * t); // Smoothstep
     
-    // Smooth return to controller
-    while (returnTime < returnDuration) {
-        if (!saberTrickManager || !saberTrickManager->saber) break;
-        
-        returnTime += UnityEngine::Time::get_deltaTime();
-        float t = returnTime / returnDuration;
-        t = t * t * (3.0f - 2.0f * t); // Smoothstep
-        
-        // Update target position
-        if (saberTrickManager->vrController) {
-            targetPos = saberTrickManager->vrController->get_position();
-        }
-        
-        auto currentPos = UnityEngine::Vector3::Lerp(startPos, targetPos, t);
-        frozenPosition = currentPos; // Update frozen position for Update() method
-        
-        co_yield nullptr;
+    // Chase the saber slot as the hand moves, like ThrowTrick's return
+    if (handTransform) {
+        auto handPos = Utils::ToNative(handTransform->get_position());
+        auto handRot = Utils::ToNative(handTransform->get_rotation());
+        auto targetPos = handPos + Native::Rotate(handRot, slotOffset);
+        auto targetRot = handRot * slotRotation;
+        frozenPosition = Utils::ToUnity(Native::Lerp(Utils::ToNative(returnStart), targetPos, t));
+        frozenRotation = Utils::ToUnity(Native::Slerp(Utils::ToNative(returnStartRotation), targetRot, t));
     }
     
+    if (returnTime >= returnDuration) {
+        FinishReturn();
+    }
+}
+
+void FreezeThrowTrick::FinishReturn() {
+    returning = false;
     UnfreezeSaber();
+    RestoreLocalPose();
     active = false;
+    if (saberTrickManager) {
+        saberTrickManager->OnTrickEnded(TrickAction::FreezeThrow);
+    }
     Logger.debug("Freeze throw trick return completed");
-}
\ No newline at end of file
+}
+
+void FreezeThrowTrick::RestoreLocalPose() {
+    // Exact slot pose, whatever the blend left behind
+    if (!saberTrickManager || !saberTrickManager->saber) return;
+    auto transform = saberTrickManager->saber->get_transform();
+    transform->set_localPosition(originalLocalPosition);
+    transform->set_localRotation(originalLocalRotation);
+}
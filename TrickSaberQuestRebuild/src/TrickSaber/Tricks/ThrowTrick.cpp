@@ -1,11 +1,13 @@
 #include "TrickSaber/Tricks/ThrowTrick.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/SaberTrickModel.hpp"
 #include "TrickSaber/SaberTrickManager.hpp"
 #include "TrickSaber/MovementController.hpp"
+#include "TrickSaber/ThrownSaberCutter.hpp"
 #include "TrickSaber/Config.hpp"
 #include "TrickSaber/Configuration.hpp"
 #include "TrickSaber/Core/TrickSaberManager.hpp"
-#include "TrickSaber/Utils/UnityMath.hpp"
+#include "TrickSaber/Utils/NativeConversions.hpp"
 #include "TrickSaber/Utils/HapticFeedbackHelper.hpp"
 #include "TrickSaber/Utils/PooledTrickCalculation.hpp"
 #include "TrickSaber/Constants.hpp"
@@ -15,24 +17,37 @@
 #include "UnityEngine/Physics.hpp"
 #include "main.hpp"
 
+#include <algorithm>
+
 DEFINE_TYPE(TrickSaber::Tricks, ThrowTrick);
 
 using namespace TrickSaber::Tricks;
 
+// Runs the member initializers; the model's phase handlers and fixed step
+// come from them
+void ThrowTrick::ctor() {
+    INVOKE_CTOR();
+}
+
 bool ThrowTrick::StartTrick(float value) {
-    if (!Trick::StartTrick(value)) return false;
-    
     if (!saberTrickModel || !saberTrickModel->saber) {
         Logger.error("ThrowTrick: Missing required components");
         return false;
     }
     
-    auto saberTransform = saberTrickModel->saber->get_transform();
+    // Armed throws did this on the way down; the press only commits
+    if (!armed) Prepare();
+    armed = false;
     
-    // Store original transform and parent
-    originalLocalPosition = saberTransform->get_localPosition();
-    originalLocalRotation = saberTransform->get_localRotation();
-    originalParent = saberTransform->get_parent();
+    // Tick relies on these for the whole throw and does not re-check them
+    if (!saberTransform || !originalParent) {
+        Logger.error("ThrowTrick: Saber has no transform or parent");
+        ReleasePrepared();
+        return false;
+    }
+    
+    if (!Trick::StartTrick(value)) return false;
+    hasBlade = false;
     
     // Switch to trick model with rigidbody (PC parity)
     saberTrickModel->ChangeToTrickModel();
@@ -42,11 +57,10 @@ bool ThrowTrick::StartTrick(float value) {
         rigidbody->set_isKinematic(false);
     }
     
-    // Calculate throw forces based on controller movement
-    CalculateThrowForces();
-    
-    // Apply physics forces to rigidbody
+    // Detach, then launch the model from the saber's world pose
     ApplyThrowForces();
+    CalculateThrowForces(armedParams);
+    calculation.reset();
     
     // Apply slowmo if enabled
     if (TrickSaber::Configuration::IsSlowmoDuringThrow()) {
@@ -56,244 +70,196 @@ bool ThrowTrick::StartTrick(float value) {
         }
     }
     
-    state = ThrowState::Thrown;
-    returnDuration = config.returnDuration > 0 ? config.returnDuration : Constants::DEFAULT_RETURN_DURATION;
-    
     // Trigger throw start haptic
-    TrickSaber::Utils::HapticFeedbackHelper::TriggerHaptic(saberTrickModel->saber->get_saberType(), 
+    TrickSaber::Utils::HapticFeedbackHelper::TriggerHaptic(hapticManager, saberTrickModel->saber->get_saberType(), 
         TrickSaber::Utils::HapticFeedbackHelper::HapticType::TrickStart);
     
+    auto launchVelocity = model.Launched().velocity;
     Logger.debug("ThrowTrick started with velocity: ({:.2f}, {:.2f}, {:.2f})", 
-        throwVelocity.x, throwVelocity.y, throwVelocity.z);
+        launchVelocity.x, launchVelocity.y, launchVelocity.z);
     return true;
 }
 
-void ThrowTrick::ApplyThrowForces() {
-    // Store throw parameters for physics simulation
-    // No rigidbody needed - we'll handle physics manually like Triick
-    auto saberTransform = saberTrickModel->saber->get_transform();
-    if (saberTransform) {
-        // Detach from parent for free movement
-        saberTransform->SetParent(nullptr, true);
-        
-        Logger.debug("Saber detached for throw: velocity=({:.2f},{:.2f},{:.2f})", 
-            throwVelocity.x, throwVelocity.y, throwVelocity.z);
-    }
+void ThrowTrick::Arm() {
+    if (armed || active || !saberTrickModel || !saberTrickModel->saber) return;
+    
+    Prepare();
+    armed = true;
 }
 
-void ThrowTrick::CalculateThrowForces() {
-    // Use pooled calculation for complex throw physics
-    auto calculation = TrickSaber::Utils::PooledTrickCalculation();
-    if (!calculation.IsValid()) {
-        Logger.error("Failed to get pooled calculation for throw forces");
-        return;
-    }
+void ThrowTrick::Disarm() {
+    if (!armed) return;
     
-    // Get averaged velocity from movement controller (PC parity)
-    UnityEngine::Vector3 velocity;
-    UnityEngine::Vector3 angularVelocity;
+    armed = false;
+    ReleasePrepared();
+}
+
+void ThrowTrick::Prepare() {
+    saberTransform = saberTrickModel->saber->get_transform();
+    if (!saberTransform) return;
     
-    if (saberTrickModel && saberTrickModel->saber) {
-        bool isLeft = (saberTrickModel->saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
-        velocity = TrickSaber::MovementController::GetAverageVelocity(isLeft);
-        angularVelocity = TrickSaber::MovementController::GetAverageAngularVelocity(isLeft);
+    // Store the slot relative to the parent. The saber is still parented to
+    // the hand, so the slot is the same at arm and at press.
+    originalParent = saberTransform->get_parent();
+    if (originalParent) {
+        auto parentPos = Utils::ToNative(originalParent->get_position());
+        auto parentRot = Native::Conjugate(Utils::ToNative(originalParent->get_rotation()));
+        slotOffset = Native::Rotate(parentRot, Utils::ToNative(saberTransform->get_position()) - parentPos);
+        slotRotation = parentRot * Utils::ToNative(saberTransform->get_rotation());
     }
     
-    // Store in pooled calculation
-    calculation->velocity = velocity;
-    calculation->angularVelocity = angularVelocity;
-    calculation->isActive = true;
-    
-    if (TrickSaber::Configuration::IsSpeedVelocityDependent()) {
-        // Velocity-dependent mode: use actual controller movement
-        float velocityMultiplier = TrickSaber::Configuration::GetThrowVelocity();
-        throwVelocity = UnityEngine::Vector3::op_Multiply(velocity, velocityMultiplier * 2.0f);
-        
-        // Minimum throw velocity based on controller forward direction
-        if (throwVelocity.get_magnitude() < TrickSaber::Configuration::GetVelocityThreshold()) {
-            auto forward = saberTrickModel->saber->get_transform()->get_forward();
-            throwVelocity = UnityEngine::Vector3::op_Multiply(forward, 
-                TrickSaber::Configuration::GetVelocityThreshold() * velocityMultiplier);
-        }
-        
-        // Spin speed based on actual angular velocity
-        saberRotSpeed = angularVelocity.get_magnitude() * Constants::RADIANS_TO_DEGREES;
-        if (angularVelocity.x < 0) saberRotSpeed *= -1;
-    } else {
-        // Fixed velocity mode: use configured values
-        float velocityMultiplier = TrickSaber::config.throwVelocityMultiplier;
-        float baseVelocity = TrickSaber::Configuration::GetThrowVelocity();
-        
-        // Use controller direction but fixed magnitude
-        auto direction = velocity.get_normalized();
-        if (direction.get_magnitude() < 0.1f) {
-            direction = saberTrickModel->saber->get_transform()->get_forward();
-        }
-        
-        throwVelocity = UnityEngine::Vector3::op_Multiply(direction, baseVelocity * velocityMultiplier);
-        
-        // Fixed spin speed
-        saberRotSpeed = baseVelocity * Constants::SPIN_VELOCITY_SCALE;
-        if (angularVelocity.x < 0) saberRotSpeed *= -1;
-    }
+    armedParams = BuildParams();
+    saberTrickModel->Prepare();
+    hapticManager = TrickSaber::Utils::HapticFeedbackHelper::ResolveManager();
     
-    currentVelocity = throwVelocity;
+    if (!calculation) {
+        calculation.emplace();
+    }
     
-    Logger.debug("Throw calculated (velocity-dependent={}): velocity=({:.2f},{:.2f},{:.2f}), rotSpeed={:.1f}", 
-        TrickSaber::Configuration::IsSpeedVelocityDependent(),
-        throwVelocity.x, throwVelocity.y, throwVelocity.z, saberRotSpeed);
+    // Fallback for the press if the tracker has no samples around the edge
+    bool isLeft = (saberTrickModel->saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
+    hasVelocityEstimate = TrickSaber::MovementController::VelocityAt(isLeft,
+        TrickSaber::MovementController::GetTimestamp(), VelocityWindowMs(), estimatedVelocity, estimatedAngularVelocity);
 }
 
-void ThrowTrick::Update() {
-    if (!active || !saberTrickModel || !saberTrickModel->saber) return;
-    
-    switch (state) {
-        case ThrowState::Preparing:
-            // Initialization state, nothing to do
-            break;
-            
-        case ThrowState::Thrown:
-            if (TrickSaber::Configuration::IsSimplifiedInputEnabled()) {
-                UpdatePhysicsSimplified();
-            } else {
-                UpdatePhysics();
-            }
-            if (ShouldSnapBack()) {
-                state = ThrowState::Returning;
-                throwReleasePosition = saberTrickModel->saber->get_transform()->get_position();
-                throwReleaseRotation = saberTrickModel->saber->get_transform()->get_rotation();
-                returnTime = 0.0f;
-            }
-            break;
-            
-        case ThrowState::Returning:
-            if (TrickSaber::Configuration::IsSimplifiedInputEnabled()) {
-                UpdateReturnSimplified();
-            } else {
-                UpdateReturn();
-            }
-            break;
-            
-        case ThrowState::Snapping:
-            // Immediate snap back
-            EndTrickImmediately();
-            break;
-            
-        default:
-            break;
-    }
+void ThrowTrick::ReleasePrepared() {
+    calculation.reset();
+    hapticManager = nullptr;
+    hasVelocityEstimate = false;
 }
 
-void ThrowTrick::FixedUpdate() {
-    // Physics handled in Update() for simplicity
+float ThrowTrick::VelocityWindowMs() const {
+    return std::clamp(TrickSaber::config.throwVelocityWindowMs,
+        Constants::MIN_THROW_VELOCITY_WINDOW_MS, Constants::MAX_THROW_VELOCITY_WINDOW_MS);
 }
 
-void ThrowTrick::UpdatePhysics() {
-    // Manual physics simulation like Triick
-    auto saberTransform = saberTrickModel->saber->get_transform();
-    if (!saberTransform) return;
-    
-    float deltaTime = UnityEngine::Time::get_deltaTime();
-    
-    // Update position based on velocity
-    auto currentPos = saberTransform->get_position();
-    auto newPos = UnityEngine::Vector3::op_Addition(currentPos, 
-        UnityEngine::Vector3::op_Multiply(currentVelocity, deltaTime));
-    saberTransform->set_position(newPos);
-    
-    // Update rotation based on angular velocity
-    if (saberRotSpeed != 0.0f) {
-        float angle = saberRotSpeed * deltaTime;
-        auto axis = saberTransform->get_right(); // Spin around saber's right axis
-        auto deltaRotation = UnityEngine::Quaternion::AngleAxis(angle, axis);
-        saberTransform->set_rotation(UnityEngine::Quaternion::op_Multiply(
-            deltaRotation, saberTransform->get_rotation()));
-    }
+TrickSaber::Native::ThrowParams ThrowTrick::BuildParams() const {
+    Native::ThrowParams params;
+    params.velocityDependent = TrickSaber::Configuration::IsSpeedVelocityDependent();
+    params.simplified = TrickSaber::Configuration::IsSimplifiedInputEnabled();
+    params.throwVelocity = TrickSaber::Configuration::GetThrowVelocity();
+    params.throwVelocityMultiplier = TrickSaber::config.throwVelocityMultiplier;
+    params.velocityThreshold = TrickSaber::Configuration::GetVelocityThreshold();
+    params.returnDuration = config.returnDuration > 0 ? config.returnDuration : Constants::DEFAULT_RETURN_DURATION;
+    params.returnSpinMultiplier = TrickSaber::Configuration::GetReturnSpinMultiplier();
+    params.snapBackDistance = snapBackDistance;
+    params.gravityScale = TrickSaber::config.gravityScale;
+    params.airResistance = TrickSaber::config.airResistance;
+    params.angularDamping = TrickSaber::config.angularDamping;
+    params.maxThrowDistance = TrickSaber::config.maxThrowDistance;
+    return params;
 }
 
-void ThrowTrick::UpdateReturn() {
-    if (!originalParent || !saberTrickModel) return;
-    
-    auto saberTransform = saberTrickModel->saber->get_transform();
-    if (!saberTransform) return;
-    
-    float deltaTime = UnityEngine::Time::get_deltaTime();
-    returnTime += deltaTime;
-    
-    // Simple lerp return like Triick - more reliable
-    float t = UnityEngine::Mathf::Clamp01(returnTime / returnDuration);
+void ThrowTrick::ApplyThrowForces() {
+    // No rigidbody forces - the model integrates the flight like Triick.
+    // Detach from parent for free movement.
+    saberTransform->SetParent(nullptr, true);
+    Logger.debug("Saber detached for throw");
+}
+
+void ThrowTrick::CalculateThrowForces(const TrickSaber::Native::ThrowParams& params) {
+    // Pooled calculation is taken in Prepare. The launch does not depend on
+    // it, so the throw always leaves the Idle phase.
+    bool pooled = calculation && calculation->IsValid();
+    if (!pooled) {
+        Logger.error("Failed to get pooled calculation for throw forces");
+    }
     
-    // Target position in world space
-    auto targetPos = originalParent->TransformPoint(originalLocalPosition);
-    auto targetRot = UnityEngine::Quaternion::op_Multiply(originalParent->get_rotation(), originalLocalRotation);
+    // Get release velocity from movement controller
+    UnityEngine::Vector3 velocity;
+    UnityEngine::Vector3 angularVelocity;
     
-    // Smooth interpolation
-    auto currentPos = UnityEngine::Vector3::Lerp(throwReleasePosition, targetPos, t);
-    auto currentRot = UnityEngine::Quaternion::Slerp(throwReleaseRotation, targetRot, t);
+    bool isLeft = (saberTrickModel->saber->get_saberType() == GlobalNamespace::SaberType::SaberA);
+    
+    // Sample at the input edge over a fixed time window so throw strength
+    // does not depend on refresh rate or skipped ticks
+    double releaseTime = (manager && manager->lastInputEdgeTime > 0.0) ?
+        manager->lastInputEdgeTime : TrickSaber::MovementController::GetTimestamp();
+    if (TrickSaber::MovementController::VelocityAt(isLeft, releaseTime, VelocityWindowMs(), velocity, angularVelocity)) {
+        // Sampled at the edge
+    } else if (hasVelocityEstimate) {
+        velocity = estimatedVelocity;
+        angularVelocity = estimatedAngularVelocity;
+    } else {
+        velocity = TrickSaber::MovementController::GetAverageVelocity(isLeft);
+        angularVelocity = TrickSaber::MovementController::GetAverageAngularVelocity(isLeft);
+    }
     
-    // Apply return spin effects if configured
-    float returnSpinMultiplier = TrickSaber::Configuration::GetReturnSpinMultiplier();
-    if (returnSpinMultiplier > 0.0f) {
-        // Add spin during return based on original throw velocity
-        float spinSpeed = throwVelocity.get_magnitude() * returnSpinMultiplier * Constants::RETURN_SPIN_SCALE;
-        float spinAngle = spinSpeed * deltaTime;
-        
-        auto spinAxis = UnityEngine::Vector3::get_right(); // Spin around saber's right axis
-        auto spinRotation = UnityEngine::Quaternion::AngleAxis(spinAngle, spinAxis);
-        currentRot = UnityEngine::Quaternion::op_Multiply(currentRot, spinRotation);
+    // Store in pooled calculation
+    if (pooled) {
+        (*calculation)->velocity = velocity;
+        (*calculation)->angularVelocity = angularVelocity;
+        (*calculation)->isActive = true;
     }
     
-    saberTransform->set_position(currentPos);
-    saberTransform->set_rotation(currentRot);
+    auto launch = Native::ComputeThrowLaunch(params, Utils::ToNative(velocity), Utils::ToNative(angularVelocity),
+        Utils::ToNative(saberTransform->get_forward()));
+    model.Launch(params, Utils::ToNative(saberTransform->get_position()), Utils::ToNative(saberTransform->get_rotation()), launch);
     
-    // Complete return when close enough
-    if (t >= 1.0f) {
+    Logger.debug("Throw calculated (velocity-dependent={}): velocity=({:.2f},{:.2f},{:.2f}), rotSpeed={:.1f}", 
+        params.velocityDependent, launch.velocity.x, launch.velocity.y, launch.velocity.z, launch.spinSpeed);
+}
+
+void ThrowTrick::Tick() {
+    // Only called while active, so the model is Thrown or Returning and the
+    // transforms were checked in StartTrick
+    
+    // The saber slot the return lands in. Two transform reads a frame; the
+    // slot pose is native math.
+    auto handPos = Utils::ToNative(originalParent->get_position());
+    auto handRot = Utils::ToNative(originalParent->get_rotation());
+    auto targetPos = handPos + Native::Rotate(handRot, slotOffset);
+    auto targetRot = handRot * slotRotation;
+    
+    float deltaTime = Core::FrameClock::DeltaTime();
+    auto phase = model.Step(deltaTime, targetPos, targetRot);
+    ApplyModelPose();
+    if (TrickSaber::config.enableTrickCutting) CutNotes();
+    
+    if (phase == Native::ThrowPhase::Done) {
         ThrowEnd();
     }
 }
 
-bool ThrowTrick::ShouldSnapBack() {
-    if (!originalParent || !saberTrickModel) return true;
-    
-    auto trickTransform = saberTrickModel->GetTrickModelTransform();
-    if (!trickTransform) return true;
+void ThrowTrick::ApplyModelPose() {
+    // Blended between the last two fixed substeps
+    saberTransform->set_position(Utils::ToUnity(model.RenderPosition()));
+    saberTransform->set_rotation(Utils::ToUnity(model.RenderRotation()));
+}
+
+void ThrowTrick::CutNotes() {
+    // Blade from the rendered pose, without reading the blade transforms
+    auto rotation = model.RenderRotation();
+    auto base = model.RenderPosition();
+    auto tip = base + Native::Rotate(rotation, {0.0f, 0.0f, Constants::SABER_BLADE_LENGTH});
     
-    auto saberPos = trickTransform->get_position();
-    auto handPos = originalParent->get_position();
+    float songTime = TrickSaber::ThrownSaberCutter::SongTime();
     
-    float distance = UnityEngine::Vector3::Distance(saberPos, handPos);
-    return distance > (snapBackDistance > 0 ? snapBackDistance : Constants::DEFAULT_SNAP_BACK_DISTANCE);
+    if (hasBlade) {
+        TrickSaber::ThrownSaberCutter::Cut(saberTrickModel->saber, {bladeBase, bladeTip, base, tip}, rotation,
+            bladeSongTime, songTime);
+    }
+    bladeBase = base;
+    bladeTip = tip;
+    bladeSongTime = songTime;
+    hasBlade = true;
 }
 
-
-
 void ThrowTrick::EndTrick() {
     if (!active) return;
     
-    if (state == ThrowState::Thrown) {
-        // Start return sequence
-        state = ThrowState::Returning;
-        returnTime = 0.0f;
-        
-        if (saberTrickModel && saberTrickModel->saber) {
-            auto saberTransform = saberTrickModel->saber->get_transform();
-            throwReleasePosition = saberTransform->get_position();
-            throwReleaseRotation = saberTransform->get_rotation();
-        }
+    if (model.Phase() == Native::ThrowPhase::Thrown) {
+        // Start return sequence from the current pose
+        model.BeginReturn();
         
         // Trigger trick end haptic
         TrickSaber::Utils::HapticFeedbackHelper::TriggerHaptic(saberTrickModel->saber->get_saberType(), 
             TrickSaber::Utils::HapticFeedbackHelper::HapticType::TrickEnd);
         
-        // Physics disabled during return
-        
         Logger.debug("ThrowTrick: Starting return sequence");
-        return; // Don't end the trick yet, let Update() handle the return
+        return; // Don't end the trick yet, let Tick() handle the return
     }
     
-    // Reset velocity
-    currentVelocity = UnityEngine::Vector3::get_zero();
-    
     Logger.debug("ThrowTrick ended");
 }
 
@@ -303,6 +269,10 @@ void ThrowTrick::EndTrickImmediately() {
 }
 
 void ThrowTrick::ThrowEnd() {
+    model.Reset();
+    armed = false;
+    ReleasePrepared();
+    
     // Remove slowmo if it was applied
     if (TrickSaber::Configuration::IsSlowmoDuringThrow()) {
         auto coreManager = TrickSaber::Core::TrickSaberManager::GetInstance();
@@ -332,67 +302,3 @@ void ThrowTrick::ThrowEnd() {
     
     Trick::EndTrick();
 }
-
-// Simplified physics implementation
-void ThrowTrick::UpdatePhysicsSimplified() {
-    // Direct transform manipulation - no rigidbody
-    auto saberTransform = saberTrickModel->saber->get_transform();
-    if (!saberTransform) return;
-    
-    float deltaTime = UnityEngine::Time::get_deltaTime();
-    
-    // Simple forward movement with gravity
-    currentVelocity.y -= Constants::GRAVITY_ACCELERATION * deltaTime;
-    
-    auto newPos = UnityEngine::Vector3::op_Addition(saberTransform->get_position(), 
-        UnityEngine::Vector3::op_Multiply(currentVelocity, deltaTime));
-    saberTransform->set_position(newPos);
-    
-    // Simple spin
-    if (saberRotSpeed != 0.0f) {
-        float angle = saberRotSpeed * deltaTime;
-        auto axis = UnityEngine::Vector3::get_right();
-        auto deltaRotation = UnityEngine::Quaternion::AngleAxis(angle, axis);
-        saberTransform->set_rotation(UnityEngine::Quaternion::op_Multiply(
-            deltaRotation, saberTransform->get_rotation()));
-    }
-}
-
-void ThrowTrick::UpdateReturnSimplified() {
-    // Direct lerp - immediate and simple
-    if (!originalParent || !saberTrickModel) return;
-    
-    auto saberTransform = saberTrickModel->saber->get_transform();
-    if (!saberTransform) return;
-    
-    float deltaTime = UnityEngine::Time::get_deltaTime();
-    returnTime += deltaTime;
-    
-    // Faster return than PC version
-    float t = UnityEngine::Mathf::Clamp01(returnTime / Constants::SIMPLIFIED_RETURN_DURATION);
-    
-    auto targetPos = originalParent->TransformPoint(originalLocalPosition);
-    auto targetRot = UnityEngine::Quaternion::op_Multiply(originalParent->get_rotation(), originalLocalRotation);
-    
-    // Direct lerp - no easing
-    auto currentPos = UnityEngine::Vector3::Lerp(throwReleasePosition, targetPos, t);
-    auto currentRot = UnityEngine::Quaternion::Slerp(throwReleaseRotation, targetRot, t);
-    
-    // Apply return spin effects if configured (simplified version)
-    float returnSpinMultiplier = TrickSaber::Configuration::GetReturnSpinMultiplier();
-    if (returnSpinMultiplier > 0.0f) {
-        // Simpler spin calculation for simplified mode
-        float spinSpeed = throwVelocity.get_magnitude() * returnSpinMultiplier * Constants::SIMPLIFIED_RETURN_SPIN_SCALE;
-        float spinAngle = spinSpeed * deltaTime;
-        
-        auto spinRotation = UnityEngine::Quaternion::AngleAxis(spinAngle, UnityEngine::Vector3::get_right());
-        currentRot = UnityEngine::Quaternion::op_Multiply(currentRot, spinRotation);
-    }
-    
-    saberTransform->set_position(currentPos);
-    saberTransform->set_rotation(currentRot);
-    
-    if (t >= 1.0f) {
-        ThrowEnd();
-    }
-}
\ No newline at end of file
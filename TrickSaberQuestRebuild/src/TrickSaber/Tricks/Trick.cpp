@@ -15,7 +15,7 @@ bool Trick::StartTrick(float value) {
     return true;
 }
 
-void Trick::Update() {
+void Trick::Tick() {
     // Base implementation - override in derived classes
 }
 
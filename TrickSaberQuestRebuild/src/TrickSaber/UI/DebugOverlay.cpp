@@ -1,4 +1,5 @@
 #include "TrickSaber/UI/DebugOverlay.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/Configuration.hpp"
 #include "TrickSaber/GlobalTrickManager.hpp"
 #include "TrickSaber/Constants.hpp"
@@ -49,7 +50,7 @@ namespace TrickSaber::UI {
     void DebugOverlay::Update() {
         if (!canvas || !canvas->get_enabled()) return;
         
-        updateTimer += UnityEngine::Time::get_deltaTime();
+        updateTimer += Core::FrameClock::DeltaTime();
         if (updateTimer >= 0.5f) {
             UpdateStats();
             updateTimer = 0.0f;
@@ -128,7 +129,8 @@ namespace TrickSaber::UI {
     }
     
     void UpdateDebugStats() {
-        currentStats.fps = 1.0f / UnityEngine::Time::get_deltaTime();
+        float deltaTime = Core::FrameClock::DeltaTime();
+        currentStats.fps = deltaTime > 0.0f ? 1.0f / deltaTime : 0.0f;
         currentStats.tricksEnabled = Configuration::IsModEnabled();
         
         // Get active trick counts from GlobalTrickManager
@@ -1,4 +1,5 @@
 #include "TrickSaber/Utils/Coroutines.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/Core/TrickSaberManager.hpp"
 #include "UnityEngine/Vector3.hpp"
 
@@ -10,7 +11,7 @@ Coroutine TrickSaber::Utils::LerpToOriginalRotation(UnityEngine::Transform* tran
     auto identity = UnityEngine::Quaternion::get_identity();
     
     while (UnityEngine::Quaternion::Angle(rot, identity) > 5.0f) {
-        rot = UnityEngine::Quaternion::Lerp(rot, identity, UnityEngine::Time::get_deltaTime() * 20.0f);
+        rot = UnityEngine::Quaternion::Lerp(rot, identity, TrickSaber::Core::FrameClock::DeltaTime() * 20.0f);
         transform->set_localRotation(rot);
         co_yield reinterpret_cast<System::Collections::IEnumerator*>(UnityEngine::WaitForEndOfFrame::New_ctor());
     }
@@ -1,26 +1,56 @@
 #include "TrickSaber/Utils/HapticFeedbackHelper.hpp"
 #include "TrickSaber/Utils/ObjectCache.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
 #include "TrickSaber/Config.hpp"
 #include "UnityEngine/XR/XRNode.hpp"
 #include "main.hpp"
 
 using namespace TrickSaber::Utils;
 
+namespace {
+    GlobalNamespace::SaberType HandSaberType(uint8_t hand) {
+        return hand == TrickSaber::Native::LeftHand ? GlobalNamespace::SaberType::SaberA : GlobalNamespace::SaberType::SaberB;
+    }
+}
+
 void HapticFeedbackHelper::TriggerHaptic(GlobalNamespace::SaberType saberType, HapticType type) {
     auto params = GetHapticParams(type);
     TriggerHaptic(saberType, params.duration, params.strength);
 }
 
 void HapticFeedbackHelper::TriggerHaptic(GlobalNamespace::SaberType saberType, float duration, float strength) {
-    // Use cached haptic controller for performance
+    Play(ResolveManager(), saberType, strength);
+}
+
+void HapticFeedbackHelper::TriggerHaptic(GlobalNamespace::HapticFeedbackManager* manager, GlobalNamespace::SaberType saberType, HapticType type) {
+    Play(manager ? manager : ResolveManager(), saberType, GetHapticParams(type).strength);
+}
+
+void HapticFeedbackHelper::SubscribeTrickEvents() {
+    Core::TrickEvents::Subscribe<Native::TrickStartedEvent>(&HapticFeedbackHelper::OnTrickStarted);
+    Core::TrickEvents::Subscribe<Native::TrickEndedEvent>(&HapticFeedbackHelper::OnTrickEnded);
+}
+
+void HapticFeedbackHelper::OnTrickStarted(void*, const Native::TrickStartedEvent& event) {
+    TriggerHaptic(HandSaberType(event.hand), HapticType::TrickStart);
+}
+
+void HapticFeedbackHelper::OnTrickEnded(void*, const Native::TrickEndedEvent& event) {
+    TriggerHaptic(HandSaberType(event.hand), HapticType::SaberReturn);
+}
+
+GlobalNamespace::HapticFeedbackManager* HapticFeedbackHelper::ResolveManager() {
+    // The cache already scans on a miss and is warmed before gameplay;
+    // disabled haptics are not a miss and must not rescan every trick
     auto hapticManager = ObjectCache::GetHapticController();
     if (!hapticManager || !hapticManager->hapticFeedbackEnabled) {
-        // Fallback to FindObjectOfType if cache miss
-        hapticManager = UnityEngine::Object::FindObjectOfType<GlobalNamespace::HapticFeedbackManager*>();
-        if (!hapticManager || !hapticManager->hapticFeedbackEnabled) {
-            return;
-        }
+        return nullptr;
     }
+    return hapticManager;
+}
+
+void HapticFeedbackHelper::Play(GlobalNamespace::HapticFeedbackManager* hapticManager, GlobalNamespace::SaberType saberType, float strength) {
+    if (!hapticManager || !hapticManager->hapticFeedbackEnabled) return;
     
     // Apply config intensity multiplier
     float finalStrength = strength * config.hapticIntensity;
@@ -26,13 +26,10 @@ void ObjectCache::CleanupExpiredEntries() {
     if (!lazyCache.IsInitialized()) return;
     
     auto& cache = lazyCache.GetMutable();
-    auto now = std::chrono::steady_clock::now();
     size_t removedCount = 0;
     
     for (auto it = cache.begin(); it != cache.end();) {
-        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - it->second.timestamp).count();
-        
-        if (elapsed >= CACHE_TIMEOUT_SECONDS || !IsObjectValid(it->second.object)) {
+        if (!IsObjectValid(it->second.object)) {
             it = cache.erase(it);
             removedCount++;
         } else {
@@ -77,6 +74,7 @@ void ObjectCache::ClearCache() {
     auto& cache = lazyCache.GetMutable();
     size_t clearedCount = cache.size();
     cache.clear();
+    LazyCacheWarmer::Reset();
     Logger.debug("ObjectCache cleared {} entries", clearedCount);
 }
 
@@ -111,4 +109,8 @@ void LazyCacheWarmer::WarmCache() {
 
 bool LazyCacheWarmer::IsWarmed() {
     return warmer.IsInitialized();
+}
+
+void LazyCacheWarmer::Reset() {
+    warmer.Reset();
 }
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include "TrickSaber/Utils/PerformanceMetrics.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
+#include "TrickSaber/MovementController.hpp"
 #include "main.hpp"
 #include "UnityEngine/Time.hpp"
 #include "UnityEngine/SystemInfo.hpp"
@@ -11,9 +14,11 @@ LazyInitializer<PerformanceMetrics> PerformanceMetrics::lazyInstance(
     []() -> std::unique_ptr<PerformanceMetrics> {
         Logger.debug("Initializing PerformanceMetrics on first access");
         auto instance = std::make_unique<PerformanceMetrics>();
-        instance->startTime = std::chrono::high_resolution_clock::now();
+        instance->startTime = std::chrono::steady_clock::now();
         instance->lastFrameTime = instance->startTime;
         instance->lastReport = instance->startTime;
+        TrickSaber::Core::TrickEvents::Subscribe<TrickSaber::Native::TrickEndedEvent>(
+            &PerformanceMetrics::OnTrickEnded, instance.get());
         return instance;
     }
 );
@@ -28,10 +33,22 @@ bool PerformanceMetrics::IsInitialized() {
     return lazyInstance.IsInitialized();
 }
 
+void PerformanceMetrics::OnTrickEnded(void* context, const TrickSaber::Native::TrickEndedEvent& event) {
+    auto* metrics = static_cast<PerformanceMetrics*>(context);
+    if (event.action == TrickSaber::TrickAction::Throw) {
+        auto velocity = event.hand == TrickSaber::Native::LeftHand ?
+            TrickSaber::MovementController::GetLeftVelocity() : TrickSaber::MovementController::GetRightVelocity();
+        metrics->RecordThrowTrick(velocity.get_magnitude(), event.duration);
+    } else if (event.action == TrickSaber::TrickAction::Spin) {
+        metrics->RecordSpinTrick(event.duration);
+    }
+}
+
 void PerformanceMetrics::UpdateFrameMetrics() {
     if (!enabled) return;
     
-    auto currentTime = std::chrono::high_resolution_clock::now();
+    // Frame start to frame start, on the same clock reading every consumer sees
+    auto currentTime = Core::FrameClock::SteadyNow();
     auto frameDuration = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastFrameTime);
     
     frameMetrics.frameTime = frameDuration.count() / 1000.0f; // Convert to milliseconds
@@ -149,7 +166,7 @@ float PerformanceMetrics::EndTimer(const std::string& name) {
 void PerformanceMetrics::LogPerformanceReport() {
     if (!enabled) return;
     
-    auto currentTime = std::chrono::high_resolution_clock::now();
+    auto currentTime = std::chrono::steady_clock::now();
     auto uptime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - startTime);
     
     Logger.info("=== TrickSaber Performance Report (Uptime: {}s) ===", uptime.count());
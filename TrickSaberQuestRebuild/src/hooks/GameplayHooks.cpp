@@ -1,11 +1,14 @@
 #include "main.hpp"
 #include "beatsaber-hook/shared/utils/hooking.hpp"
 #include "TrickSaber/Core/StateManager.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/ControllerCache.hpp"
 #include "TrickSaber/GlobalTrickManager.hpp"
 #include "TrickSaber/MovementController.hpp"
 #include "TrickSaber/Utils/PerformanceMetrics.hpp"
 #include "TrickSaber/Utils/LazyInitializer.hpp"
 #include "TrickSaber/Constants.hpp"
+#include "TrickSaber/ThrownSaberCutter.hpp"
 #include "GlobalNamespace/BeatmapObjectSpawnController.hpp"
 #include "GlobalNamespace/BeatmapObjectManager.hpp"
 #include "GlobalNamespace/GamePause.hpp"
@@ -14,7 +17,6 @@
 #include "GlobalNamespace/NoteController.hpp"
 #include "GlobalNamespace/NoteData.hpp"
 #include "GlobalNamespace/NoteCutInfo.hpp"
-#include "GlobalNamespace/VRController.hpp"
 #include "beatsaber-hook/shared/utils/byref.hpp"
 #include "UnityEngine/Time.hpp"
 
@@ -39,12 +41,26 @@ MAKE_HOOK_MATCH(BeatmapObjectSpawnController_HandleNoteDataCallback,
     }
 }
 
+// From here until cut or missed the note follows a fixed jump arc, so it is
+// tracked for thrown-saber cutting without per-frame updates
+MAKE_HOOK_MATCH(BeatmapObjectManager_HandleNoteControllerNoteDidStartJump, 
+    &GlobalNamespace::BeatmapObjectManager::HandleNoteControllerNoteDidStartJump, void, 
+    GlobalNamespace::BeatmapObjectManager* self, GlobalNamespace::NoteController* noteController) {
+    
+    BeatmapObjectManager_HandleNoteControllerNoteDidStartJump(self, noteController);
+    
+    if (TrickSaber::config.enableTrickCutting) {
+        TrickSaber::ThrownSaberCutter::OnNoteDidStartJump(noteController);
+    }
+}
+
 MAKE_HOOK_MATCH(BeatmapObjectManager_HandleNoteControllerNoteWasCut, 
     &GlobalNamespace::BeatmapObjectManager::HandleNoteControllerNoteWasCut, void, 
     GlobalNamespace::BeatmapObjectManager* self, GlobalNamespace::NoteController* noteController, 
     ByRef<GlobalNamespace::NoteCutInfo> noteCutInfo) {
     
     BeatmapObjectManager_HandleNoteControllerNoteWasCut(self, noteController, noteCutInfo);
+    TrickSaber::ThrownSaberCutter::OnNoteRemoved(noteController);
     
     if (TrickSaber::config.disableIfNotesOnScreen) {
         auto stateManager = TrickSaber::Core::StateManager::GetInstance();
@@ -59,6 +75,7 @@ MAKE_HOOK_MATCH(BeatmapObjectManager_HandleNoteControllerNoteWasMissed,
     GlobalNamespace::BeatmapObjectManager* self, GlobalNamespace::NoteController* noteController) {
     
     BeatmapObjectManager_HandleNoteControllerNoteWasMissed(self, noteController);
+    TrickSaber::ThrownSaberCutter::OnNoteRemoved(noteController);
     
     if (TrickSaber::config.disableIfNotesOnScreen) {
         auto stateManager = TrickSaber::Core::StateManager::GetInstance();
@@ -97,9 +114,8 @@ MAKE_HOOK_MATCH(GamePause_Resume, &GlobalNamespace::GamePause::Resume, void, Glo
 MAKE_HOOK_MATCH(OculusVRHelper_FixedUpdate, &GlobalNamespace::OculusVRHelper::FixedUpdate, void, GlobalNamespace::OculusVRHelper* self) {
     OculusVRHelper_FixedUpdate(self);
     
-    auto stateManager = TrickSaber::Core::StateManager::GetInstance();
-    auto saberManager = stateManager->GetSaberManager();
-    if (!TrickSaber::config.trickSaberEnabled || !saberManager) return;
+    const auto& slots = TrickSaber::Core::ControllerCache::GetSlots();
+    if (!TrickSaber::config.trickSaberEnabled || !slots.saberManager) return;
     
     static int fixedUpdateCounter = 0;
     fixedUpdateCounter++;
@@ -109,64 +125,27 @@ MAKE_HOOK_MATCH(OculusVRHelper_FixedUpdate, &GlobalNamespace::OculusVRHelper::Fi
         return;
     }
     
+    // Fixed phase: never stamps the frame clock, whose deltaTime would be the fixed step here
     float deltaTime = UnityEngine::Time::get_fixedDeltaTime();
     if (deltaTime <= TrickSaber::Constants::MIN_DELTA_TIME) deltaTime = TrickSaber::Constants::FALLBACK_DELTA_TIME;
     
-    auto leftSaber = saberManager->get_leftSaber();
-    auto rightSaber = saberManager->get_rightSaber();
-    
-    UnityEngine::Transform* leftHand = nullptr;
-    UnityEngine::Transform* rightHand = nullptr;
-    
-    if (leftSaber) {
-        auto leftController = leftSaber->get_transform()->GetComponentInParent<GlobalNamespace::VRController*>();
-        if (leftController) leftHand = leftController->get_transform();
-    }
-    
-    if (rightSaber) {
-        auto rightController = rightSaber->get_transform()->GetComponentInParent<GlobalNamespace::VRController*>();
-        if (rightController) rightHand = rightController->get_transform();
-    }
-    
-    TrickSaber::MovementController::UpdateVelocities(leftHand, rightHand, deltaTime);
+    TrickSaber::Core::ControllerCache::RecordTick();
+    TrickSaber::MovementController::UpdateVelocities(slots.leftHand, slots.rightHand, deltaTime);
 }
 
 MAKE_HOOK_MATCH(AudioTimeSyncController_Update, &GlobalNamespace::AudioTimeSyncController::Update, void, GlobalNamespace::AudioTimeSyncController* self) {
     AudioTimeSyncController_Update(self);
     
-    auto stateManager = TrickSaber::Core::StateManager::GetInstance();
-    auto saberManager = stateManager->GetSaberManager();
-    if (!TrickSaber::config.trickSaberEnabled || !saberManager) return;
+    if (!TrickSaber::config.trickSaberEnabled || !TrickSaber::Core::ControllerCache::GetSlots().saberManager) return;
     
     static int updateCounter = 0;
-    static float lastActiveTime = 0.0f;
-    static bool wasDoingTrick = false;
-    
     updateCounter++;
-    float currentTime = UnityEngine::Time::get_time();
     
+    // Tricks are ticked by TrickDriver; only the metrics cadence lives here
     auto globalManager = TrickSaber::GlobalTrickManager::GetInstance();
     if (!globalManager) return;
     
     bool isDoingTrick = globalManager->IsDoingTrick();
-    bool trickStateChanged = isDoingTrick != wasDoingTrick;
-    
-    if (isDoingTrick || trickStateChanged) {
-        lastActiveTime = currentTime;
-        SafeExecute([globalManager]() {
-            globalManager->UpdateTricks();
-        }, "Trick update execution");
-    }
-    else {
-        float idleTime = currentTime - lastActiveTime;
-        int skipInterval = idleTime > 2.0f ? 15 : TrickSaber::Constants::TRICK_UPDATE_IDLE_INTERVAL;
-        
-        if (updateCounter % skipInterval == 0) {
-            SafeExecute([globalManager]() {
-                globalManager->UpdateTricks();
-            }, "Trick update execution");
-        }
-    }
     
     if (updateCounter % TrickSaber::Constants::PERFORMANCE_UPDATE_INTERVAL_FRAMES == 0) {
         if (TrickSaber::Utils::PerformanceMetrics::IsInitialized()) {
@@ -177,12 +156,11 @@ MAKE_HOOK_MATCH(AudioTimeSyncController_Update, &GlobalNamespace::AudioTimeSyncC
             TrickSaber::Utils::LazyPerformanceSetup::Setup();
         }
     }
-    
-    wasDoingTrick = isDoingTrick;
 }
 
 void InstallGameplayHooks() {
     INSTALL_HOOK(Logger, BeatmapObjectSpawnController_HandleNoteDataCallback);
+    INSTALL_HOOK(Logger, BeatmapObjectManager_HandleNoteControllerNoteDidStartJump);
     INSTALL_HOOK(Logger, BeatmapObjectManager_HandleNoteControllerNoteWasCut);
     INSTALL_HOOK(Logger, BeatmapObjectManager_HandleNoteControllerNoteWasMissed);
     INSTALL_HOOK(Logger, GamePause_Pause);
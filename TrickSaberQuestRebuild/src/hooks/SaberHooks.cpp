@@ -1,12 +1,17 @@
 #include "main.hpp"
 #include "beatsaber-hook/shared/utils/hooking.hpp"
 #include "TrickSaber/Core/StateManager.hpp"
+#include "TrickSaber/Core/ControllerCache.hpp"
+#include "TrickSaber/Core/SessionTrace.hpp"
 #include "TrickSaber/Core/TrickSaberManager.hpp"
 #include "TrickSaber/GlobalTrickManager.hpp"
+#include "TrickSaber/TrickDriver.hpp"
 #include "TrickSaber/EnhancedSaberManager.hpp"
 #include "TrickSaber/AdvancedInputSystem.hpp"
 #include "TrickSaber/AdvancedTrickFeatures.hpp"
 #include "TrickSaber/BurnMarkHandler.hpp"
+#include "TrickSaber/ThrownSaberCutter.hpp"
+#include "TrickSaber/Utils/HapticFeedbackHelper.hpp"
 #include "TrickSaber/Utils/MemoryManager.hpp"
 #include "TrickSaber/Utils/ObjectCache.hpp"
 #include "GlobalNamespace/SaberManager.hpp"
@@ -37,6 +42,8 @@ MAKE_HOOK_MATCH(SaberManager_Start, &GlobalNamespace::SaberManager::Start, void,
     
     auto stateManager = TrickSaber::Core::StateManager::GetInstance();
     stateManager->SetSaberManager(self);
+    TrickSaber::Core::ControllerCache::Resolve(self);
+    TrickSaber::Core::SessionTrace::Begin();
     
     if (!self || !TrickSaber::config.trickSaberEnabled || stateManager->IsInitialized()) {
         return;
@@ -52,9 +59,15 @@ MAKE_HOOK_MATCH(SaberManager_Start, &GlobalNamespace::SaberManager::Start, void,
         // Initialize core TrickSaber systems without custom components
         // Custom components will be initialized later when needed
         
+        // Scene lookups happen here, before the saber managers register,
+        // which is where SaberManagerRegistry considers gameplay to begin
+        TrickSaber::Utils::LazyCacheWarmer::WarmCache();
+        TrickSaber::BurnMarkHandler::Initialize();
+        TrickSaber::Utils::HapticFeedbackHelper::SubscribeTrickEvents();
         TrickSaber::Core::TrickSaberManager::Initialize(self, audioController);
         TrickSaber::GlobalTrickManager::Initialize(audioController);
-        TrickSaber::BurnMarkHandler::Initialize();
+        TrickSaber::ThrownSaberCutter::Initialize(audioController);
+        TrickSaber::TrickDriver::Initialize();
         TrickSaber::Utils::MemoryManager::Initialize();
         
         stateManager->SetInitialized(true);
@@ -1,10 +1,18 @@
 #include "main.hpp"
 #include "beatsaber-hook/shared/utils/hooking.hpp"
 #include "TrickSaber/Core/StateManager.hpp"
+#include "TrickSaber/Core/ControllerCache.hpp"
+#include "TrickSaber/Core/ChordService.hpp"
+#include "TrickSaber/Core/InputSnapshot.hpp"
+#include "TrickSaber/Core/SaberManagerRegistry.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
+#include "TrickSaber/Core/SessionTrace.hpp"
+#include "TrickSaber/Core/TrickEvents.hpp"
 #include "TrickSaber/GlobalTrickManager.hpp"
 #include "UnityEngine/SceneManagement/SceneManager.hpp"
 #include "UnityEngine/SceneManagement/Scene.hpp"
 #include "UnityEngine/SceneManagement/LoadSceneMode.hpp"
+#include "GlobalNamespace/VRController.hpp"
 
 extern bool SafeExecute(const std::function<void()>& func, const char* context);
 extern void PerformComprehensiveCleanup();
@@ -12,6 +20,14 @@ extern void PerformComprehensiveCleanup();
 MAKE_HOOK_MATCH(SceneManager_Internal_ActiveSceneChanged, &UnityEngine::SceneManagement::SceneManager::Internal_ActiveSceneChanged, void, 
     UnityEngine::SceneManagement::Scene previousActiveScene, UnityEngine::SceneManagement::Scene newActiveScene) {
     
+    TrickSaber::Core::ControllerCache::Invalidate();
+    TrickSaber::Core::InputSnapshotService::Invalidate();
+    TrickSaber::Core::FrameClock::Invalidate();
+    TrickSaber::Core::ChordService::Invalidate();
+    TrickSaber::Core::SaberManagerRegistry::Invalidate();
+    TrickSaber::Core::TrickEvents::Invalidate();
+    TrickSaber::Core::SessionTrace::End();
+    
     auto stateManager = TrickSaber::Core::StateManager::GetInstance();
     if (stateManager->IsInitialized()) {
         SafeExecute([]() {
@@ -28,6 +44,7 @@ MAKE_HOOK_MATCH(SceneManager_Internal_ActiveSceneChanged, &UnityEngine::SceneMan
 
 MAKE_HOOK_MATCH(SceneManager_SetActiveScene, &UnityEngine::SceneManagement::SceneManager::SetActiveScene, bool, UnityEngine::SceneManagement::Scene scene) {
     SafeExecute([]() {
+        TrickSaber::Core::ControllerCache::Invalidate();
         auto stateManager = TrickSaber::Core::StateManager::GetInstance();
         stateManager->Reset();
     }, "Scene change cleanup");
@@ -37,6 +54,7 @@ MAKE_HOOK_MATCH(SceneManager_SetActiveScene, &UnityEngine::SceneManagement::Scen
 
 MAKE_HOOK_MATCH(SceneManager_Internal_SceneLoaded, &UnityEngine::SceneManagement::SceneManager::Internal_SceneLoaded, void, UnityEngine::SceneManagement::Scene scene, UnityEngine::SceneManagement::LoadSceneMode mode) {
     SafeExecute([]() {
+        TrickSaber::Core::ControllerCache::Invalidate();
         auto stateManager = TrickSaber::Core::StateManager::GetInstance();
         stateManager->Reset();
     }, "Scene load cleanup");
@@ -44,9 +62,17 @@ MAKE_HOOK_MATCH(SceneManager_Internal_SceneLoaded, &UnityEngine::SceneManagement
     SceneManager_Internal_SceneLoaded(scene, mode);
 }
 
+// Runs every frame in the menu and in gameplay, so the frame clock is
+// stamped in every scene, not only once TrickDriver exists
+MAKE_HOOK_MATCH(VRController_Update, &GlobalNamespace::VRController::Update, void, GlobalNamespace::VRController* self) {
+    TrickSaber::Core::FrameClock::BeginFrame();
+    VRController_Update(self);
+}
+
 void InstallSceneHooks() {
     INSTALL_HOOK(Logger, SceneManager_Internal_ActiveSceneChanged);
     INSTALL_HOOK(Logger, SceneManager_SetActiveScene);
     INSTALL_HOOK(Logger, SceneManager_Internal_SceneLoaded);
+    INSTALL_HOOK(Logger, VRController_Update);
     Logger.info("Scene hooks installed");
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "main.hpp"
 #include "TrickSaber/Constants.hpp"
+#include "TrickSaber/Core/FrameClock.hpp"
 #include "TrickSaber/Utils/ErrorCircuitBreaker.hpp"
 
 #include "scotland2/shared/modloader.h"
@@ -100,8 +101,8 @@ void ValidateCacheIfNeeded() {
     static float avgFrameTime = TrickSaber::Constants::FRAME_TIME_MS;
     static int validationCounter = 0;
     
-    float currentTime = UnityEngine::Time::get_time();
-    float deltaTime = UnityEngine::Time::get_deltaTime();
+    float currentTime = TrickSaber::Core::FrameClock::Time();
+    float deltaTime = TrickSaber::Core::FrameClock::DeltaTime();
     
     // Smooth frame time averaging for better load detection
     float currentFrameTime = deltaTime * 1000.0f;
@@ -113,11 +114,6 @@ void ValidateCacheIfNeeded() {
     auto globalManager = TrickSaber::GlobalTrickManager::GetInstance();
     bool isActive = globalManager && globalManager->IsDoingTrick();
     
-    // Warm cache on first trick activation
-    if (isActive && !TrickSaber::Utils::LazyCacheWarmer::IsWarmed()) {
-        TrickSaber::Utils::LazyCacheWarmer::WarmCache();
-    }
-    
     float baseInterval = TrickSaber::Constants::CACHE_VALIDATION_INTERVAL_SEC;
     float adaptiveInterval = isActive ? 
         baseInterval * (1.0f + loadFactor * 0.5f) :  // Less aggressive scaling when active
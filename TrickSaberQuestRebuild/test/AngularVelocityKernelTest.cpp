@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/AngularVelocityKernel.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    struct DVec3 { double x, y, z; };
+
+    // Double-precision reference: rotation vector of current * inverse(prev) over dt
+    DVec3 ReferenceAngularVelocity(const Quat& prev, const Quat& current, double dt) {
+        double px = prev.x, py = prev.y, pz = prev.z, pw = prev.w;
+        double cx = current.x, cy = current.y, cz = current.z, cw = current.w;
+        double qx = cw * -px + cx * pw + cy * -pz - cz * -py;
+        double qy = cw * -py + cy * pw + cz * -px - cx * -pz;
+        double qz = cw * -pz + cz * pw + cx * -py - cy * -px;
+        double qw = cw * pw - cx * -px - cy * -py - cz * -pz;
+        if (qw < 0.0) { qx = -qx; qy = -qy; qz = -qz; qw = -qw; }
+        double len = std::sqrt(qx * qx + qy * qy + qz * qz);
+        double scale = len < 1e-300 ? 2.0 : 2.0 * std::atan2(len, qw) / len;
+        return {qx * scale / dt, qy * scale / dt, qz * scale / dt};
+    }
+
+    // The previous MovementController path (acos/sin with a near-identity cutoff)
+    Vec3 LegacyAngularVelocity(const Quat& prev, const Quat& current, float dt) {
+        Quat q = current * Conjugate(prev);
+        if (std::abs(q.w) > 1023.5f / 1024.0f) return Zero3();
+        float gain;
+        if (q.w < 0.0f) {
+            float angle = std::acos(-q.w);
+            gain = -2.0f * angle / (std::sin(angle) * dt);
+        } else {
+            float angle = std::acos(q.w);
+            gain = 2.0f * angle / (std::sin(angle) * dt);
+        }
+        return {q.x * gain, q.y * gain, q.z * gain};
+    }
+
+    Quat RandomRotation(std::mt19937& rng) {
+        std::normal_distribution<float> n(0.0f, 1.0f);
+        return Normalize({n(rng), n(rng), n(rng), n(rng)});
+    }
+}
+
+class AngularVelocityKernelTest : public ::testing::Test {
+protected:
+    std::mt19937 rng{1234};
+    static constexpr float dt = 1.0f / 90.0f;
+};
+
+TEST_F(AngularVelocityKernelTest, RatioMatchesReferenceWithinDocumentedBound) {
+    double worst = 0.0;
+    for (int i = 0; i <= 100000; ++i) {
+        double w = i / 100000.0;
+        double exact = w >= 1.0 ? 1.0 : std::acos(w) / std::sqrt(1.0 - w * w);
+        double rel = std::abs(HalfAngleRatio(static_cast<float>(w)) - exact) / exact;
+        worst = std::max(worst, rel);
+    }
+    std::printf("[ BENCH    ] HalfAngleRatio max relative error %.3g\n", worst);
+    EXPECT_LT(worst, 3.5e-6);
+}
+
+TEST_F(AngularVelocityKernelTest, MatchesDoubleReferenceForRandomRotations) {
+    std::uniform_real_distribution<float> angle(0.0f, 3.1f);
+    double worst = 0.0;
+    for (int i = 0; i < 20000; ++i) {
+        Quat prev = RandomRotation(rng);
+        Quat step = AxisAngle(Normalized({angle(rng) - 1.5f, angle(rng) - 1.5f, angle(rng) - 1.5f}), angle(rng));
+        Quat current = Normalize(step * prev);
+
+        Vec3 fast = AngularVelocity(prev, current, dt);
+        DVec3 ref = ReferenceAngularVelocity(prev, current, dt);
+        double refLen = std::sqrt(ref.x * ref.x + ref.y * ref.y + ref.z * ref.z);
+        double err = std::sqrt((fast.x - ref.x) * (fast.x - ref.x) + (fast.y - ref.y) * (fast.y - ref.y) +
+                               (fast.z - ref.z) * (fast.z - ref.z));
+        worst = std::max(worst, err / std::max(refLen, 1.0));
+    }
+    std::printf("[ BENCH    ] AngularVelocity2 max error vs double %.3g (relative, floor 1 rad/s)\n", worst);
+    EXPECT_LT(worst, 1e-4);
+}
+
+TEST_F(AngularVelocityKernelTest, StableNearIdentity) {
+    // Tiny per-tick rotations that the old cutoff zeroed out
+    for (float angle : {0.0f, 1e-6f, 1e-4f, 1e-3f, 0.01f, 0.05f}) {
+        Quat prev = AxisAngle({0.0f, 1.0f, 0.0f}, 0.7f);
+        Quat current = AxisAngle({0.0f, 1.0f, 0.0f}, 0.7f + angle);
+        Vec3 w = AngularVelocity(prev, current, dt);
+        EXPECT_TRUE(std::isfinite(w.x) && std::isfinite(w.y) && std::isfinite(w.z));
+        EXPECT_NEAR(w.y, angle / dt, 1e-3f + angle / dt * 1e-3f) << angle;
+    }
+}
+
+TEST_F(AngularVelocityKernelTest, TakesShortestArc) {
+    Quat prev = IdentityQuat();
+    Quat current = AxisAngle({1.0f, 0.0f, 0.0f}, 0.5f);
+    Quat negated{-current.x, -current.y, -current.z, -current.w};
+    Vec3 a = AngularVelocity(prev, current, dt);
+    Vec3 b = AngularVelocity(prev, negated, dt);
+    EXPECT_NEAR(a.x, 0.5f / dt, 1e-2f);
+    EXPECT_NEAR(b.x, a.x, 1e-3f);
+}
+
+TEST_F(AngularVelocityKernelTest, ProcessesBothHandsIndependently) {
+    Quat prev[2] = {IdentityQuat(), IdentityQuat()};
+    Quat current[2] = {AxisAngle({0.0f, 0.0f, 1.0f}, 0.2f), AxisAngle({0.0f, 1.0f, 0.0f}, -0.1f)};
+    Vec3 out[2];
+    AngularVelocity2(prev, current, 1.0f / dt, out);
+    EXPECT_NEAR(out[0].z, 0.2f / dt, 1e-3f);
+    EXPECT_NEAR(out[0].y, 0.0f, 1e-5f);
+    EXPECT_NEAR(out[1].y, -0.1f / dt, 1e-3f);
+    EXPECT_NEAR(out[1].z, 0.0f, 1e-5f);
+}
+
+// Both hands per call, as MovementController does once per physics tick
+TEST_F(AngularVelocityKernelTest, BenchmarkAgainstAcosSin) {
+    std::vector<Quat> rotations(256);
+    for (auto& q : rotations) q = RandomRotation(rng);
+
+    double fastNs = MeasureNsPerOp([&](int i) {
+        Quat prev[2] = {rotations[i & 255], rotations[(i + 1) & 255]};
+        Quat current[2] = {rotations[(i + 2) & 255], rotations[(i + 3) & 255]};
+        Vec3 out[2];
+        AngularVelocity2(prev, current, 90.0f, out);
+        DoNotOptimize(out);
+    }, 500000);
+
+    double legacyNs = MeasureNsPerOp([&](int i) {
+        Vec3 left = LegacyAngularVelocity(rotations[i & 255], rotations[(i + 2) & 255], dt);
+        Vec3 right = LegacyAngularVelocity(rotations[(i + 1) & 255], rotations[(i + 3) & 255], dt);
+        DoNotOptimize(left);
+        DoNotOptimize(right);
+    }, 500000);
+
+    ReportNs("AngularVelocity2 (both hands)", fastNs);
+    ReportNs("acos/sin path (both hands)", legacyNs);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// Tiny timing helpers for the host microbenchmarks. Results are printed, not
+// asserted against absolute numbers; build with --build-type Release for
+// meaningful figures.
+
+namespace TrickSaber::Testing {
+    // Keeps the optimizer from discarding a benchmarked result
+    template <typename T>
+    inline void DoNotOptimize(T const& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Best-of-N nanoseconds per call of fn
+    template <typename Fn>
+    double MeasureNsPerOp(Fn&& fn, int iterations, int repeats = 5) {
+        using Clock = std::chrono::steady_clock;
+        double best = 1e30;
+        for (int r = 0; r < repeats; ++r) {
+            auto start = Clock::now();
+            for (int i = 0; i < iterations; ++i) fn(i);
+            auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            best = std::min(best, elapsed / iterations);
+        }
+        return best;
+    }
+
+    inline void ReportNs(const char* name, double ns) {
+        std::printf("[ BENCH    ] %-48s %10.2f ns/op\n", name, ns);
+    }
+}
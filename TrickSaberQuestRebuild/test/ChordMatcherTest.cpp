@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/ChordMatcher.hpp"
+
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    constexpr ChordMask LeftTrigger = ChordBit(LeftHand, TriggerSlot);
+    constexpr ChordMask LeftGrip = ChordBit(LeftHand, GripSlot);
+    constexpr ChordMask LeftButtonOne = ChordBit(LeftHand, ButtonOneSlot);
+    constexpr ChordMask RightTrigger = ChordBit(RightHand, TriggerSlot);
+    constexpr ChordMask RightGrip = ChordBit(RightHand, GripSlot);
+}
+
+class ChordMatcherTest : public ::testing::Test {
+protected:
+    ChordMatcher matcher;
+    ChordBinding changed;
+
+    void Bind(std::vector<ChordBinding> bindings) {
+        matcher.SetBindings(bindings.data(), static_cast<int>(bindings.size()));
+    }
+
+    ChordTransition Feed(ChordMask pressed, double time) {
+        return matcher.Update(pressed, time, changed);
+    }
+};
+
+TEST_F(ChordMatcherTest, TwoHandChordStartsAndEnds) {
+    Bind({{static_cast<ChordMask>(LeftTrigger | RightTrigger), TrickAction::Spin, 0.2f}});
+
+    EXPECT_EQ(Feed(LeftTrigger, 0.0), ChordTransition::None);
+    EXPECT_EQ(Feed(LeftTrigger | RightTrigger, 0.1), ChordTransition::Started);
+    EXPECT_EQ(changed.action, TrickAction::Spin);
+    EXPECT_EQ(Feed(LeftTrigger | RightTrigger, 0.5), ChordTransition::None);
+    ASSERT_NE(matcher.Active(), nullptr);
+
+    EXPECT_EQ(Feed(RightTrigger, 0.6), ChordTransition::Ended);
+    EXPECT_EQ(changed.action, TrickAction::Spin);
+    EXPECT_EQ(matcher.Active(), nullptr);
+}
+
+TEST_F(ChordMatcherTest, PressesOutsideTheWindowDoNotChord) {
+    Bind({{static_cast<ChordMask>(LeftTrigger | LeftGrip), TrickAction::Throw, 0.2f}});
+
+    Feed(LeftTrigger, 0.0);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.3), ChordTransition::None);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.31), ChordTransition::None);
+
+    // A fresh press brings the pair back inside the window
+    Feed(LeftGrip, 0.4);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.5), ChordTransition::Started);
+}
+
+TEST_F(ChordMatcherTest, MostSpecificChordWinsAndWindowsArePerChord) {
+    Bind({
+        {static_cast<ChordMask>(LeftTrigger | LeftGrip), TrickAction::Throw, 0.1f},
+        {static_cast<ChordMask>(LeftTrigger | LeftGrip | LeftButtonOne), TrickAction::Spin, 0.5f}
+    });
+
+    EXPECT_EQ(matcher.Lookup(LeftTrigger | LeftGrip)->action, TrickAction::Throw);
+    EXPECT_EQ(matcher.Lookup(LeftTrigger | LeftGrip | LeftButtonOne | RightGrip)->action, TrickAction::Spin);
+    EXPECT_EQ(matcher.Lookup(LeftTrigger | RightGrip), nullptr);
+
+    // All three within 0.5s but too slow for the pair's 0.1s
+    Feed(LeftTrigger, 0.0);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.2), ChordTransition::None);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip | LeftButtonOne, 0.4), ChordTransition::Started);
+    EXPECT_EQ(changed.action, TrickAction::Spin);
+
+    // Releasing the button ends the triple without starting the pair
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.6), ChordTransition::Ended);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.7), ChordTransition::None);
+}
+
+TEST_F(ChordMatcherTest, SingleInputsAndEmptyActionsAreNotBound) {
+    Bind({
+        {LeftTrigger, TrickAction::Throw},
+        {static_cast<ChordMask>(LeftTrigger | LeftGrip), TrickAction::None}
+    });
+    EXPECT_EQ(matcher.BindingCount(), 0);
+    EXPECT_EQ(Feed(LeftTrigger | LeftGrip, 0.0), ChordTransition::None);
+}
+
+TEST_F(ChordMatcherTest, ConfigChordsMatchTheLegacyPairs) {
+    Config cfg;
+    cfg.triggerAction = TrickAction::Throw;
+    cfg.gripAction = TrickAction::Spin;
+    cfg.thumbstickAction = TrickAction::Spin;
+    cfg.buttonOneAction = TrickAction::None;
+
+    ChordBinding bindings[ChordMatcher::MaxBindings];
+    int count = BuildConfigChords(cfg, bindings, ChordMatcher::MaxBindings);
+
+    // trigger+grip and trigger+thumbstick per hand; grip+thumbstick share an action
+    ASSERT_EQ(count, 4);
+    EXPECT_EQ(bindings[0].mask, LeftTrigger | LeftGrip);
+    EXPECT_EQ(bindings[0].action, TrickAction::Throw);
+    EXPECT_EQ(bindings[1].mask, LeftTrigger | ChordBit(LeftHand, ThumbstickSlot));
+    EXPECT_EQ(bindings[2].mask, RightTrigger | RightGrip);
+    EXPECT_FLOAT_EQ(bindings[0].window, Constants::COMBINATION_WINDOW_MS / 1000.0f);
+}
+
+TEST_F(ChordMatcherTest, BenchmarkMatchCostIsFlatInBindingCount) {
+    // Every two-input chord across both hands: 45 bindings, capped at MaxBindings
+    std::vector<ChordBinding> bindings;
+    for (int a = 0; a < ChordBitCount; ++a) {
+        for (int b = a + 1; b < ChordBitCount; ++b) {
+            bindings.push_back({static_cast<ChordMask>((1u << a) | (1u << b)), TrickAction::Throw, 0.2f});
+        }
+    }
+
+    auto measure = [&](int count) {
+        Bind(std::vector<ChordBinding>(bindings.begin(), bindings.begin() + count));
+        return MeasureNsPerOp([&](int i) {
+            // Press and release a rotating pair so chords keep starting and ending
+            ChordMask pressed = (i & 1) ? static_cast<ChordMask>(3u << ((i >> 1) % (ChordBitCount - 1))) : 0;
+            DoNotOptimize(matcher.Update(pressed, i * 0.011, changed));
+        }, 200000);
+    };
+
+    double few = measure(2);
+    double many = measure(ChordMatcher::MaxBindings);
+    ReportNs("ChordMatcher::Update (2 bindings)", few);
+    ReportNs("ChordMatcher::Update (32 bindings)", many);
+    EXPECT_LT(many, few * 3.0 + 20.0);
+}
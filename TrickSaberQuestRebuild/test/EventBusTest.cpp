@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/EventBus.hpp"
+
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    struct Recorder {
+        std::vector<int> calls;
+        int id = 0;
+        float lastDuration = 0.0f;
+    };
+
+    void RecordStarted(void* context, const TrickStartedEvent& event) {
+        auto* recorder = static_cast<Recorder*>(context);
+        recorder->calls.push_back(recorder->id * 10 + static_cast<int>(event.action));
+    }
+
+    void RecordEnded(void* context, const TrickEndedEvent& event) {
+        static_cast<Recorder*>(context)->lastDuration = event.duration;
+    }
+
+    void CountStarted(void* context, const TrickStartedEvent&) {
+        ++*static_cast<int*>(context);
+    }
+}
+
+TEST(EventBusTest, DeliversInSubscriptionOrder) {
+    TrickEventBus bus;
+    Recorder first{{}, 1}, second{{}, 2};
+
+    EXPECT_TRUE(bus.Subscribe<TrickStartedEvent>(&RecordStarted, &first));
+    EXPECT_TRUE(bus.Subscribe<TrickStartedEvent>(&RecordStarted, &second));
+    EXPECT_TRUE(bus.Subscribe<TrickEndedEvent>(&RecordEnded, &first));
+
+    bus.Publish(TrickStartedEvent{1.0, TrickAction::Throw, LeftHand});
+    bus.Publish(TrickEndedEvent{2.0, 0.75f, TrickAction::Throw, LeftHand});
+
+    EXPECT_EQ(first.calls, std::vector<int>{11});
+    EXPECT_EQ(second.calls, std::vector<int>{21});
+    EXPECT_FLOAT_EQ(first.lastDuration, 0.75f);
+    EXPECT_EQ(second.lastDuration, 0.0f);
+
+    // Nobody listens for Ending; publishing still just counts
+    bus.Publish(TrickEndingEvent{1.5, TrickAction::Throw, LeftHand});
+    EXPECT_EQ(bus.GetPublishCount(), 3u);
+}
+
+TEST(EventBusTest, SubscribeIsIdempotentAndBounded) {
+    TrickEventBus::Channel<TrickStartedEvent> channel;
+    int counters[9] = {};
+
+    EXPECT_TRUE(channel.Subscribe(&CountStarted, &counters[0]));
+    EXPECT_TRUE(channel.Subscribe(&CountStarted, &counters[0]));
+    EXPECT_EQ(channel.Count(), 1u);
+
+    for (int i = 1; i < 8; ++i) EXPECT_TRUE(channel.Subscribe(&CountStarted, &counters[i]));
+    EXPECT_FALSE(channel.Subscribe(&CountStarted, &counters[8]));
+    EXPECT_FALSE(channel.Subscribe(nullptr, nullptr));
+
+    EXPECT_TRUE(channel.Unsubscribe(&CountStarted, &counters[3]));
+    EXPECT_FALSE(channel.Unsubscribe(&CountStarted, &counters[3]));
+    channel.Publish({0.0, TrickAction::Spin, RightHand});
+
+    EXPECT_EQ(counters[0], 1);
+    EXPECT_EQ(counters[3], 0);
+    EXPECT_EQ(counters[7], 1);
+    EXPECT_EQ(channel.Count(), 7u);
+}
+
+TEST(EventBusTest, BenchmarkPublish) {
+    TrickEventBus bus;
+    int counts[4] = {};
+    for (auto& count : counts) bus.Subscribe<TrickStartedEvent>(&CountStarted, &count);
+
+    double ns = MeasureNsPerOp([&](int i) {
+        bus.Publish(TrickStartedEvent{i * 0.01, TrickAction::Throw, static_cast<uint8_t>(i & 1)});
+    }, 200000);
+
+    DoNotOptimize(counts);
+    ReportNs("TrickEventBus::Publish (4 subscribers)", ns);
+    EXPECT_GT(counts[0], 0);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/FixedStep.hpp"
+#include "TrickSaber/Native/ThrowModel.hpp"
+
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+
+namespace {
+    constexpr float Step = Constants::THROW_FIXED_STEP;
+
+    ThrowParams FlightParams() {
+        ThrowParams params;
+        params.simplified = true;       // gravity, so the path curves
+        params.snapBackDistance = 3.0f;
+        return params;
+    }
+
+    const ThrowLaunch Launch{{1.0f, 5.0f, 6.0f}, 540.0f};
+
+    // Simulated position after each substep, run one substep per frame
+    std::vector<Vec3> ReferencePath(uint32_t& snapSubstep) {
+        ThrowModel model;
+        model.Launch(FlightParams(), Zero3(), IdentityQuat(), Launch);
+        std::vector<Vec3> path{Zero3()};
+        snapSubstep = 0;
+        while (model.Phase() == ThrowPhase::Thrown && path.size() < 10000) {
+            model.Step(Step, Zero3(), IdentityQuat());
+            path.push_back(model.Position());
+            if (model.Phase() != ThrowPhase::Thrown) snapSubstep = model.Substeps();
+        }
+        return path;
+    }
+
+    // Frame times at a refresh rate, with every hitchEvery-th frame replaced
+    // by a hitch of hitchSeconds
+    float FrameTime(int frame, float hz, int hitchEvery, float hitchSeconds) {
+        if (hitchEvery > 0 && frame % hitchEvery == hitchEvery - 1) return hitchSeconds;
+        return 1.0f / hz;
+    }
+}
+
+TEST(FixedStepTest, AccumulatesWholeStepsAndCarriesTheRest) {
+    FixedStepAccumulator clock(0.01f, 10);
+    EXPECT_EQ(clock.Advance(0.025f), 2);
+    EXPECT_NEAR(clock.Alpha(), 0.5f, 1e-4f);
+    EXPECT_EQ(clock.Advance(0.005f), 1);
+    EXPECT_NEAR(clock.Alpha(), 0.0f, 1e-4f);
+
+    // 90 Hz frames add up to exactly 240 Hz steps over half a second
+    FixedStepAccumulator fixed(Step, Constants::THROW_MAX_SUBSTEPS);
+    int steps = 0;
+    for (int i = 0; i < 45; ++i) steps += fixed.Advance(1.0f / 90.0f);
+    EXPECT_EQ(steps, 120);
+    EXPECT_EQ(fixed.GetStepCount(), 120u);
+
+    EXPECT_EQ(clock.Advance(0.0f), 0);
+    EXPECT_EQ(clock.Advance(-1.0f), 0);
+}
+
+TEST(FixedStepTest, LongHitchIsCappedAndDropsTime) {
+    FixedStepAccumulator clock(0.01f, 10);
+    EXPECT_EQ(clock.Advance(0.155f), 10);
+    EXPECT_NEAR(clock.GetDroppedTime(), 0.05, 1e-5);
+    EXPECT_NEAR(clock.Alpha(), 0.5f, 1e-3f);
+}
+
+TEST(FixedStepTest, TrajectoryMatchesAtEveryRefreshRate) {
+    uint32_t referenceSnap = 0;
+    auto reference = ReferencePath(referenceSnap);
+    ASSERT_GT(referenceSnap, 0u);
+
+    struct Run { float hz; int hitchEvery; float hitch; };
+    const Run runs[] = {
+        {72.0f, 0, 0.0f}, {90.0f, 0, 0.0f}, {120.0f, 0, 0.0f}, {144.0f, 0, 0.0f},
+        {90.0f, 7, 0.1f},       // dropped frames
+        {120.0f, 5, 0.045f},    // stutter
+        {72.0f, 11, 0.2f},      // long hitch, still under the substep cap
+    };
+
+    for (const auto& run : runs) {
+        SCOPED_TRACE(testing::Message() << run.hz << " Hz, hitch every " << run.hitchEvery);
+        ThrowModel model;
+        model.Launch(FlightParams(), Zero3(), IdentityQuat(), Launch);
+
+        bool snapped = false;
+        double time = 0.0;
+        for (int frame = 0; frame < 2000; ++frame) {
+            float dt = FrameTime(frame, run.hz, run.hitchEvery, run.hitch);
+            time += dt;
+            uint32_t before = model.Substeps();
+            model.Step(dt, Zero3(), IdentityQuat());
+            if (model.Phase() != ThrowPhase::Thrown) {
+                // Snap-back lands on the same substep, so at the same distance
+                EXPECT_GT(referenceSnap, before);
+                EXPECT_LE(referenceSnap, model.Substeps());
+                snapped = true;
+                break;
+            }
+
+            // Simulated state is the reference at the same substep
+            uint32_t substep = model.Substeps();
+            ASSERT_LT(substep, reference.size());
+            EXPECT_LT(Distance(model.Position(), reference[substep]), 1e-4f);
+
+            // Rendered pose sits one step behind the frame time, between
+            // the last two substeps
+            double renderTime = time - Step;
+            auto index = static_cast<size_t>(renderTime / Step);
+            float alpha = static_cast<float>(renderTime / Step - static_cast<double>(index));
+            if (index + 1 < reference.size()) {
+                Vec3 expected = Lerp(reference[index], reference[index + 1], alpha);
+                EXPECT_LT(Distance(model.RenderPosition(), expected), 2e-3f);
+            }
+        }
+
+        EXPECT_TRUE(snapped);
+    }
+}
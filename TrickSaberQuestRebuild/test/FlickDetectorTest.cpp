@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/FlickDetector.hpp"
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/TraceRecorder.hpp"
+#include "TrickSaber/Native/TraceReader.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+
+namespace {
+    constexpr double dt = 1.0 / 90.0;
+    const Vec3 swingDirection{0.0f, 0.6f, 0.8f};
+
+    // Distance along a half-sine speed profile: peak speed at duration / 2
+    float SwingDistance(float peakSpeed, float duration, double t) {
+        if (t <= 0.0) return 0.0f;
+        if (t >= duration) t = duration;
+        return peakSpeed * duration / Constants::PI * (1.0f - std::cos(Constants::PI * static_cast<float>(t) / duration));
+    }
+
+    struct Swing {
+        double start;
+        float peakSpeed;
+        float duration;
+    };
+
+    // Hand position at time t for a sequence of swings from the origin
+    Vec3 HandAt(const std::vector<Swing>& swings, double t) {
+        float distance = 0.0f;
+        for (const auto& swing : swings) distance += SwingDistance(swing.peakSpeed, swing.duration, t - swing.start);
+        return swingDirection * distance;
+    }
+}
+
+class FlickDetectorTest : public ::testing::Test {
+protected:
+    FlickDetector detector;
+    std::vector<FlickEvent> flicks;
+
+    void Run(const std::vector<Swing>& swings, double seconds) {
+        for (int i = 0; i * dt <= seconds; ++i) {
+            FlickEvent event;
+            if (detector.Update(i * dt, HandAt(swings, i * dt), event)) flicks.push_back(event);
+        }
+    }
+};
+
+TEST_F(FlickDetectorTest, SharpFlickFiresOnceAtPeak) {
+    Run({{0.5, 4.0f, 0.25f}}, 1.5);
+    ASSERT_EQ(flicks.size(), 1u);
+    EXPECT_NEAR(flicks[0].time, 0.5 + 0.125, 0.03);
+    EXPECT_GT(flicks[0].speed, 0.85f * 4.0f);
+    EXPECT_NEAR(Dot(Normalized(flicks[0].velocity), swingDirection), 1.0f, 1e-3f);
+}
+
+TEST_F(FlickDetectorTest, SlowSweepAndWeakFlickAreIgnored) {
+    // Same peak speed spread over 1.2s, then a sharp but slow flick
+    Run({{0.2, 3.0f, 1.2f}, {2.0, 1.5f, 0.25f}}, 3.0);
+    EXPECT_TRUE(flicks.empty());
+}
+
+TEST_F(FlickDetectorTest, CooldownSuppressesDoubleFlick) {
+    Run({{0.2, 4.0f, 0.2f}, {0.45, 4.0f, 0.2f}, {1.5, 4.0f, 0.2f}}, 2.0);
+    ASSERT_EQ(flicks.size(), 2u);
+    EXPECT_GT(flicks[1].time, 1.5);
+}
+
+TEST_F(FlickDetectorTest, ResetForgetsPreviousSamples) {
+    Run({{0.1, 4.0f, 0.25f}}, 0.2);
+    detector.Reset();
+    FlickEvent event;
+    EXPECT_FALSE(detector.Update(0.0, Zero3(), event));
+    EXPECT_FLOAT_EQ(detector.Speed(), 0.0f);
+}
+
+TEST(FlickHoldTest, ReleasesOnceAfterTheHoldTime) {
+    FlickHold hold;
+    EXPECT_FALSE(hold.Expired(5.0));
+
+    hold.Start(1.0, 0.6f);
+    EXPECT_TRUE(hold.IsHeld());
+    EXPECT_FALSE(hold.Expired(1.5));
+    EXPECT_TRUE(hold.Expired(1.61));
+    EXPECT_FALSE(hold.Expired(1.7));
+    EXPECT_FALSE(hold.IsHeld());
+
+    // A trigger edge in between takes over the release
+    hold.Start(2.0, 0.6f);
+    hold.Cancel();
+    EXPECT_FALSE(hold.Expired(3.0));
+}
+
+TEST_F(FlickDetectorTest, ReplaysRecordedTrace) {
+    std::string path = ::testing::TempDir() + "tricksaber_flick.tstrace";
+    std::vector<Swing> rightSwings = {{0.5, 4.5f, 0.25f}, {2.0, 3.5f, 0.3f}};
+
+    TraceRecorder recorder;
+    ASSERT_TRUE(recorder.Start(path));
+    for (int i = 0; i * dt <= 3.0; ++i) {
+        // Left hand drifts slowly and must never flick
+        Vec3 positions[2] = {{-0.3f, 1.0f + 0.05f * std::sin(static_cast<float>(i * dt)), 0.0f}, HandAt(rightSwings, i * dt)};
+        Quat rotations[2] = {IdentityQuat(), IdentityQuat()};
+        recorder.RecordPose(i * dt, static_cast<float>(dt), 3, positions, rotations);
+    }
+    recorder.Stop();
+
+    TraceReader reader;
+    ASSERT_TRUE(reader.Open(path));
+    FlickDetector hands[2];
+    std::vector<FlickEvent> detected[2];
+    TraceReader::RecordView record;
+    while (reader.Next(record)) {
+        auto* pose = record.As<Trace::PoseRecord>();
+        if (!pose) continue;
+        for (int hand = 0; hand < 2; ++hand) {
+            FlickEvent event;
+            if (hands[hand].Update(pose->time, pose->position[hand], event)) detected[hand].push_back(event);
+        }
+    }
+    reader.Close();
+    std::remove(path.c_str());
+
+    EXPECT_TRUE(detected[LeftHand].empty());
+    ASSERT_EQ(detected[RightHand].size(), 2u);
+    EXPECT_NEAR(detected[RightHand][0].time, 0.625, 0.03);
+    EXPECT_NEAR(detected[RightHand][1].time, 2.15, 0.03);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/FrameClock.hpp"
+#include "TrickSaber/Native/PoseHistory.hpp"
+
+using namespace TrickSaber::Native;
+
+class FrameClockTest : public ::testing::Test {
+protected:
+    FrameClockState clock;
+    int samplerRuns = 0;
+
+    // Stands in for the Time.time / deltaTime / fixedDeltaTime reads
+    bool Begin(uint64_t frame) {
+        return clock.Advance(frame, [this, frame](FrameTime& time) {
+            samplerRuns++;
+            time.deltaTime = 1.0f / 90.0f;
+            time.fixedDeltaTime = 1.0f / 50.0f;
+            time.time = frame / 90.0f;
+        });
+    }
+};
+
+TEST_F(FrameClockTest, SamplesOncePerFrame) {
+    // Input managers, trick manager, hooks and active tricks all begin the frame
+    EXPECT_TRUE(Begin(1));
+    for (int root = 0; root < 7; ++root) EXPECT_FALSE(Begin(1));
+    EXPECT_EQ(samplerRuns, 1);
+    EXPECT_EQ(clock.GetBeginCount(), 8u);
+    EXPECT_EQ(clock.GetFrameCount(), 1u);
+
+    EXPECT_TRUE(Begin(2));
+    EXPECT_EQ(samplerRuns, 2);
+    EXPECT_EQ(clock.Current().frame, 2u);
+    EXPECT_FLOAT_EQ(clock.Current().time, 2 / 90.0f);
+}
+
+TEST_F(FrameClockTest, TimestampIsFrozenWithinAFrame) {
+    Begin(10);
+    auto first = clock.Current();
+    Begin(10);
+    EXPECT_EQ(clock.Current().steadyNow, first.steadyNow);
+    EXPECT_DOUBLE_EQ(clock.Current().now, first.now);
+    EXPECT_FLOAT_EQ(clock.Current().deltaTime, 1.0f / 90.0f);
+    EXPECT_FLOAT_EQ(clock.Current().fixedDeltaTime, 1.0f / 50.0f);
+
+    Begin(11);
+    EXPECT_GE(clock.Current().steadyNow, first.steadyNow);
+}
+
+TEST_F(FrameClockTest, NowSharesTheMonotonicTimebase) {
+    double before = MonotonicSeconds();
+    Begin(1);
+    double after = MonotonicSeconds();
+    EXPECT_GE(clock.Current().now, before);
+    EXPECT_LE(clock.Current().now, after);
+    EXPECT_DOUBLE_EQ(clock.Current().now,
+        std::chrono::duration<double>(clock.Current().steadyNow.time_since_epoch()).count());
+}
+
+TEST_F(FrameClockTest, ResetClearsCountersAndResamples) {
+    Begin(3);
+    Begin(3);
+    clock.Reset();
+    EXPECT_FALSE(clock.IsValid());
+    EXPECT_EQ(clock.GetBeginCount(), 0u);
+
+    // Same frame id after a scene change still samples again
+    EXPECT_TRUE(Begin(3));
+    EXPECT_EQ(samplerRuns, 2);
+    EXPECT_EQ(clock.GetFrameCount(), 1u);
+}
+
+TEST_F(FrameClockTest, FixedTicksBeforeUpdateDoNotLeakIntoTheFrame) {
+    // Unity runs FixedUpdate before Update; inside it Time.deltaTime reports
+    // the fixed step. On a hitch frame there are several such ticks.
+    constexpr float fixedStep = 1.0f / 50.0f;
+    constexpr float hitch = 0.1f;
+    float engineDeltaTime = 1.0f / 90.0f;
+    float engineTime = 1.0f;
+
+    auto sample = [&](FrameTime& time) {
+        samplerRuns++;
+        time.time = engineTime;
+        time.deltaTime = engineDeltaTime;
+        time.fixedDeltaTime = fixedStep;
+    };
+
+    clock.Advance(1, sample);
+    float frameDelta = clock.Current().deltaTime;
+
+    // Fixed phase of the hitch frame: the hooks read the fixed step themselves
+    engineDeltaTime = fixedStep;
+    float fixedSum = 0.0f;
+    for (int tick = 0; tick < 5; ++tick) {
+        engineTime += fixedStep;
+        fixedSum += engineDeltaTime;
+        // Cached readers still see the previous frame
+        EXPECT_FLOAT_EQ(clock.Current().deltaTime, frameDelta);
+    }
+    EXPECT_FLOAT_EQ(fixedSum, hitch);
+
+    // Update phase: the frame hook stamps with the real frame delta, and
+    // TrickDriver's own BeginFrame later in the frame does not resample
+    engineDeltaTime = hitch;
+    EXPECT_TRUE(clock.Advance(2, sample));
+    EXPECT_FALSE(clock.Advance(2, sample));
+    EXPECT_FLOAT_EQ(clock.Current().deltaTime, hitch);
+    EXPECT_FLOAT_EQ(clock.Current().fixedDeltaTime, fixedStep);
+    EXPECT_FLOAT_EQ(clock.Current().time, engineTime);
+    EXPECT_EQ(samplerRuns, 2);
+}
+
+TEST_F(FrameClockTest, ReadBeforeTheFirstStampIsReplacedByIt) {
+    // Frame id 0 is never a Unity frame, so the first real stamp resamples
+    EXPECT_TRUE(clock.Advance(0, [this](FrameTime& time) { samplerRuns++; time.deltaTime = 0.02f; }));
+    EXPECT_TRUE(Begin(1));
+    EXPECT_FLOAT_EQ(clock.Current().deltaTime, 1.0f / 90.0f);
+    EXPECT_EQ(samplerRuns, 2);
+}
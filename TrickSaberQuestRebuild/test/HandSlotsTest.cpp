@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/HandSlots.hpp"
+
+using namespace TrickSaber::Native;
+
+namespace {
+    struct Manager {
+        int id;
+    };
+}
+
+TEST(HandSlotsTest, JoinAndLeaveByHand) {
+    HandSlots<Manager> slots;
+    Manager left{1}, right{2};
+
+    EXPECT_EQ(slots.Count(), 0);
+    EXPECT_EQ(slots.Join(LeftHand, &left), nullptr);
+    EXPECT_EQ(slots.Join(RightHand, &right), nullptr);
+    EXPECT_EQ(slots.Count(), 2);
+    EXPECT_EQ(slots.Get(LeftHand), &left);
+    EXPECT_EQ(slots.All()[RightHand], &right);
+
+    EXPECT_TRUE(slots.Leave(LeftHand, &left));
+    EXPECT_EQ(slots.Get(LeftHand), nullptr);
+    EXPECT_EQ(slots.Count(), 1);
+    EXPECT_EQ(slots.GetJoinCount(), 2u);
+    EXPECT_EQ(slots.GetLeaveCount(), 1u);
+}
+
+TEST(HandSlotsTest, StaleLeaveKeepsTheNewOccupant) {
+    // A replacement manager initializes before the old one's OnDestroy runs
+    HandSlots<Manager> slots;
+    Manager oldManager{1}, newManager{2};
+
+    slots.Join(RightHand, &oldManager);
+    EXPECT_EQ(slots.Join(RightHand, &newManager), &oldManager);
+    EXPECT_FALSE(slots.Leave(RightHand, &oldManager));
+    EXPECT_EQ(slots.Get(RightHand), &newManager);
+    EXPECT_FALSE(slots.Leave(LeftHand, nullptr));
+
+    slots.Clear();
+    EXPECT_EQ(slots.Count(), 0);
+    EXPECT_EQ(slots.GetJoinCount(), 0u);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/HandTracker.hpp"
+#include "TrickSaber/Native/DirectInputState.hpp"
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+
+class HandTrackerTest : public ::testing::Test {
+protected:
+    HandTracker tracker;
+    static constexpr float dt = 1.0f / 90.0f;
+
+    void SetUp() override {
+        VelocityFilterParams params;
+        params.boxcarWindow = 3;
+        tracker.Configure(VelocityFilterMode::Boxcar, params);
+    }
+
+    void Feed(int ticks, uint32_t mask, Vec3 leftVelocity, Vec3 rightVelocity) {
+        for (int i = 0; i < ticks; ++i) {
+            Vec3 positions[2] = {tracker.Position(LeftHand) + leftVelocity * dt, tracker.Position(RightHand) + rightVelocity * dt};
+            Quat rotations[2] = {IdentityQuat(), IdentityQuat()};
+            time += dt;
+            tracker.Update(time, dt, mask, positions, rotations);
+        }
+    }
+
+    double time = 0.0;
+};
+
+TEST_F(HandTrackerTest, TracksBothHandsIndependently) {
+    Feed(10, HandTracker::LeftMask | HandTracker::RightMask, {1.0f, 0.0f, 0.0f}, {0.0f, -2.0f, 0.0f});
+    EXPECT_NEAR(tracker.Velocity(LeftHand).x, 1.0f, 1e-3f);
+    EXPECT_NEAR(tracker.Velocity(RightHand).y, -2.0f, 1e-3f);
+    EXPECT_NEAR(tracker.Velocity(LeftHand).y, 0.0f, 1e-3f);
+
+    Vec3 linear, angular;
+    ASSERT_TRUE(tracker.VelocityAt(RightHand, time, 0.05, linear, angular));
+    EXPECT_NEAR(linear.y, -2.0f, 1e-2f);
+}
+
+TEST_F(HandTrackerTest, MissingHandKeepsPreviousState) {
+    Feed(10, HandTracker::LeftMask | HandTracker::RightMask, {1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f});
+    Vec3 rightPosition = tracker.Position(RightHand);
+    Feed(5, HandTracker::LeftMask, {3.0f, 0.0f, 0.0f}, {9.0f, 0.0f, 0.0f});
+    EXPECT_NEAR(tracker.Velocity(LeftHand).x, 3.0f, 1e-3f);
+    EXPECT_NEAR(tracker.Velocity(RightHand).x, 1.0f, 1e-3f);
+    EXPECT_FLOAT_EQ(tracker.Position(RightHand).x, rightPosition.x);
+}
+
+TEST_F(HandTrackerTest, ResetClearsVelocityAndHistory) {
+    Feed(10, HandTracker::LeftMask, {1.0f, 0.0f, 0.0f}, Zero3());
+    tracker.Reset();
+    EXPECT_FLOAT_EQ(Magnitude(tracker.Velocity(LeftHand)), 0.0f);
+    Vec3 linear, angular;
+    EXPECT_FALSE(tracker.VelocityAt(LeftHand, time, 0.05, linear, angular));
+}
+
+TEST(DirectInputStateTest, ReportsEdgesOnce) {
+    DirectInputState input;
+    auto pressed = input.Update(true, 0.0f);
+    EXPECT_TRUE(pressed.triggerPressed);
+    EXPECT_FALSE(input.Update(true, 0.0f).triggerPressed);
+    EXPECT_TRUE(input.Update(false, 0.0f).triggerReleased);
+
+    auto stick = input.Update(false, 0.9f);
+    EXPECT_TRUE(stick.thumbstickPressed);
+    EXPECT_FLOAT_EQ(stick.thumbstickValue, 0.9f);
+    auto held = input.Update(false, 0.8f);
+    EXPECT_TRUE(held.thumbstickActive);
+    EXPECT_FALSE(held.thumbstickPressed);
+    EXPECT_TRUE(input.Update(false, 0.2f).thumbstickReleased);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/InputChannels.hpp"
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+class InputChannelsTest : public ::testing::Test {
+protected:
+    Config cfg;
+    ChannelContext context;
+    ControllerSample sample;
+
+    void SetUp() override {
+        context.config = &cfg;
+        context.isLeft = false;
+        context.triggerThreshold = 0.8f;
+        context.thumbstickThreshold = 0.5f;
+        sample.connected = true;
+    }
+};
+
+TEST_F(InputChannelsTest, TriggerAndGripShareTheTriggerThreshold) {
+    float value = 0.0f;
+    sample.trigger = 0.9f;
+    sample.grip = 0.7f;
+    EXPECT_TRUE(ReadChannel<DirectInputChannels[TriggerSlot]>(sample, context, value));
+    EXPECT_FLOAT_EQ(value, 0.9f);
+    EXPECT_FALSE(ReadChannel<DirectInputChannels[GripSlot]>(sample, context, value));
+
+    cfg.reverseGrip = true;
+    EXPECT_FALSE(ReadChannel<DirectInputChannels[GripSlot]>(sample, context, value));
+    EXPECT_NEAR(value, 0.3f, 1e-6f);
+}
+
+TEST_F(InputChannelsTest, TraditionalThumbstickNeedsOutwardDirection) {
+    cfg.spinMode = SpinMode::Traditional;
+    float value = 0.0f;
+    sample.stickX = 0.9f;
+    EXPECT_TRUE(ReadChannel<DirectInputChannels[ThumbstickSlot]>(sample, context, value));
+    EXPECT_FLOAT_EQ(value, 0.9f);
+
+    context.isLeft = true;
+    EXPECT_FALSE(ReadChannel<DirectInputChannels[ThumbstickSlot]>(sample, context, value));
+    sample.stickX = -0.9f;
+    EXPECT_TRUE(ReadChannel<DirectInputChannels[ThumbstickSlot]>(sample, context, value));
+}
+
+TEST_F(InputChannelsTest, MomentumModeUsesThumbstickClick) {
+    cfg.spinMode = SpinMode::Momentum;
+    float value = 0.0f;
+    sample.stickX = 1.0f;
+    EXPECT_FALSE(ReadChannel<DirectInputChannels[ThumbstickSlot]>(sample, context, value));
+    sample.buttons = Trace::ThumbstickClick;
+    EXPECT_TRUE(ReadChannel<DirectInputChannels[ThumbstickSlot]>(sample, context, value));
+    EXPECT_FLOAT_EQ(value, 1.0f);
+}
+
+TEST_F(InputChannelsTest, SmoothedTableUsesHorizontalStick) {
+    cfg.reverseThumbstick = true;
+    float value = 0.0f;
+    sample.stickX = -0.6f;
+    sample.stickY = 0.0f;
+    EXPECT_TRUE(ReadChannel<SmoothedInputChannels[ThumbstickSlot]>(sample, context, value));
+    EXPECT_FLOAT_EQ(value, 0.6f);
+}
+
+TEST_F(InputChannelsTest, VisitsChannelsInTableOrder) {
+    std::vector<int> slots;
+    VisitChannels<DirectInputChannels>([&]<InputChannel Channel>() {
+        slots.push_back(Channel.slot);
+    });
+    EXPECT_EQ(slots, (std::vector<int>{TriggerSlot, GripSlot, ThumbstickSlot, ButtonOneSlot, ButtonTwoSlot}));
+}
+
+namespace {
+    constexpr double DebounceSeconds = Constants::DEBOUNCE_TIME_MS / 1000.0;
+
+    struct ChannelState {
+        bool pressed = false;
+        float lastValue = 0.0f;
+        double lastChangeTime = -1.0;
+    };
+
+    // Debounced edge handling shared by both shapes below
+    struct InputCounters {
+        int activations = 0;
+        int deactivations = 0;
+        float valueSum = 0.0f;
+
+        void Apply(bool isPressed, float value, ChannelState& state, TrickAction, double time) {
+            if (!std::isfinite(value)) {
+                value = 0.0f;
+                isPressed = false;
+            }
+            if (isPressed != state.pressed && time - state.lastChangeTime >= DebounceSeconds) {
+                state.pressed = isPressed;
+                state.lastChangeTime = time;
+                if (isPressed) activations++;
+                else deactivations++;
+            }
+            if (state.pressed) {
+                state.lastValue = value;
+                valueSum += value;
+            }
+        }
+    };
+
+    // InputManager::CheckInputs before the table: one std::function per
+    // channel per frame, each calling back into a member getter
+    struct LegacyInput : InputCounters {
+        const ControllerSample* sample = nullptr;
+        ChannelContext context;
+        ChannelState states[InputSlotCount];
+        double time = 0.0;
+
+        bool GetTriggerValue(float& v) { return ReadChannel<DirectInputChannels[TriggerSlot]>(*sample, context, v); }
+        bool GetGripValue(float& v) { return ReadChannel<DirectInputChannels[GripSlot]>(*sample, context, v); }
+        bool GetThumbstickValue(float& v) { return ReadChannel<DirectInputChannels[ThumbstickSlot]>(*sample, context, v); }
+        bool GetButtonOneValue(float& v) { return ReadChannel<DirectInputChannels[ButtonOneSlot]>(*sample, context, v); }
+        bool GetButtonTwoValue(float& v) { return ReadChannel<DirectInputChannels[ButtonTwoSlot]>(*sample, context, v); }
+
+        void CheckInput(std::function<bool(float&)> getValue, ChannelState& state, TrickAction action) {
+            if (action == TrickAction::None || !getValue) return;
+            float value = 0.0f;
+            bool isPressed = getValue(value);
+            Apply(isPressed, value, state, action, time);
+        }
+
+        void Frame(const ControllerSample& frameSample, double frameTime) {
+            sample = &frameSample;
+            time = frameTime;
+            const Config& cfg = *context.config;
+            CheckInput([this](float& v) { return GetTriggerValue(v); }, states[TriggerSlot], cfg.triggerAction);
+            CheckInput([this](float& v) { return GetGripValue(v); }, states[GripSlot], cfg.gripAction);
+            CheckInput([this](float& v) { return GetThumbstickValue(v); }, states[ThumbstickSlot], cfg.thumbstickAction);
+            CheckInput([this](float& v) { return GetButtonOneValue(v); }, states[ButtonOneSlot], cfg.buttonOneAction);
+            CheckInput([this](float& v) { return GetButtonTwoValue(v); }, states[ButtonTwoSlot], cfg.buttonTwoAction);
+        }
+    };
+
+    struct TableInput : InputCounters {
+        ChannelContext context;
+        ChannelState states[InputSlotCount];
+
+        void Frame(const ControllerSample& sample, double time) {
+            const Config& cfg = *context.config;
+            VisitChannels<DirectInputChannels>([&]<InputChannel Channel>() {
+                TrickAction action = cfg.*(Channel.action);
+                if (action == TrickAction::None) return;
+                float value = 0.0f;
+                bool isPressed = ReadChannel<Channel>(sample, context, value);
+                Apply(isPressed, value, states[Channel.slot], action, time);
+            });
+        }
+    };
+}
+
+TEST_F(InputChannelsTest, BenchmarkTableAgainstFunctionGetters) {
+    cfg.gripAction = TrickAction::FreezeThrow;
+    cfg.buttonOneAction = TrickAction::Throw;
+    cfg.buttonTwoAction = TrickAction::Spin;
+
+    // Two seconds of varied input at 90 Hz, every channel toggling
+    constexpr int Frames = 180;
+    std::vector<ControllerSample> samples(Frames);
+    for (int i = 0; i < Frames; ++i) {
+        float t = i / 90.0f;
+        auto& s = samples[i];
+        s.connected = true;
+        s.trigger = 0.5f + 0.5f * std::sin(t * 7.0f);
+        s.grip = 0.5f + 0.5f * std::cos(t * 5.0f);
+        s.stickX = std::sin(t * 3.0f);
+        s.stickY = std::cos(t * 4.0f) * 0.5f;
+        s.buttons = ((i / 20) % 2 ? Trace::ButtonOne : 0u) | ((i / 33) % 2 ? Trace::ButtonTwo : 0u);
+    }
+
+    LegacyInput legacy;
+    TableInput table;
+    legacy.context = context;
+    table.context = context;
+
+    int legacyTick = 0;
+    double legacyNs = MeasureNsPerOp([&](int i) {
+        legacy.Frame(samples[i % Frames], (legacyTick++) / 90.0);
+        DoNotOptimize(legacy.valueSum);
+    }, Frames * 50);
+
+    int tableTick = 0;
+    double tableNs = MeasureNsPerOp([&](int i) {
+        table.Frame(samples[i % Frames], (tableTick++) / 90.0);
+        DoNotOptimize(table.valueSum);
+    }, Frames * 50);
+
+    ReportNs("InputManager::CheckInputs via std::function", legacyNs);
+    ReportNs("InputManager::CheckInputs via channel table", tableNs);
+
+    // Same decisions either way
+    EXPECT_GT(table.activations, 0);
+    EXPECT_EQ(table.activations, legacy.activations);
+    EXPECT_EQ(table.deactivations, legacy.deactivations);
+    EXPECT_FLOAT_EQ(table.valueSum, legacy.valueSum);
+    EXPECT_LT(tableNs, 2000.0);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/InputEventQueue.hpp"
+
+#include <thread>
+
+using namespace TrickSaber::Native;
+
+class InputEventQueueTest : public ::testing::Test {
+protected:
+    SpscQueue<InputEvent, 8> queue;
+
+    static InputEvent Event(double time, InputEdge edge, float value = 0.0f) {
+        return {time, value, 0, 1, edge, 0};
+    }
+};
+
+TEST_F(InputEventQueueTest, DeliversInOrderAcrossWraparound) {
+    InputEvent event;
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 6; ++i) {
+            ASSERT_TRUE(queue.Push(Event(round * 10 + i, InputEdge::Update, static_cast<float>(i))));
+        }
+        for (int i = 0; i < 6; ++i) {
+            ASSERT_TRUE(queue.Pop(event));
+            EXPECT_DOUBLE_EQ(event.time, round * 10 + i);
+            EXPECT_EQ(event.edge, InputEdge::Update);
+        }
+        EXPECT_FALSE(queue.Pop(event));
+    }
+}
+
+TEST_F(InputEventQueueTest, FullQueueDropsNewestAndCounts) {
+    for (int i = 0; i < 8; ++i) EXPECT_TRUE(queue.Push(Event(i, InputEdge::Press)));
+    EXPECT_FALSE(queue.Push(Event(99, InputEdge::Release)));
+    EXPECT_EQ(queue.GetDroppedCount(), 1u);
+    EXPECT_EQ(queue.Size(), 8u);
+
+    InputEvent event;
+    ASSERT_TRUE(queue.Pop(event));
+    EXPECT_DOUBLE_EQ(event.time, 0.0);
+    queue.Clear();
+    EXPECT_EQ(queue.Size(), 0u);
+    EXPECT_FALSE(queue.Pop(event));
+}
+
+TEST_F(InputEventQueueTest, ProducerThreadFeedsConsumerInOrder) {
+    // Producer sampling faster than the consumer frame, as a polling thread would
+    constexpr int Count = 20000;
+    InputEventQueue events;
+    std::thread producer([&]() {
+        for (int i = 0; i < Count; ++i) {
+            while (!events.Push({static_cast<double>(i), 0.0f, 1, 2, InputEdge::Update, 0})) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    InputEvent event;
+    while (expected < Count) {
+        if (events.Pop(event)) {
+            ASSERT_DOUBLE_EQ(event.time, expected);
+            ASSERT_EQ(event.hand, 1);
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_EQ(events.Size(), 0u);
+}
+
+TEST(LatencyStatsTest, TracksMeanAndMax) {
+    LatencyStats stats;
+    EXPECT_DOUBLE_EQ(stats.Mean(), 0.0);
+    stats.Record(0.002);
+    stats.Record(0.010);
+    EXPECT_EQ(stats.count, 2u);
+    EXPECT_DOUBLE_EQ(stats.Mean(), 0.006);
+    EXPECT_DOUBLE_EQ(stats.max, 0.010);
+    stats.Reset();
+    EXPECT_EQ(stats.count, 0u);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/InputSnapshot.hpp"
+
+using namespace TrickSaber::Native;
+
+class InputSnapshotTest : public ::testing::Test {
+protected:
+    InputSnapshotBuffer buffer;
+    int samplerRuns = 0;
+    float trigger = 0.0f;
+
+    // Stands in for the OVRInput sampler: 9 calls per controller
+    const InputSnapshot& Read(uint64_t frame) {
+        return buffer.Acquire(frame, frame / 90.0, [this](InputSnapshot& snapshot) {
+            samplerRuns++;
+            for (auto& hand : snapshot.hands) {
+                hand.connected = true;
+                hand.trigger = trigger;
+                hand.buttons = trigger > 0.5f ? Trace::TriggerButton : 0u;
+            }
+            return 18u;
+        });
+    }
+};
+
+TEST_F(InputSnapshotTest, SamplesOncePerFrame) {
+    // Direct input, two input managers and the physics manager, both hands
+    for (int reader = 0; reader < 8; ++reader) Read(1);
+    EXPECT_EQ(samplerRuns, 1);
+    EXPECT_EQ(buffer.GetReadCount(), 8u);
+    EXPECT_EQ(buffer.GetInteropCallCount(), 18u);
+
+    Read(2);
+    EXPECT_EQ(samplerRuns, 2);
+    EXPECT_EQ(buffer.GetSampleCount(), 2u);
+    EXPECT_EQ(buffer.GetInteropCallCount(), 36u);
+}
+
+TEST_F(InputSnapshotTest, ValuesAreFrozenWithinAFrame) {
+    trigger = 1.0f;
+    const auto& first = Read(5);
+    EXPECT_TRUE(first.hands[RightHand].Pressed(Trace::TriggerButton));
+    EXPECT_DOUBLE_EQ(first.time, 5 / 90.0);
+
+    trigger = 0.0f;
+    EXPECT_FLOAT_EQ(Read(5).hands[LeftHand].trigger, 1.0f);
+    EXPECT_FALSE(Read(6).hands[LeftHand].Pressed(Trace::TriggerButton));
+}
+
+TEST_F(InputSnapshotTest, ResetClearsCountersAndResamples) {
+    Read(3);
+    buffer.Reset();
+    EXPECT_EQ(buffer.GetInteropCallCount(), 0u);
+    EXPECT_EQ(buffer.GetReadCount(), 0u);
+
+    // Same frame id after a reset still samples fresh state
+    Read(3);
+    EXPECT_EQ(samplerRuns, 2);
+    EXPECT_EQ(buffer.GetSampleCount(), 1u);
+}
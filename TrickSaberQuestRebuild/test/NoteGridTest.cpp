@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/NoteGrid.hpp"
+#include "BenchmarkUtils.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    constexpr float Speed = 16.0f;      // m/s jump speed
+    constexpr float dt = 1.0f / 90.0f;
+
+    float LaneX(int line) { return (static_cast<float>(line) - 1.5f) * Constants::NOTE_LINE_SPACING; }
+
+    NoteGrid::Note MakeNote(uint64_t key, int line, int layer, float arrival) {
+        return {key, LaneX(line), Constants::NOTE_LAYER_HEIGHTS[layer], arrival, Speed};
+    }
+
+    // Vanilla-like jump: at the top of its arc at arrival, then falling
+    constexpr float Gravity = 6.0f;
+
+    Quat Yaw(float degrees) {
+        float half = degrees * 0.5f * 3.14159265f / 180.0f;
+        return {0.0f, std::sin(half), 0.0f, std::cos(half)};
+    }
+
+    // Vertical blade at x sweeping sideways by dx over the frame, at depth z
+    SweptBlade Swipe(float x, float dx, float z, float bottom = 0.5f, float top = 2.2f) {
+        return {{x, bottom, z}, {x, top, z}, {x + dx, bottom, z}, {x + dx, top, z}};
+    }
+
+    // Grid on the heap; it is a few tens of KB
+    std::unique_ptr<NoteGrid> MakeGrid() {
+        return std::make_unique<NoteGrid>(NoteGrid::DefaultLayout());
+    }
+}
+
+TEST(NoteGridTest, SweptBladeMeetsSpheresOnTheSurfaceOnly) {
+    SweptBlade blade = Swipe(-0.5f, 1.0f, 0.0f);
+    Vec3 point;
+    EXPECT_TRUE(SweptBladeHits(blade, {0.0f, 1.0f, 0.2f}, 0.3f, point));
+    EXPECT_NEAR(point.z, 0.0f, 1e-5f);
+    EXPECT_FALSE(SweptBladeHits(blade, {0.0f, 1.0f, 0.4f}, 0.3f, point));
+    // Past the tip
+    EXPECT_FALSE(SweptBladeHits(blade, {0.0f, 2.6f, 0.0f}, 0.3f, point));
+    // A still blade is a segment
+    SweptBlade still = Swipe(0.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(SweptBladeHits(still, {0.2f, 1.0f, 0.0f}, 0.3f, point));
+    EXPECT_FALSE(SweptBladeHits(still, {0.4f, 1.0f, 0.0f}, 0.3f, point));
+}
+
+TEST(NoteGridTest, CutsTheNoteTheBladeSweepsThrough) {
+    auto grid = MakeGrid();
+    float now = 10.0f;
+    // Lane 1, middle layer, 0.5 s out: 8 m ahead of the cut plane now
+    auto handle = grid->Insert(MakeNote(7, 1, 1, now + 0.5f));
+    grid->Insert(MakeNote(8, 3, 1, now + 0.5f));
+    grid->Insert(MakeNote(9, 1, 1, now + 2.0f));
+    ASSERT_NE(handle, NoteGrid::None);
+
+    std::vector<uint64_t> cut;
+    auto collect = [&](const NoteGrid::Note& note, const Vec3&) { cut.push_back(note.key); };
+
+    // Thrown saber out at 8 m, swiping across lanes 0-1
+    EXPECT_EQ(grid->Query(Swipe(LaneX(0), 0.7f, 8.0f), now, dt, collect), 1);
+    ASSERT_EQ(cut.size(), 1u);
+    EXPECT_EQ(cut[0], 7u);
+
+    // Once the cut hook removes it, it is gone
+    EXPECT_TRUE(grid->Remove(handle, 7));
+    EXPECT_FALSE(grid->Remove(handle, 7));
+    cut.clear();
+    EXPECT_EQ(grid->Query(Swipe(LaneX(0), 0.7f, 8.0f), now, dt, collect), 0);
+    EXPECT_EQ(grid->Size(), 2);
+}
+
+TEST(NoteGridTest, StillBladeCatchesANoteFlyingThroughIt) {
+    auto grid = MakeGrid();
+    float now = 3.0f;
+    // 0.1 m behind the blade at the start of the frame, 0.08 m past it at the end
+    grid->Insert(MakeNote(1, 2, 0, now + 2.0f / Speed - dt * 0.5f));
+    int hits = grid->Query(Swipe(LaneX(2), 0.0f, 2.0f), now, dt, [](const NoteGrid::Note&, const Vec3& point) {
+        // On the blade, within a frame's travel of where it crossed
+        EXPECT_NEAR(point.x, LaneX(2), 1e-4f);
+        EXPECT_NEAR(point.z, 2.0f, Speed * dt);
+    });
+    EXPECT_EQ(hits, 1);
+}
+
+TEST(NoteGridTest, PoolIsBoundedAndReusesSlots) {
+    auto grid = MakeGrid();
+    std::vector<NoteGrid::Handle> handles;
+    for (int i = 0; i < NoteGrid::Capacity; ++i) handles.push_back(grid->Insert(MakeNote(i, i % 4, i % 3, i * 0.01f)));
+    EXPECT_EQ(grid->Insert(MakeNote(9999, 0, 0, 0.0f)), NoteGrid::None);
+
+    EXPECT_TRUE(grid->Remove(handles[10], 10));
+    EXPECT_EQ(grid->Insert(MakeNote(9999, 0, 0, 0.0f)), handles[10]);
+    // The old key no longer matches the reused slot
+    EXPECT_FALSE(grid->Remove(handles[10], 10));
+
+    grid->Clear();
+    EXPECT_EQ(grid->Size(), 0);
+}
+
+TEST(NoteGridTest, FindsNotesByKeyThroughRemovals) {
+    auto grid = MakeGrid();
+    // Keys like heap pointers: same low bits, so their probe runs overlap
+    auto key = [](int i) { return 0x7000'0000'0000ull + static_cast<uint64_t>(i) * 0x40; };
+    std::vector<NoteGrid::Handle> handles;
+    for (int i = 0; i < NoteGrid::Capacity; ++i) handles.push_back(grid->Insert(MakeNote(key(i), i % 4, i % 3, i * 0.01f)));
+
+    for (int i = 0; i < NoteGrid::Capacity; i += 3) EXPECT_TRUE(grid->Remove(grid->Find(key(i)), key(i)));
+    for (int i = 0; i < NoteGrid::Capacity; ++i) {
+        EXPECT_EQ(grid->Find(key(i)), i % 3 == 0 ? NoteGrid::None : handles[i]) << i;
+    }
+
+    grid->Clear();
+    EXPECT_EQ(grid->Find(key(1)), NoteGrid::None);
+}
+
+TEST(NoteGridTest, FollowsTheJumpArcNotTheArrivalHeight) {
+    auto grid = MakeGrid();
+    float now = 5.0f;
+    // Top layer, 0.4 s out; still rising, 0.48 m below its arrival height
+    NoteGrid::Note note = MakeNote(1, 1, 2, now + 0.4f);
+    note.verticalVelocity = 0.0f;
+    note.gravity = Gravity;
+    grid->Insert(note);
+
+    Vec3 at = grid->PositionAt(note, now);
+    EXPECT_NEAR(at.y, Constants::NOTE_LAYER_HEIGHTS[2] - 0.48f, 1e-4f);
+    EXPECT_NEAR(at.z, 0.4f * Speed, 1e-4f);
+
+    auto none = [](const NoteGrid::Note&, const Vec3&) {};
+    // A short blade swept through where it really is
+    EXPECT_EQ(grid->Query(Swipe(LaneX(0), 0.7f, at.z, at.y - 0.1f, at.y + 0.1f), now, dt, none), 1);
+    // and one at its arrival height, which it has not reached yet
+    float top = Constants::NOTE_LAYER_HEIGHTS[2];
+    EXPECT_EQ(grid->Query(Swipe(LaneX(0), 0.7f, at.z, top, top + 0.3f), now, dt, none), 0);
+}
+
+TEST(NoteGridTest, FollowsRotatedLanes) {
+    auto grid = MakeGrid();
+    float now = 5.0f;
+    // A 360 map note coming in from the side
+    NoteGrid::Note note = MakeNote(1, 3, 1, now + 0.25f);
+    note.rotation = Yaw(90.0f);
+    grid->Insert(note);
+
+    Vec3 at = grid->PositionAt(note, now);
+    EXPECT_NEAR(at.x, 0.25f * Speed, 1e-4f);
+    EXPECT_NEAR(at.z, -LaneX(3), 1e-4f);
+
+    auto none = [](const NoteGrid::Note&, const Vec3&) {};
+    // A blade swept across its rotated lane cuts it
+    SweptBlade across{{at.x, 0.8f, at.z - 0.4f}, {at.x, 2.0f, at.z - 0.4f}, {at.x, 0.8f, at.z + 0.4f}, {at.x, 2.0f, at.z + 0.4f}};
+    EXPECT_EQ(grid->Query(across, now, dt, none), 1);
+    // The same sweep where the unrotated lane would be does not
+    EXPECT_EQ(grid->Query(Swipe(LaneX(3) - 0.4f, 0.8f, at.x), now, dt, none), 0);
+}
+
+namespace {
+    // Dense map: count notes over the next seconds, all in the grid at once
+    struct DenseMap {
+        std::unique_ptr<NoteGrid> grid = MakeGrid();
+        std::vector<NoteGrid::Note> notes;
+
+        // arcs puts every note on a jump arc; turns spreads them over the
+        // lanes of a 360 map
+        DenseMap(int count, float now, float seconds, bool arcs = false, bool turns = false) {
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<int> line(0, 3), layer(0, 2), turn(-2, 2);
+            for (int i = 0; i < count; ++i) {
+                notes.push_back(MakeNote(i, line(rng), layer(rng), now + seconds * i / count));
+                if (arcs) notes.back().gravity = Gravity;
+                if (turns) notes.back().rotation = Yaw(turn(rng) * 15.0f);
+                grid->Insert(notes.back());
+            }
+        }
+
+        // Every note through the same swept test, for reference
+        int BruteForce(const SweptBlade& blade, float now) const {
+            int hits = 0;
+            for (const auto& note : notes) {
+                Vec3 from = grid->PositionAt(note, now - dt), to = grid->PositionAt(note, now), point;
+                SweptBlade relative{blade.base0 - from, blade.tip0 - from, blade.base1 - to, blade.tip1 - to};
+                if (SweptBladeHits(relative, Zero3(), Constants::NOTE_CUT_RADIUS, point)) hits++;
+            }
+            return hits;
+        }
+    };
+
+    // A thrown saber tumbling through the lanes between 1 and 9 m out
+    SweptBlade Tumble(int frame) {
+        float angle = frame * 0.35f;
+        float z = 1.0f + static_cast<float>(frame % 80) * 0.1f;
+        Vec3 base{0.8f * std::sin(frame * 0.05f), 1.3f, z};
+        Vec3 tip0 = base + Vec3{std::cos(angle), std::sin(angle), 0.0f} * Constants::SABER_BLADE_LENGTH;
+        Vec3 tip1 = base + Vec3{std::cos(angle + 0.35f), std::sin(angle + 0.35f), 0.0f} * Constants::SABER_BLADE_LENGTH;
+        return {base, tip0, base + Vec3{0.0f, 0.0f, 0.1f}, tip1 + Vec3{0.0f, 0.0f, 0.1f}};
+    }
+}
+
+TEST(NoteGridTest, MatchesBruteForceAndOnlyVisitsNearbyNotes) {
+    float now = 30.0f;
+    DenseMap map(600, now, 6.0f);
+    ASSERT_EQ(map.grid->Size(), 600);
+
+    int total = 0;
+    uint32_t worst = 0;
+    for (int frame = 0; frame < 200; ++frame) {
+        SweptBlade blade = Tumble(frame);
+        int hits = map.grid->Query(blade, now, dt, [](const NoteGrid::Note&, const Vec3&) {});
+        EXPECT_EQ(hits, map.BruteForce(blade, now));
+        total += hits;
+        worst = std::max(worst, map.grid->GetCandidateCount());
+    }
+    EXPECT_GT(total, 0);
+    // A blade's reach spans a few time buckets out of the 6 s of notes
+    EXPECT_LT(worst, 150u);
+}
+
+TEST(NoteGridTest, MatchesBruteForceOnArcsAndRotatedLanes) {
+    float now = 30.0f;
+    for (bool turns : {false, true}) {
+        DenseMap map(600, now, 6.0f, true, turns);
+        int total = 0;
+        for (int frame = 0; frame < 200; ++frame) {
+            SweptBlade blade = Tumble(frame);
+            int hits = map.grid->Query(blade, now, dt, [](const NoteGrid::Note&, const Vec3&) {});
+            EXPECT_EQ(hits, map.BruteForce(blade, now)) << frame;
+            total += hits;
+        }
+        EXPECT_GT(total, 0);
+    }
+}
+
+TEST(NoteGridTest, BenchmarkDenseMapQuery) {
+    float now = 30.0f;
+    for (int count : {100, 500, 1000}) {
+        DenseMap map(count, now, 6.0f);
+        double grid = MeasureNsPerOp([&](int i) {
+            DoNotOptimize(map.grid->Query(Tumble(i), now, dt, [](const NoteGrid::Note&, const Vec3&) {}));
+        }, 2000);
+        double brute = MeasureNsPerOp([&](int i) {
+            DoNotOptimize(map.BruteForce(Tumble(i), now));
+        }, 200);
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "NoteGrid::Query (%d notes)", count);
+        ReportNs(name, grid);
+        std::snprintf(name, sizeof(name), "Brute-force swept test (%d notes)", count);
+        ReportNs(name, brute);
+    }
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/PhaseMachine.hpp"
+#include "TrickSaber/Native/SpinModel.hpp"
+#include "TrickSaber/Native/ThrowModel.hpp"
+
+using namespace TrickSaber::Native;
+
+namespace {
+    enum class Light : uint8_t { Off, Green, Amber, Red };
+
+    constexpr TransitionTable<Light, 4> LightTransitions{
+        {Light::Off, Light::Red},
+        {Light::Red, Light::Green},
+        {Light::Green, Light::Amber},
+        {Light::Amber, Light::Red},
+    };
+
+    struct Counter {
+        int greens = 0;
+        int others = 0;
+
+        void OnGreen() { greens++; }
+        void OnOther() { others++; }
+    };
+
+    using CounterStep = void (Counter::*)();
+    using LightMachine = PhaseMachine<LightTransitions, CounterStep>;
+
+    const LightMachine::Handlers LightSteps{&Counter::OnOther, &Counter::OnGreen, &Counter::OnOther, &Counter::OnOther};
+}
+
+// The model tables are checked at compile time, like Go<From, To>
+static_assert(ThrowTransitions.Allowed(ThrowPhase::Thrown, ThrowPhase::Returning));
+static_assert(!ThrowTransitions.Allowed(ThrowPhase::Idle, ThrowPhase::Returning));
+static_assert(!ThrowTransitions.Allowed(ThrowPhase::Done, ThrowPhase::Thrown));
+static_assert(ThrowTransitions.Allowed(ThrowPhase::Done, ThrowPhase::Idle));
+static_assert(SpinTransitions.Allowed(SpinPhase::Spinning, SpinPhase::Completing));
+static_assert(!SpinTransitions.Allowed(SpinPhase::Stopping, SpinPhase::Spinning));
+static_assert(!SpinTransitions.Allowed(SpinPhase::Idle, SpinPhase::Done));
+
+TEST(PhaseMachineTest, TableListsOnlyDeclaredTransitions) {
+    EXPECT_TRUE(LightTransitions.Allowed(Light::Red, Light::Green));
+    EXPECT_FALSE(LightTransitions.Allowed(Light::Green, Light::Red));
+    EXPECT_FALSE(LightTransitions.Allowed(Light::Off, Light::Green));
+    // Every phase may reset
+    EXPECT_TRUE(LightTransitions.Allowed(Light::Amber, Light::Off));
+    // Out of range
+    EXPECT_FALSE(LightTransitions.Allowed(static_cast<Light>(7), Light::Off));
+}
+
+TEST(PhaseMachineTest, HandlerFollowsThePhase) {
+    Counter counter;
+    LightMachine machine{LightSteps};
+    EXPECT_EQ(machine.Get(), Light::Off);
+
+    machine.Go<Light::Off, Light::Red>();
+    (counter.*machine.Handler())();
+    machine.Go<Light::Red, Light::Green>();
+    (counter.*machine.Handler())();
+    (counter.*machine.Handler())();
+    EXPECT_EQ(counter.greens, 2);
+    EXPECT_EQ(counter.others, 1);
+
+    // Run-time transitions are checked against the same table
+    EXPECT_FALSE(machine.TryGo(Light::Red));
+    EXPECT_EQ(machine.Get(), Light::Green);
+    EXPECT_EQ(machine.GetRejectedCount(), 1u);
+    EXPECT_TRUE(machine.TryGo(Light::Amber));
+
+    machine.Reset();
+    EXPECT_EQ(machine.Get(), Light::Off);
+    (counter.*machine.Handler())();
+    EXPECT_EQ(counter.others, 2);
+}
+
+TEST(PhaseMachineTest, SpinFinishFromIdleStaysIdle) {
+    SpinModel model;
+    model.Finish();
+    EXPECT_EQ(model.Phase(), SpinPhase::Idle);
+    // Stepping an idle model is a no-op call
+    EXPECT_EQ(model.Step(1.0f / 90.0f, Zero3()), SpinPhase::Idle);
+}
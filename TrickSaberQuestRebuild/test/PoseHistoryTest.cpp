@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/PoseHistory.hpp"
+
+using namespace TrickSaber::Native;
+
+namespace {
+    Quat AxisAngle(const Vec3& axis, float angle) {
+        float s = std::sin(angle * 0.5f);
+        return {axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f)};
+    }
+
+    // Hand moving at a constant 2 m/s along x while yawing at 3 rad/s
+    void Record(PoseHistory& history, double rateHz, double duration, int keepEvery = 1) {
+        int frames = static_cast<int>(duration * rateHz);
+        for (int i = 0; i < frames; ++i) {
+            if (i % keepEvery != 0) continue;
+            double t = 100.0 + i / rateHz;
+            float local = static_cast<float>(t - 100.0);
+            history.Push(t, {2.0f * local, 1.0f, 0.0f}, AxisAngle({0.0f, 1.0f, 0.0f}, 3.0f * local));
+        }
+    }
+}
+
+class PoseHistoryTest : public ::testing::Test {
+protected:
+    PoseHistory history;
+    Vec3 linear{}, angular{};
+};
+
+TEST_F(PoseHistoryTest, NeedsTwoSamples) {
+    EXPECT_FALSE(history.VelocityAt(0.0, 0.05, linear, angular));
+    history.Push(1.0, Zero3(), IdentityQuat());
+    EXPECT_FALSE(history.VelocityAt(1.0, 0.05, linear, angular));
+}
+
+TEST_F(PoseHistoryTest, SameVelocityAtEveryRefreshRate) {
+    for (double rate : {72.0, 90.0, 120.0}) {
+        history.Clear();
+        Record(history, rate, 0.4);
+        double now = history.Latest().time;
+        ASSERT_TRUE(history.VelocityAt(now, 0.05, linear, angular)) << rate;
+        EXPECT_NEAR(linear.x, 2.0f, 1e-3f) << rate;
+        EXPECT_NEAR(linear.y, 0.0f, 1e-3f) << rate;
+        EXPECT_NEAR(angular.y, 3.0f, 1e-3f) << rate;
+    }
+}
+
+TEST_F(PoseHistoryTest, SkippedTicksDoNotChangeScale) {
+    // The idle path only samples every third tick
+    Record(history, 90.0, 0.4, 3);
+    double now = history.Latest().time;
+    ASSERT_TRUE(history.VelocityAt(now, 0.05, linear, angular));
+    EXPECT_NEAR(linear.x, 2.0f, 1e-3f);
+    EXPECT_NEAR(angular.y, 3.0f, 1e-3f);
+}
+
+TEST_F(PoseHistoryTest, RepeatedFixedStepsAreDropped) {
+    EXPECT_TRUE(history.Push(1.0, {0.0f, 0.0f, 0.0f}, IdentityQuat()));
+    EXPECT_FALSE(history.Push(1.0, {0.0f, 0.0f, 0.0f}, IdentityQuat()));
+    EXPECT_FALSE(history.Push(0.5, {9.0f, 0.0f, 0.0f}, IdentityQuat()));
+    EXPECT_TRUE(history.Push(1.01, {0.01f, 0.0f, 0.0f}, IdentityQuat()));
+    EXPECT_EQ(history.Count(), 2);
+    ASSERT_TRUE(history.VelocityAt(1.01, 0.05, linear, angular));
+    EXPECT_NEAR(linear.x, 1.0f, 1e-3f);
+}
+
+TEST_F(PoseHistoryTest, QueriesAtPastEdgeIgnoreLaterSamples) {
+    // Accelerate after t=0.2s; a query at the edge must not see it
+    for (int i = 0; i < 40; ++i) {
+        double t = i / 90.0;
+        float x = t < 0.2 ? static_cast<float>(t) : static_cast<float>(0.2 + (t - 0.2) * 10.0);
+        history.Push(t, {x, 0.0f, 0.0f}, IdentityQuat());
+    }
+    ASSERT_TRUE(history.VelocityAt(0.19, 0.05, linear, angular));
+    EXPECT_NEAR(linear.x, 1.0f, 1e-3f);
+}
+
+TEST_F(PoseHistoryTest, NarrowWindowWidensToNearestSample) {
+    history.Push(0.0, {0.0f, 0.0f, 0.0f}, IdentityQuat());
+    history.Push(0.1, {0.5f, 0.0f, 0.0f}, IdentityQuat());
+    ASSERT_TRUE(history.VelocityAt(0.1, 0.01, linear, angular));
+    EXPECT_NEAR(linear.x, 5.0f, 1e-3f);
+}
+
+TEST_F(PoseHistoryTest, RingKeepsNewestSamples) {
+    for (int i = 0; i < PoseHistory::Capacity * 3; ++i) {
+        history.Push(i * 0.01, {static_cast<float>(i), 0.0f, 0.0f}, IdentityQuat());
+    }
+    EXPECT_EQ(history.Count(), PoseHistory::Capacity);
+    EXPECT_FLOAT_EQ(history.Latest().position.x, static_cast<float>(PoseHistory::Capacity * 3 - 1));
+    EXPECT_FLOAT_EQ(history.At(0).position.x, static_cast<float>(PoseHistory::Capacity * 2));
+}
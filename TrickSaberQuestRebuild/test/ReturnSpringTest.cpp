@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/ReturnSpring.hpp"
+#include "TrickSaber/Constants.hpp"
+#include "BenchmarkUtils.hpp"
+
+#include <cmath>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    constexpr float Duration = 0.5f;
+    constexpr ReturnSpring::Tolerance Close{Constants::RETURN_ARRIVAL_DISTANCE, Constants::RETURN_ARRIVAL_ANGLE};
+
+    const Vec3 Start{0.0f, 1.0f, 3.0f};
+    const Quat StartRotation = AxisAngle({1.0f, 0.0f, 0.0f}, 2.5f);
+
+    // Steps at hz against a fixed target; returns the time taken to arrive
+    float Arrive(ReturnSpring& spring, float hz, const Vec3& target, int maxSteps = 10000) {
+        float time = 0.0f;
+        for (int i = 0; i < maxSteps; ++i) {
+            time += 1.0f / hz;
+            if (spring.Step(1.0f / hz, target, IdentityQuat())) break;
+        }
+        return time;
+    }
+}
+
+TEST(ReturnSpringTest, RateClosesTheRatioInTheDuration) {
+    for (float ratio : {0.5f, 1e-2f, 1e-4f}) {
+        float rate = CriticalSpringRate(ratio, Duration);
+        float x = rate * Duration;
+        EXPECT_NEAR((1.0f + x) * std::exp(-x), ratio, ratio * 1e-3f);
+    }
+    EXPECT_EQ(CriticalSpringRate(1.0f, Duration), 0.0f);
+    EXPECT_EQ(CriticalSpringRate(0.1f, 0.0f), 0.0f);
+}
+
+TEST(ReturnSpringTest, ArrivesOnTimeAtEveryRefreshRate) {
+    for (float hz : {72.0f, 90.0f, 120.0f, 144.0f, 240.0f}) {
+        SCOPED_TRACE(hz);
+        ReturnSpring spring;
+        spring.Begin(Start, StartRotation, Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close);
+        // First frame at or past the duration, give or take rounding
+        EXPECT_NEAR(Arrive(spring, hz, Zero3()), Duration, 1.0f / hz + 1e-4f);
+        EXPECT_EQ(Magnitude(spring.Position()), 0.0f);
+        EXPECT_EQ(spring.Rotation().w, 1.0f);
+    }
+}
+
+TEST(ReturnSpringTest, PathDoesNotDependOnFrameRate) {
+    ReturnSpring fine, coarse;
+    fine.Begin(Start, StartRotation, Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close);
+    coarse.Begin(Start, StartRotation, Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close);
+    for (int frame = 0; frame < 18; ++frame) {
+        coarse.Step(1.0f / 72.0f, Zero3(), IdentityQuat());
+        for (int i = 0; i < 10; ++i) fine.Step(1.0f / 720.0f, Zero3(), IdentityQuat());
+        EXPECT_LT(Distance(fine.Position(), coarse.Position()), 1e-4f);
+        EXPECT_LT(AngleDegrees(fine.Rotation(), coarse.Rotation()), 0.05f);
+    }
+}
+
+TEST(ReturnSpringTest, NeverOvershootsAStillTarget) {
+    ReturnSpring spring;
+    spring.Begin(Start, IdentityQuat(), Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close);
+    float last = Magnitude(Start);
+    while (!spring.Step(1.0f / 90.0f, Zero3(), IdentityQuat())) {
+        // Moves straight in along the start direction and only gets closer
+        EXPECT_GT(spring.Position().z, 0.0f);
+        float distance = Magnitude(spring.Position());
+        EXPECT_LT(distance, last);
+        last = distance;
+    }
+}
+
+TEST(ReturnSpringTest, FollowsAMovingHandAndArrivesWithinTheBound) {
+    ReturnSpring spring;
+    const float maxTime = Duration * Constants::RETURN_MAX_TIME_SCALE;
+    spring.Begin(Start, StartRotation, Zero3(), IdentityQuat(), Duration, maxTime, Close);
+
+    // Hand swings 0.3 m back and forth at 1.5 Hz while the saber flies in
+    const float dt = 1.0f / 90.0f;
+    const float peakSpeed = spring.Rate() * Magnitude(Start) / std::exp(1.0f) + 0.3f * 9.42f;
+    float time = 0.0f;
+    Vec3 hand = Zero3();
+    Vec3 previous = Start;
+    bool arrived = false;
+    for (int i = 0; i < 1000 && !arrived; ++i) {
+        time += dt;
+        hand = {0.3f * std::sin(time * 9.42f), 0.0f, 0.0f};
+        arrived = spring.Step(dt, hand, IdentityQuat());
+        // No frame moves further than the still-target return plus the hand
+        EXPECT_LT(Distance(spring.Position(), previous), peakSpeed * dt);
+        previous = spring.Position();
+    }
+
+    EXPECT_TRUE(arrived);
+    EXPECT_LE(time, maxTime + dt);
+    EXPECT_EQ(Distance(spring.Position(), hand), 0.0f);
+}
+
+TEST(ReturnSpringTest, StopsEarlyWhenAlreadyClose) {
+    ReturnSpring spring;
+    spring.Begin({0.001f, 0.0f, 0.0f}, IdentityQuat(), Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close);
+    EXPECT_TRUE(spring.Arrived());
+    EXPECT_TRUE(spring.Step(1.0f / 90.0f, Zero3(), IdentityQuat()));
+    EXPECT_EQ(Magnitude(spring.Position()), 0.0f);
+}
+
+TEST(ReturnSpringTest, SpinDampsOutBeforeArrival) {
+    ReturnSpring spring;
+    spring.Begin(Start, IdentityQuat(), Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close, {12.0f, 0.0f, 0.0f});
+    spring.Step(1.0f / 90.0f, Zero3(), IdentityQuat());
+    EXPECT_GT(AngleDegrees(spring.Rotation(), IdentityQuat()), 5.0f);
+    Arrive(spring, 90.0f, Zero3());
+    EXPECT_TRUE(spring.Arrived());
+    EXPECT_LE(spring.Elapsed(), Duration * 2.0f + 1.0f / 90.0f);
+}
+
+TEST(ReturnSpringTest, BenchmarkStep) {
+    ReturnSpring spring;
+    Vec3 target{0.1f, 0.0f, 0.0f};
+    double ns = MeasureNsPerOp([&](int i) {
+        if ((i & 63) == 0) spring.Begin(Start, StartRotation, Zero3(), IdentityQuat(), Duration, Duration * 2.0f, Close);
+        DoNotOptimize(spring.Step(1.0f / 90.0f, target, IdentityQuat()));
+    }, 200000);
+    ReportNs("ReturnSpring::Step", ns);
+}
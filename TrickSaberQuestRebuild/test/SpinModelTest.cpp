@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/SpinModel.hpp"
+#include "TrickSaber/Constants.hpp"
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+
+class SpinModelTest : public ::testing::Test {
+protected:
+    SpinParams params;
+    SpinModel model;
+    static constexpr float dt = 1.0f / 90.0f;
+
+    void SetUp() override {
+        params.direction = SpinDir::Forward;
+        params.spinSpeed = 4.0f;
+    }
+
+    int StepUntilDone(int maxSteps = 10000) {
+        int steps = 0;
+        while (model.Phase() != SpinPhase::Done && steps < maxSteps) {
+            model.Step(dt, Zero3());
+            steps++;
+        }
+        return steps;
+    }
+};
+
+TEST_F(SpinModelTest, FixedTargetSpeedIsSignedSquareOfInput) {
+    EXPECT_FLOAT_EQ(ComputeSpinTargetSpeed(params, 0.5f, Zero3()), 60.0f * 4.0f * 0.25f);
+    EXPECT_FLOAT_EQ(ComputeSpinTargetSpeed(params, -0.5f, Zero3()), -60.0f * 4.0f * 0.25f);
+    params.direction = SpinDir::Backward;
+    EXPECT_FLOAT_EQ(ComputeSpinTargetSpeed(params, 1.0f, Zero3()), -240.0f);
+}
+
+TEST_F(SpinModelTest, VelocityTargetFollowsControllerRotation) {
+    params.velocityDependent = true;
+    params.spinSpeed = 1.0f;
+    float speed = ComputeSpinTargetSpeed(params, 1.0f, {3.0f, 4.0f, 9.0f});
+    EXPECT_NEAR(speed, 5.0f * Constants::RADIANS_TO_DEGREES, 1e-3f);
+    // Jitter floor while the stick is held but the hand is still
+    EXPECT_FLOAT_EQ(ComputeSpinTargetSpeed(params, 1.0f, Zero3()), 5.0f);
+}
+
+TEST_F(SpinModelTest, AcceleratesTowardsTargetAndRotatesAboutForward) {
+    model.Start(params, IdentityQuat(), 1.0f, Zero3());
+    for (int i = 0; i < 90; ++i) model.Step(dt, Zero3());
+    EXPECT_NEAR(model.Speed(), 240.0f, 1e-3f);
+    const Quat& q = model.LocalRotation();
+    EXPECT_NEAR(q.x, 0.0f, 1e-5f);
+    EXPECT_NEAR(q.y, 0.0f, 1e-5f);
+    EXPECT_GT(std::fabs(q.z), 0.1f);
+}
+
+TEST_F(SpinModelTest, SlowReleaseEndsImmediately) {
+    model.Start(params, IdentityQuat(), 1.0f, Zero3());
+    model.Step(dt, Zero3());
+    EXPECT_TRUE(model.Release());
+    EXPECT_EQ(model.Phase(), SpinPhase::Done);
+    EXPECT_FLOAT_EQ(model.LocalRotation().w, 1.0f);
+}
+
+TEST_F(SpinModelTest, FastReleaseWindsDownThenRealigns) {
+    model.Start(params, IdentityQuat(), 1.0f, Zero3());
+    for (int i = 0; i < 90; ++i) model.Step(dt, Zero3());
+    EXPECT_FALSE(model.Release());
+    EXPECT_EQ(model.Phase(), SpinPhase::Stopping);
+    int steps = StepUntilDone();
+    EXPECT_EQ(model.Phase(), SpinPhase::Done);
+    EXPECT_GT(steps, 60);   // 240 deg/s at 300 deg/s^2 takes 0.8s
+    EXPECT_LT(AngleDegrees(model.LocalRotation(), model.OriginalRotation()), 1e-3f);
+}
+
+TEST_F(SpinModelTest, CompleteRotationKeepsSpinningUntilAligned) {
+    params.completeRotation = true;
+    model.Start(params, IdentityQuat(), 1.0f, Zero3());
+    for (int i = 0; i < 30; ++i) model.Step(dt, Zero3());
+    EXPECT_FALSE(model.Release());
+    EXPECT_EQ(model.Phase(), SpinPhase::Completing);
+    StepUntilDone();
+    EXPECT_EQ(model.Phase(), SpinPhase::Done);
+    EXPECT_FLOAT_EQ(model.LocalRotation().w, 1.0f);
+}
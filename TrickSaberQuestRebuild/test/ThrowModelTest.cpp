@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/ThrowModel.hpp"
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+
+class ThrowModelTest : public ::testing::Test {
+protected:
+    ThrowParams params;
+    ThrowModel model;
+    static constexpr float dt = 1.0f / 90.0f;
+    const Vec3 forward{0.0f, 0.0f, 1.0f};
+
+    void SetUp() override {
+        params.snapBackDistance = 2.0f;
+    }
+
+    // Steps until the model leaves phase or maxSteps pass; returns steps taken
+    int StepWhile(ThrowPhase phase, const Vec3& hand, int maxSteps = 10000) {
+        int steps = 0;
+        while (model.Phase() == phase && steps < maxSteps) {
+            model.Step(dt, hand, IdentityQuat());
+            steps++;
+        }
+        return steps;
+    }
+};
+
+TEST_F(ThrowModelTest, FixedModeUsesControllerDirectionAtConfiguredSpeed) {
+    auto launch = ComputeThrowLaunch(params, {0.0f, 3.0f, 4.0f}, {-1.0f, 0.0f, 0.0f}, forward);
+    float speed = params.throwVelocity * params.throwVelocityMultiplier;
+    EXPECT_NEAR(launch.velocity.y, 0.6f * speed, 1e-5f);
+    EXPECT_NEAR(launch.velocity.z, 0.8f * speed, 1e-5f);
+    EXPECT_FLOAT_EQ(launch.spinSpeed, -params.throwVelocity * Constants::SPIN_VELOCITY_SCALE);
+
+    auto still = ComputeThrowLaunch(params, Zero3(), Zero3(), forward);
+    EXPECT_NEAR(still.velocity.z, speed, 1e-5f);
+}
+
+TEST_F(ThrowModelTest, VelocityModeFloorsSlowThrowsAlongForward) {
+    params.velocityDependent = true;
+    auto fast = ComputeThrowLaunch(params, {2.0f, 0.0f, 0.0f}, {0.0f, 3.0f, 0.0f}, forward);
+    EXPECT_FLOAT_EQ(fast.velocity.x, 2.0f * params.throwVelocity * 2.0f);
+    EXPECT_NEAR(fast.spinSpeed, 3.0f * Constants::RADIANS_TO_DEGREES, 1e-3f);
+
+    auto slow = ComputeThrowLaunch(params, {0.01f, 0.0f, 0.0f}, Zero3(), forward);
+    EXPECT_FLOAT_EQ(slow.velocity.z, params.velocityThreshold * params.throwVelocity);
+}
+
+TEST_F(ThrowModelTest, SnapsBackPastDistanceAndReturnsToTarget) {
+    model.Launch(params, Zero3(), IdentityQuat(), {{0.0f, 0.0f, 6.0f}, 360.0f});
+    int flight = StepWhile(ThrowPhase::Thrown, Zero3());
+    EXPECT_EQ(model.Phase(), ThrowPhase::Returning);
+    // 2m at 6 m/s is ~30 ticks at 90 Hz
+    EXPECT_NEAR(flight, 31, 1);
+
+    int back = StepWhile(ThrowPhase::Returning, Zero3());
+    EXPECT_EQ(model.Phase(), ThrowPhase::Done);
+    EXPECT_NEAR(back * dt, params.returnDuration, 2 * dt);
+    EXPECT_NEAR(Magnitude(model.Position()), 0.0f, 1e-5f);
+}
+
+TEST_F(ThrowModelTest, EarlyReleaseReturnsFromCurrentPose) {
+    model.Launch(params, Zero3(), IdentityQuat(), {{1.0f, 0.0f, 0.0f}, 0.0f});
+    for (int i = 0; i < 9; ++i) model.Step(dt, Zero3(), IdentityQuat());
+    Vec3 released = model.Position();
+    model.BeginReturn();
+    model.Step(dt, Zero3(), IdentityQuat());
+    EXPECT_EQ(model.Phase(), ThrowPhase::Returning);
+    EXPECT_LT(model.Position().x, released.x);
+    EXPECT_GT(model.Position().x, 0.0f);
+}
+
+TEST_F(ThrowModelTest, SimplifiedFlightFallsUnderGravity) {
+    params.simplified = true;
+    model.Launch(params, Zero3(), IdentityQuat(), {{0.0f, 0.0f, 1.0f}, 0.0f});
+    for (int i = 0; i < 45; ++i) model.Step(dt, Zero3(), IdentityQuat());
+    EXPECT_NEAR(model.Velocity().y, -Constants::GRAVITY_ACCELERATION * 0.5f, 1e-3f);
+    EXPECT_LT(model.Position().y, -1.0f);
+}
+
+TEST_F(ThrowModelTest, ClosedFormFlightMatchesFineIntegration) {
+    BallisticFlight flight;
+    flight.velocity = {2.0f, 6.0f, 5.0f};
+    flight.gravity = {0.0f, -Constants::GRAVITY_ACCELERATION * 0.7f, 0.0f};
+    flight.drag = BallisticFlight::RateFromRetention(0.6f);
+    flight.spin = 720.0f;
+    flight.spinDamping = BallisticFlight::RateFromRetention(0.5f);
+
+    // Semi-implicit Euler at 10 kHz as the reference
+    Vec3 position = Zero3(), velocity = flight.velocity;
+    float angle = 0.0f, spin = flight.spin;
+    const float h = 1e-4f;
+    for (int i = 0; i < 10000; ++i) {
+        velocity += (flight.gravity - velocity * flight.drag) * h;
+        position += velocity * h;
+        spin -= spin * flight.spinDamping * h;
+        angle += spin * h;
+    }
+
+    EXPECT_LT(Distance(flight.PositionAt(1.0f), position), 2e-3f);
+    EXPECT_LT(Distance(flight.VelocityAt(1.0f), velocity), 2e-3f);
+    EXPECT_NEAR(flight.SpinAngleAt(1.0f), angle, 0.1f);
+    // Half the spin is kept after one second
+    EXPECT_NEAR(flight.spin * std::exp(-flight.spinDamping), 360.0f, 1e-2f);
+}
+
+TEST_F(ThrowModelTest, TimeToDistanceIsExact) {
+    BallisticFlight straight;
+    straight.velocity = {0.0f, 0.0f, 4.0f};
+    straight.drag = BallisticFlight::RateFromRetention(0.5f);
+    float t = straight.TimeToDistance(3.0f, 10.0f);
+    EXPECT_NEAR(Magnitude(straight.PositionAt(t)), 3.0f, 1e-4f);
+    // 4 m/s with this drag coasts to 4 / ln 2 = 5.77 m at most
+    EXPECT_TRUE(std::isinf(straight.TimeToDistance(6.0f, 10.0f)));
+
+    BallisticFlight lob = straight;
+    lob.velocity = {0.0f, 5.0f, 2.0f};
+    lob.gravity = {0.0f, -Constants::GRAVITY_ACCELERATION, 0.0f};
+    t = lob.TimeToDistance(2.5f, 10.0f);
+    EXPECT_NEAR(Magnitude(lob.PositionAt(t)), 2.5f, 1e-4f);
+    EXPECT_LT(Magnitude(lob.PositionAt(t * 0.9f)), 2.5f);
+}
+
+TEST_F(ThrowModelTest, ConfigDragAndDistanceCapShortenTheFlight) {
+    params.maxThrowDistance = 1.0f;
+    model.Launch(params, Zero3(), IdentityQuat(), {{0.0f, 0.0f, 6.0f}, 0.0f});
+    EXPECT_NEAR(model.SnapTime(), 1.0f / 6.0f, 1e-5f);
+
+    params.maxThrowDistance = 0.0f;
+    params.airResistance = 0.5f;
+    model.Launch(params, Zero3(), IdentityQuat(), {{0.0f, 0.0f, 6.0f}, 0.0f});
+    EXPECT_GT(model.SnapTime(), 2.0f / 6.0f);
+    EXPECT_NEAR(Magnitude(model.Flight().PositionAt(model.SnapTime())), 2.0f, 1e-4f);
+}
+
+TEST_F(ThrowModelTest, SkippedFramesLandOnTheSamePose) {
+    params.simplified = true;
+    params.snapBackDistance = 50.0f;
+    params.airResistance = 0.8f;
+    params.angularDamping = 0.7f;
+    const ThrowLaunch launch{{1.0f, 4.0f, 3.0f}, 400.0f};
+
+    ThrowModel smooth, skipped;
+    smooth.Launch(params, Zero3(), IdentityQuat(), launch);
+    skipped.Launch(params, Zero3(), IdentityQuat(), launch);
+    for (int i = 0; i < 72; ++i) smooth.Step(1.0f / 72.0f, Zero3(), IdentityQuat());
+    for (int i = 0; i < 8; ++i) skipped.Step(9.0f / 72.0f, Zero3(), IdentityQuat());
+
+    EXPECT_EQ(smooth.Substeps(), skipped.Substeps());
+    EXPECT_LT(Distance(smooth.Position(), skipped.Position()), 1e-5f);
+    EXPECT_LT(AngleDegrees(smooth.Rotation(), skipped.Rotation()), 1e-2f);
+    EXPECT_LT(Distance(smooth.Position(), smooth.Flight().PositionAt(1.0f)), 1e-4f);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/TrickLifecycle.hpp"
+#include "TrickSaber/Native/TrickRegistry.hpp"
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+
+namespace {
+    // Stands in for SaberTrickManager: counts the lifecycle events it would
+    // publish, with OnTrickEnded guarded the same way
+    struct Manager {
+        TrickLifecycle lifecycle;
+        int started = 0;
+        int ending = 0;
+        int ended = 0;
+
+        void OnTrickStarted(TrickAction action) { lifecycle.Start(action); started++; }
+        void OnTrickEnded(TrickAction action) { if (lifecycle.End(action)) ended++; }
+    };
+
+    struct FakeTrick {
+        bool StartTrick(float) { active = true; return true; }
+        void EndTrick() { active = false; }
+        void Tick() {}
+        bool IsActive() const { return active; }
+        bool IsTrickInState(int) const { return active; }
+
+        Manager* manager = nullptr;
+        bool active = false;
+    };
+
+    // Ends quietly, like SpinTrick::EndTrickImmediately
+    struct QuietTrick final : FakeTrick {
+        void EndTrickImmediately() { active = false; }
+    };
+
+    // Reports its own end, like ThrowTrick::ThrowEnd
+    template<TrickAction A>
+    struct ReportingTrick final : FakeTrick {
+        void EndTrickImmediately() {
+            active = false;
+            manager->OnTrickEnded(A);
+        }
+    };
+
+    using Registry = TrickRegistry<FakeTrick,
+        TrickEntry<TrickDescriptor{TrickAction::Spin, TrickInput::Hold}, QuietTrick>,
+        TrickEntry<TrickDescriptor{TrickAction::Throw, TrickInput::Hold}, ReportingTrick<TrickAction::Throw>>,
+        TrickEntry<TrickDescriptor{TrickAction::FreezeThrow, TrickInput::Hold}, ReportingTrick<TrickAction::FreezeThrow>>>;
+
+    struct Fixture {
+        Manager manager;
+        QuietTrick spin;
+        ReportingTrick<TrickAction::Throw> throwTrick;
+        ReportingTrick<TrickAction::FreezeThrow> freeze;
+        Registry tricks;
+
+        Fixture() {
+            for (FakeTrick* trick : {static_cast<FakeTrick*>(&spin), static_cast<FakeTrick*>(&throwTrick),
+                     static_cast<FakeTrick*>(&freeze)}) {
+                trick->manager = &manager;
+            }
+            tricks.Set<TrickAction::Spin>(&spin);
+            tricks.Set<TrickAction::Throw>(&throwTrick);
+            tricks.Set<TrickAction::FreezeThrow>(&freeze);
+        }
+
+        void Start(TrickAction action) {
+            ASSERT_TRUE(tricks.Start(action, 1.0f));
+            manager.OnTrickStarted(action);
+        }
+
+        void EndAll() {
+            manager.lifecycle.EndAll(tricks,
+                [&](TrickAction) { manager.ending++; },
+                [&](TrickAction) { manager.ended++; });
+        }
+    };
+}
+
+TEST(TrickLifecycleTest, EndAllPublishesOneEndedPerStarted) {
+    for (TrickAction action : {TrickAction::Spin, TrickAction::Throw, TrickAction::FreezeThrow}) {
+        Fixture f;
+        f.Start(action);
+        f.EndAll();
+        EXPECT_EQ(f.manager.started, 1) << static_cast<int>(action);
+        EXPECT_EQ(f.manager.ending, 1) << static_cast<int>(action);
+        EXPECT_EQ(f.manager.ended, 1) << static_cast<int>(action);
+        EXPECT_FALSE(f.manager.lifecycle.IsRunning());
+    }
+}
+
+TEST(TrickLifecycleTest, EndOnlyCountsTheRunningTrickOnce) {
+    Fixture f;
+    f.Start(TrickAction::Throw);
+    f.manager.OnTrickEnded(TrickAction::Spin);
+    EXPECT_EQ(f.manager.ended, 0);
+
+    // Ended on its own, then reported again from the error path
+    f.throwTrick.EndTrick();
+    f.manager.OnTrickEnded(TrickAction::Throw);
+    f.manager.OnTrickEnded(TrickAction::Throw);
+    EXPECT_EQ(f.manager.ended, 1);
+
+    // Nothing running: EndAll is quiet
+    f.EndAll();
+    EXPECT_EQ(f.manager.ended, 1);
+    EXPECT_EQ(f.manager.ending, 0);
+}
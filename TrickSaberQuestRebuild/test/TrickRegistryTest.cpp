@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/TrickRegistry.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    struct FakeTrick {
+        virtual ~FakeTrick() = default;
+        virtual bool StartTrick(float value) { active = true; return true; }
+        virtual void EndTrick() { active = false; }
+        virtual void EndTrickImmediately() { active = false; }
+        virtual void Tick() {}
+        bool IsActive() const { return active; }
+        bool IsTrickInState(int state) const { return active && state == static_cast<int>(TrickState::Started); }
+
+        bool active = false;
+        int ticks = 0;
+    };
+
+    struct FakeSpin final : FakeTrick {
+        void Tick() override { ticks++; }
+        void SetInput(float value) { input = value; }
+        float input = 0.0f;
+    };
+
+    struct FakeThrow final : FakeTrick {
+        void Tick() override { ticks += 2; }
+        void Arm() { armed = true; }
+        void Disarm() { armed = false; }
+        bool IsArmed() const { return armed; }
+        bool armed = false;
+    };
+
+    // The synthetic trick: registered on an action no shipped trick uses.
+    // Ends itself after a fixed number of ticks, like a timed return.
+    struct FakeFreeze final : FakeTrick {
+        bool StartTrick(float value) override {
+            if (value <= 0.0f) return false;
+            remaining = 3;
+            return FakeTrick::StartTrick(value);
+        }
+        void Tick() override {
+            ticks++;
+            if (--remaining == 0) active = false;
+        }
+        int remaining = 0;
+    };
+
+    constexpr TrickDescriptor SpinDescriptor{TrickAction::Spin, TrickInput::Hold | TrickInput::Analog};
+    constexpr TrickDescriptor ThrowDescriptor{TrickAction::Throw, TrickInput::Hold | TrickInput::PreArm};
+    constexpr TrickDescriptor FreezeDescriptor{TrickAction::FreezeThrow, TrickInput::Hold};
+
+    using BaseRegistry = TrickRegistry<FakeTrick,
+        TrickEntry<SpinDescriptor, FakeSpin>,
+        TrickEntry<ThrowDescriptor, FakeThrow>>;
+
+    using FullRegistry = TrickRegistry<FakeTrick,
+        TrickEntry<SpinDescriptor, FakeSpin>,
+        TrickEntry<ThrowDescriptor, FakeThrow>,
+        TrickEntry<FreezeDescriptor, FakeFreeze>>;
+
+    // Owns what Build creates, as the GameObject owns the components
+    struct Pool {
+        std::vector<std::unique_ptr<FakeTrick>> owned;
+
+        template<typename Registry>
+        int Fill(Registry& registry) {
+            return registry.Build([&](auto type) {
+                using T = typename decltype(type)::type;
+                auto trick = std::make_unique<T>();
+                T* raw = trick.get();
+                owned.push_back(std::move(trick));
+                return raw;
+            });
+        }
+    };
+}
+
+TEST(TrickRegistryTest, DescriptorsAreIndexedByAction) {
+    static_assert(FullRegistry::Size() == 3);
+    static_assert(FullRegistry::IsRegistered(TrickAction::FreezeThrow));
+    static_assert(!BaseRegistry::IsRegistered(TrickAction::FreezeThrow));
+    static_assert(!FullRegistry::IsRegistered(TrickAction::None));
+    static_assert(FullRegistry::Describe(TrickAction::Spin).Has(TrickInput::Analog));
+    static_assert(!FullRegistry::Describe(TrickAction::Throw).Has(TrickInput::Analog));
+    static_assert(FullRegistry::Describe(TrickAction::None).input == 0);
+
+    EXPECT_EQ(FullRegistry::Describe(TrickAction::FreezeThrow).action, TrickAction::FreezeThrow);
+    EXPECT_TRUE(FullRegistry::Describe(TrickAction::Throw).Has(TrickInput::PreArm));
+}
+
+TEST(TrickRegistryTest, BuildFillsOneInstancePerType) {
+    FullRegistry registry;
+    Pool pool;
+    EXPECT_EQ(pool.Fill(registry), 3);
+    EXPECT_EQ(pool.owned.size(), 3u);
+    EXPECT_NE(registry.Get<TrickAction::FreezeThrow>(), nullptr);
+
+    // A factory that fails for one type leaves just that slot empty
+    BaseRegistry partial;
+    int built = partial.Build([](auto type) -> typename decltype(type)::type* { return nullptr; });
+    EXPECT_EQ(built, 0);
+    EXPECT_FALSE(partial.Start(TrickAction::Spin, 1.0f));
+}
+
+TEST(TrickRegistryTest, SyntheticTrickRunsThroughTheStateMachine) {
+    FullRegistry registry;
+    Pool pool;
+    pool.Fill(registry);
+    auto freeze = registry.Get<TrickAction::FreezeThrow>();
+
+    EXPECT_FALSE(registry.Start(TrickAction::FreezeThrow, 0.0f));
+    EXPECT_TRUE(registry.Start(TrickAction::FreezeThrow, 1.0f));
+    EXPECT_TRUE(registry.IsActive(TrickAction::FreezeThrow));
+    EXPECT_TRUE(registry.IsInState(TrickAction::FreezeThrow, TrickState::Started));
+
+    for (int i = 0; i < 5; ++i) registry.Tick(TrickAction::FreezeThrow);
+    EXPECT_EQ(freeze->ticks, 3);    // not ticked once it ended itself
+    EXPECT_FALSE(registry.IsActive(TrickAction::FreezeThrow));
+
+    // Optional hooks: only types that declare them, only with the input flag
+    registry.SetInput(TrickAction::Spin, 0.5f);
+    registry.SetInput(TrickAction::FreezeThrow, 0.5f);
+    EXPECT_FLOAT_EQ(registry.Get<TrickAction::Spin>()->input, 0.5f);
+
+    registry.Arm(TrickAction::Throw, true);
+    registry.Arm(TrickAction::FreezeThrow, true);
+    EXPECT_TRUE(registry.IsArmed(TrickAction::Throw));
+    EXPECT_FALSE(registry.IsArmed(TrickAction::FreezeThrow));
+    registry.Arm(TrickAction::Throw, false);
+    EXPECT_FALSE(registry.IsArmed(TrickAction::Throw));
+
+    registry.Start(TrickAction::Spin, 1.0f);
+    registry.EndImmediately(TrickAction::Spin);
+    EXPECT_FALSE(registry.IsActive(TrickAction::Spin));
+}
+
+TEST(TrickRegistryTest, BenchmarkDispatchCost) {
+    BaseRegistry base;
+    FullRegistry full;
+    Pool basePool, fullPool;
+    basePool.Fill(base);
+    fullPool.Fill(full);
+    base.Start(TrickAction::Spin, 1.0f);
+    base.Start(TrickAction::Throw, 1.0f);
+    full.Start(TrickAction::Spin, 1.0f);
+    full.Start(TrickAction::Throw, 1.0f);
+
+    // Before the registry: map lookup plus a virtual call
+    std::unordered_map<TrickAction, FakeTrick*> map;
+    for (auto& trick : fullPool.owned) {
+        if (auto spin = dynamic_cast<FakeSpin*>(trick.get())) map[TrickAction::Spin] = spin;
+        else if (auto throwTrick = dynamic_cast<FakeThrow*>(trick.get())) map[TrickAction::Throw] = throwTrick;
+    }
+
+    auto actionFor = [](int i) { return (i & 1) ? TrickAction::Throw : TrickAction::Spin; };
+
+    double mapNs = MeasureNsPerOp([&](int i) {
+        auto it = map.find(actionFor(i));
+        if (it != map.end() && it->second->IsActive()) it->second->Tick();
+    }, 500000);
+
+    double baseNs = MeasureNsPerOp([&](int i) {
+        base.Tick(actionFor(i));
+    }, 500000);
+
+    // Same two running tricks, one more registered type
+    double fullNs = MeasureNsPerOp([&](int i) {
+        full.Tick(actionFor(i));
+    }, 500000);
+
+    ReportNs("unordered_map find + virtual Tick", mapNs);
+    ReportNs("TrickRegistry::Tick, 2 types", baseNs);
+    ReportNs("TrickRegistry::Tick, 3 types", fullNs);
+    DoNotOptimize(full.Get<TrickAction::Spin>()->ticks);
+
+    EXPECT_LT(baseNs, mapNs * 1.5 + 5.0);
+    // A registered type that is not running adds at most a compare
+    EXPECT_LT(fullNs, baseNs * 1.5 + 5.0);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/TrickSlots.hpp"
+
+#include <unordered_map>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    struct FakeTrick {
+        virtual ~FakeTrick() = default;
+        virtual int Step(int value) { return value; }
+        int started = 0;
+    };
+
+    struct FakeSpin final : FakeTrick {
+        int Step(int value) override { return value + 1; }
+        float inputValue = 0.0f;
+    };
+
+    struct FakeThrow final : FakeTrick {
+        int Step(int value) override { return value * 2; }
+        bool armed = false;
+    };
+
+    using FakeTable = TrickSlots<FakeTrick,
+        TrickSlot<TrickAction::Spin, FakeSpin>,
+        TrickSlot<TrickAction::Throw, FakeThrow>>;
+}
+
+TEST(TrickSlotsTest, SlotsAreIndexedByAction) {
+    FakeTable table;
+    FakeSpin spin;
+    FakeThrow throwTrick;
+
+    EXPECT_EQ(table.Count(), 0);
+    table.Set<TrickAction::Spin>(&spin);
+    table.Set<TrickAction::Throw>(&throwTrick);
+    EXPECT_EQ(table.Count(), 2);
+
+    static_assert(std::is_same_v<FakeTable::TypeOf<TrickAction::Throw>, FakeThrow>);
+    EXPECT_EQ(table.Get<TrickAction::Spin>(), &spin);
+    EXPECT_EQ(table.Get(TrickAction::Throw), &throwTrick);
+    EXPECT_EQ(table.Get(TrickAction::None), nullptr);
+    EXPECT_EQ(table.Get(TrickAction::FreezeThrow), nullptr);
+
+    table.Clear();
+    EXPECT_EQ(table.Count(), 0);
+}
+
+TEST(TrickSlotsTest, VisitCallsTheConcreteType) {
+    FakeTable table;
+    FakeSpin spin;
+    FakeThrow throwTrick;
+    table.Set<TrickAction::Spin>(&spin);
+    table.Set<TrickAction::Throw>(&throwTrick);
+
+    int result = 0;
+    // The callback is instantiated for every type in the list
+    EXPECT_TRUE(table.Visit(TrickAction::Throw, [&](auto trick) {
+        if constexpr (std::is_same_v<decltype(trick), FakeThrow*>) {
+            trick->armed = true;
+        }
+        result = trick->Step(5);
+    }));
+    EXPECT_TRUE(throwTrick.armed);
+    EXPECT_EQ(result, 10);
+
+    // Unbound and empty slots report false without calling
+    EXPECT_FALSE(table.Visit(TrickAction::FreezeThrow, [&](auto) { result = -1; }));
+    EXPECT_FALSE(table.Visit(TrickAction::None, [&](auto) { result = -1; }));
+    EXPECT_EQ(result, 10);
+
+    int visited = 0;
+    table.ForEach([&](TrickAction action, auto trick) {
+        trick->started++;
+        visited += static_cast<int>(action);
+    });
+    EXPECT_EQ(spin.started, 1);
+    EXPECT_EQ(throwTrick.started, 1);
+    EXPECT_EQ(visited, static_cast<int>(TrickAction::Spin) + static_cast<int>(TrickAction::Throw));
+}
+
+TEST(TrickSlotsTest, BenchmarkSlotDispatchAgainstMapLookup) {
+    FakeSpin spin;
+    FakeThrow throwTrick;
+
+    std::unordered_map<TrickAction, FakeTrick*> map{
+        {TrickAction::Spin, &spin}, {TrickAction::Throw, &throwTrick}};
+    FakeTable table;
+    table.Set<TrickAction::Spin>(&spin);
+    table.Set<TrickAction::Throw>(&throwTrick);
+
+    auto actionFor = [](int i) { return (i & 1) ? TrickAction::Throw : TrickAction::Spin; };
+
+    double mapNs = MeasureNsPerOp([&](int i) {
+        auto it = map.find(actionFor(i));
+        int value = it != map.end() && it->second ? it->second->Step(i) : 0;
+        DoNotOptimize(value);
+    }, 500000);
+
+    double slotNs = MeasureNsPerOp([&](int i) {
+        int value = 0;
+        table.Visit(actionFor(i), [&](auto trick) { value = trick->Step(i); });
+        DoNotOptimize(value);
+    }, 500000);
+
+    ReportNs("unordered_map find + virtual call", mapNs);
+    ReportNs("TrickSlots::Visit", slotNs);
+    EXPECT_LT(slotNs, mapNs * 1.5 + 5.0);
+}
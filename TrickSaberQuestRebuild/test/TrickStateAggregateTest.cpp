@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/HandSlots.hpp"
+#include "TrickSaber/Native/TrickStateAggregate.hpp"
+
+#include <utility>
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    // Stands in for SaberTrickManager: one trick slot, queried through a call
+    struct FakeManager {
+        TrickAction current = TrickAction::None;
+
+        [[gnu::noinline]] bool IsDoingTrick() const { return current != TrickAction::None; }
+        [[gnu::noinline]] bool IsTrickInState(TrickAction action) const { return current == action; }
+    };
+}
+
+TEST(TrickStateAggregateTest, TracksTricksPerHand) {
+    TrickStateAggregate state;
+    EXPECT_FALSE(state.Any());
+
+    state.Started(LeftHand, TrickAction::Throw);
+    state.Started(RightHand, TrickAction::Throw);
+    EXPECT_TRUE(state.Any());
+    EXPECT_EQ(state.Count(TrickAction::Throw), 2);
+    EXPECT_EQ(state.Count(TrickAction::Spin), 0);
+
+    state.Ended(LeftHand, TrickAction::Throw);
+    EXPECT_FALSE(state.IsHandActive(LeftHand));
+    EXPECT_TRUE(state.IsHandActive(RightHand));
+    EXPECT_TRUE(state.IsActive(TrickAction::Throw));
+
+    state.Started(LeftHand, TrickAction::Spin);
+    EXPECT_EQ(state.Count(TrickAction::Spin), 1);
+    EXPECT_EQ(state.Bits(), TrickStateAggregate::Bit(LeftHand, TrickAction::Spin) |
+        TrickStateAggregate::Bit(RightHand, TrickAction::Throw));
+}
+
+TEST(TrickStateAggregateTest, EndingTwiceIsHarmless) {
+    // EndTrickImmediately reports the end, then EndAllTricks reports it again
+    TrickStateAggregate state;
+    state.Started(RightHand, TrickAction::Spin);
+    state.Ended(RightHand, TrickAction::Spin);
+    state.Ended(RightHand, TrickAction::Spin);
+    state.Ended(LeftHand, TrickAction::Throw);
+
+    EXPECT_FALSE(state.Any());
+    EXPECT_EQ(state.GetStartCount(), 1u);
+    EXPECT_EQ(state.GetEndCount(), 1u);
+
+    state.Started(LeftHand, TrickAction::None);
+    EXPECT_FALSE(state.Any());
+
+    state.Started(LeftHand, TrickAction::Throw);
+    state.Clear();
+    EXPECT_FALSE(state.Any());
+}
+
+TEST(TrickStateAggregateTest, ForEachActiveVisitsOnlyRunningTricks) {
+    TrickStateAggregate state;
+    std::vector<std::pair<int, TrickAction>> visited;
+    auto collect = [&](int hand, TrickAction action) { visited.emplace_back(hand, action); };
+
+    state.ForEachActive(collect);
+    EXPECT_TRUE(visited.empty());
+
+    state.Started(RightHand, TrickAction::Throw);
+    state.Started(LeftHand, TrickAction::Spin);
+    state.ForEachActive(collect);
+    ASSERT_EQ(visited.size(), 2u);
+    EXPECT_EQ(visited[0], std::make_pair(static_cast<int>(LeftHand), TrickAction::Spin));
+    EXPECT_EQ(visited[1], std::make_pair(static_cast<int>(RightHand), TrickAction::Throw));
+
+    // A trick ending mid-walk does not disturb the rest of the walk
+    visited.clear();
+    state.ForEachActive([&](int hand, TrickAction action) {
+        visited.emplace_back(hand, action);
+        state.Ended(RightHand, TrickAction::Throw);
+    });
+    EXPECT_EQ(visited.size(), 2u);
+    EXPECT_EQ(state.Count(TrickAction::Throw), 0);
+}
+
+TEST(TrickStateAggregateTest, BenchmarkIsDoingTrickAgainstManagerScan) {
+    FakeManager left, right;
+    right.current = TrickAction::Spin;
+    HandSlots<FakeManager> slots;
+    slots.Join(LeftHand, &left);
+    slots.Join(RightHand, &right);
+    std::vector<FakeManager*> cached{&left, &right};
+
+    TrickStateAggregate state;
+    state.Started(RightHand, TrickAction::Spin);
+
+    // Before the registry: copy of the cached vector, then a scan
+    double copyScanNs = MeasureNsPerOp([&](int) {
+        auto managers = cached;
+        bool doing = false;
+        for (auto manager : managers) {
+            if (manager && manager->IsDoingTrick()) { doing = true; break; }
+        }
+        DoNotOptimize(doing);
+    }, 200000);
+
+    // Registry scan: no copy, still one call per manager
+    double slotScanNs = MeasureNsPerOp([&](int) {
+        bool doing = false;
+        for (auto manager : slots.All()) {
+            if (manager && manager->IsDoingTrick()) { doing = true; break; }
+        }
+        DoNotOptimize(doing);
+    }, 200000);
+
+    double aggregateNs = MeasureNsPerOp([&](int) {
+        DoNotOptimize(state.Any());
+    }, 200000);
+
+    // GetActiveSpinCount: visits every manager either way
+    double countScanNs = MeasureNsPerOp([&](int) {
+        int count = 0;
+        for (auto manager : slots.All()) {
+            if (manager && manager->IsTrickInState(TrickAction::Spin)) count++;
+        }
+        DoNotOptimize(count);
+    }, 200000);
+
+    double countNs = MeasureNsPerOp([&](int) {
+        DoNotOptimize(state.Count(TrickAction::Spin));
+    }, 200000);
+
+    ReportNs("IsDoingTrick: cached vector copy + scan", copyScanNs);
+    ReportNs("IsDoingTrick: registry scan", slotScanNs);
+    ReportNs("IsDoingTrick: aggregate", aggregateNs);
+    ReportNs("GetActiveSpinCount: registry scan", countScanNs);
+    ReportNs("GetActiveSpinCount: aggregate", countNs);
+    EXPECT_LT(aggregateNs, slotScanNs + 1.0);
+    EXPECT_LT(countNs, countScanNs + 1.0);
+    EXPECT_LT(aggregateNs, copyScanNs);
+}
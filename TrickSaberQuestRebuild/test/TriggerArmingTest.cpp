@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include "TrickSaber/Native/TriggerArming.hpp"
+
+using namespace TrickSaber::Native;
+
+TEST(TriggerArmingTest, HysteresisBandLatches) {
+    HysteresisBand band{0.8f, 0.6f};
+
+    EXPECT_FALSE(band.Next(false, 0.7f));
+    EXPECT_TRUE(band.Next(false, 0.8f));
+    EXPECT_TRUE(band.Next(true, 0.7f));
+    EXPECT_FALSE(band.Next(true, 0.59f));
+}
+
+TEST(TriggerArmingTest, ArmsAndDisarmsAcrossTheBand) {
+    TriggerArming arming;
+    arming.Configure(0.35f, 0.1f);
+
+    EXPECT_EQ(arming.Update(0.2f, false), ArmEdge::None);
+    EXPECT_EQ(arming.Update(0.4f, false), ArmEdge::Armed);
+    EXPECT_TRUE(arming.IsArmed());
+
+    // Jitter inside the band does not toggle
+    EXPECT_EQ(arming.Update(0.3f, false), ArmEdge::None);
+    EXPECT_EQ(arming.Update(0.36f, false), ArmEdge::None);
+
+    EXPECT_EQ(arming.Update(0.2f, false), ArmEdge::Disarmed);
+    EXPECT_FALSE(arming.IsArmed());
+}
+
+TEST(TriggerArmingTest, FireConsumesTheArm) {
+    TriggerArming arming;
+    arming.Configure(0.35f, 0.1f);
+
+    EXPECT_EQ(arming.Update(0.5f, false), ArmEdge::Armed);
+    EXPECT_EQ(arming.Update(0.9f, true), ArmEdge::None);
+    EXPECT_FALSE(arming.IsArmed());
+
+    // Held through the press reports nothing; easing back into the band arms the next one
+    EXPECT_EQ(arming.Update(0.9f, true), ArmEdge::None);
+    EXPECT_EQ(arming.Update(0.5f, false), ArmEdge::Armed);
+    EXPECT_EQ(arming.Update(0.0f, false), ArmEdge::Disarmed);
+}
@@ -5,16 +5,16 @@
 #else
 #include "UnityEngine/Vector3.hpp"
 #include "UnityEngine/Quaternion.hpp"
-#endif
-
-#include <chrono>
-#include <cmath>
 
-// Simple 2D vector for thumbstick input
+// Simple 2D vector for thumbstick input (HostMocks.hpp has the host one)
 struct Vector2 {
     float x, y;
     Vector2(float x = 0, float y = 0) : x(x), y(y) {}
 };
+#endif
+
+#include <chrono>
+#include <cmath>
 
 // Mock Quest 3 TouchPlus Controller
 class MockQuest3Controller {
@@ -1,86 +1,6 @@
 #include <gtest/gtest.h>
 #include "VRControllerMock.hpp"
 
-// Implementation of MockQuest3Controller methods
-MockQuest3Controller::MockQuest3Controller(bool rightHand) : isRightHand(rightHand) {
-    lastUpdate = std::chrono::steady_clock::now();
-}
-
-void MockQuest3Controller::SimulateMovement(const UnityEngine::Vector3& targetPos, float deltaTime) {
-    auto currentPos = state.position;
-    auto direction = UnityEngine::Vector3(
-        targetPos.x - currentPos.x,
-        targetPos.y - currentPos.y,
-        targetPos.z - currentPos.z
-    );
-    
-    float distance = sqrt(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
-    if (distance > 0.001f) {
-        // Apply physics constraints
-        float maxMove = MAX_VELOCITY * deltaTime;
-        if (distance > maxMove) {
-            float scale = maxMove / distance;
-            direction.x *= scale;
-            direction.y *= scale;
-            direction.z *= scale;
-        }
-        
-        state.velocity = UnityEngine::Vector3(direction.x / deltaTime, direction.y / deltaTime, direction.z / deltaTime);
-        state.position = UnityEngine::Vector3(currentPos.x + direction.x, currentPos.y + direction.y, currentPos.z + direction.z);
-    }
-}
-
-void MockQuest3Controller::SetTrigger(float value) {
-    state.triggerValue = std::clamp(value, 0.0f, 1.0f);
-    state.triggerPressed = state.triggerValue > TRIGGER_THRESHOLD;
-    state.triggerTouched = state.triggerValue > 0.01f;
-}
-
-void MockQuest3Controller::SetGrip(float value) {
-    state.gripValue = std::clamp(value, 0.0f, 1.0f);
-    state.gripPressed = state.gripValue > GRIP_THRESHOLD;
-}
-
-void MockQuest3Controller::SetThumbstick(float x, float y) {
-    state.thumbstick.x = std::clamp(x, -1.0f, 1.0f);
-    state.thumbstick.y = std::clamp(y, -1.0f, 1.0f);
-    
-    float magnitude = sqrt(x*x + y*y);
-    state.thumbstickTouch = magnitude > 0.01f;
-}
-
-void MockQuest3Controller::SetPrimaryButton(bool pressed, bool touched) {
-    state.primaryButton = pressed;
-    state.primaryTouch = touched || pressed;
-}
-
-void MockQuest3Controller::SetSecondaryButton(bool pressed, bool touched) {
-    state.secondaryButton = pressed;
-    state.secondaryTouch = touched || pressed;
-}
-
-void MockQuest3Controller::TriggerHaptic(float intensity, float duration) {
-    state.hapticIntensity = std::clamp(intensity, 0.0f, 1.0f);
-    state.hapticDuration = std::max(0.0f, duration);
-}
-
-void MockQuest3Controller::SimulateThrowMotion(float progress) {
-    float t = std::clamp(progress, 0.0f, 1.0f);
-    
-    // Realistic throw arc
-    state.position.x = sin(t * M_PI) * 0.3f;
-    state.position.y = -0.1f + sin(t * M_PI * 0.5f) * 0.2f;
-    state.position.z = -0.3f + t * 0.6f;
-    
-    // Rotation during throw
-    float angle = t * 180.0f * M_PI / 180.0f;
-    state.rotation = UnityEngine::Quaternion(sin(angle/2), 0, 0, cos(angle/2));
-    
-    // Velocity peaks mid-throw
-    float velocityMagnitude = sin(t * M_PI) * 5.0f;
-    state.velocity = UnityEngine::Vector3(0, 0, velocityMagnitude);
-}
-
 class VRControllerMockTest : public ::testing::Test {
 protected:
     MockQuest3Controller rightController{true};
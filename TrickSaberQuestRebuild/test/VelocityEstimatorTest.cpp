@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/VelocityEstimator.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace TrickSaber;
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    struct TraceSample {
+        double time;
+        float trueVelocity;  // ground truth along x
+        Vec3 rawVelocity;    // finite difference of the noisy tracked position
+    };
+
+    // Controller trace: 0.5s hold, a 4 m/s sin^2 flick over 200ms, then a
+    // 0.8s hold. Tracked positions carry 0.3mm of gaussian noise.
+    std::vector<TraceSample> MakeFlickTrace(double rateHz, unsigned seed = 7) {
+        std::mt19937 rng(seed);
+        std::normal_distribution<float> noise(0.0f, 0.0003f);
+
+        const double flickStart = 0.5, flickLength = 0.2, total = 1.5;
+        const float peak = 4.0f;
+        double dt = 1.0 / rateHz;
+
+        std::vector<TraceSample> trace;
+        double x = 0.0;
+        Vec3 prevTracked = Zero3();
+        for (int i = 0; i * dt < total; ++i) {
+            double t = i * dt;
+            double phase = (t - flickStart) / flickLength;
+            float v = (phase > 0.0 && phase < 1.0) ? peak * static_cast<float>(std::pow(std::sin(Constants::PI * phase), 2)) : 0.0f;
+            x += v * dt;
+
+            Vec3 tracked{static_cast<float>(x) + noise(rng), noise(rng), noise(rng)};
+            Vec3 raw = i == 0 ? Zero3() : (tracked - prevTracked) / static_cast<float>(dt);
+            prevTracked = tracked;
+            trace.push_back({t, v, raw});
+        }
+        return trace;
+    }
+
+    struct FilterReport {
+        double lagMs;
+        double jitterRms;
+    };
+
+    // Lag: delay of the estimate's rising 50%-of-peak crossing behind the truth.
+    // Jitter: RMS error over the final hold, once the flick has died down.
+    FilterReport Replay(VelocityEstimator& estimator, const std::vector<TraceSample>& trace) {
+        estimator.Reset();
+        const float half = 2.0f;
+        double truthCross = -1.0, estimateCross = -1.0;
+        double sumSq = 0.0;
+        int holdCount = 0;
+        float prevTruth = 0.0f, prevEstimate = 0.0f;
+        double prevTime = 0.0;
+
+        for (size_t i = 0; i < trace.size(); ++i) {
+            const auto& s = trace[i];
+            float dt = i == 0 ? 1.0f / 90.0f : static_cast<float>(s.time - trace[i - 1].time);
+            estimator.Push(s.rawVelocity, Zero3(), dt);
+            float estimate = estimator.Linear().x;
+
+            if (truthCross < 0.0 && s.trueVelocity >= half && i > 0) {
+                truthCross = prevTime + (s.time - prevTime) * (half - prevTruth) / (s.trueVelocity - prevTruth);
+            }
+            if (estimateCross < 0.0 && estimate >= half && i > 0) {
+                estimateCross = prevTime + (s.time - prevTime) * (half - prevEstimate) / (estimate - prevEstimate);
+            }
+            if (s.time > 1.0) {
+                Vec3 err{estimate - s.trueVelocity, estimator.Linear().y, estimator.Linear().z};
+                sumSq += SqrMagnitude(err);
+                holdCount++;
+            }
+            prevTruth = s.trueVelocity;
+            prevEstimate = estimate;
+            prevTime = s.time;
+        }
+        return {(estimateCross - truthCross) * 1000.0, std::sqrt(sumSq / holdCount)};
+    }
+}
+
+class VelocityEstimatorTest : public ::testing::Test {
+protected:
+    VelocityFilterParams params;
+    BoxcarVelocityEstimator boxcar;
+    OneEuroVelocityEstimator oneEuro;
+    KalmanVelocityEstimator kalman;
+
+    void SetUp() override {
+        boxcar.Configure(params);
+        oneEuro.Configure(params);
+        kalman.Configure(params);
+    }
+};
+
+TEST_F(VelocityEstimatorTest, AllConvergeToConstantVelocity) {
+    VelocityEstimator* estimators[] = {&boxcar, &oneEuro, &kalman};
+    for (auto* estimator : estimators) {
+        estimator->Reset();
+        for (int i = 0; i < 200; ++i) {
+            estimator->Push({1.5f, -0.5f, 0.25f}, {0.0f, 3.0f, 0.0f}, 1.0f / 90.0f);
+        }
+        EXPECT_NEAR(estimator->Linear().x, 1.5f, 1e-3f);
+        EXPECT_NEAR(estimator->Linear().y, -0.5f, 1e-3f);
+        EXPECT_NEAR(estimator->Linear().z, 0.25f, 1e-3f);
+        EXPECT_NEAR(estimator->Angular().y, 3.0f, 1e-3f);
+    }
+}
+
+TEST_F(VelocityEstimatorTest, ResetForgetsHistory) {
+    for (int i = 0; i < 20; ++i) kalman.Push({5.0f, 0.0f, 0.0f}, Zero3(), 1.0f / 90.0f);
+    kalman.Reset();
+    kalman.Push({1.0f, 0.0f, 0.0f}, Zero3(), 1.0f / 90.0f);
+    EXPECT_FLOAT_EQ(kalman.Linear().x, 1.0f);
+}
+
+TEST_F(VelocityEstimatorTest, SetSelectsConfiguredMode) {
+    VelocityEstimatorSet set;
+    set.Configure(VelocityFilterMode::Kalman, params);
+    EXPECT_NE(dynamic_cast<KalmanVelocityEstimator*>(&set.Active()), nullptr);
+    set.Configure(VelocityFilterMode::OneEuro, params);
+    EXPECT_NE(dynamic_cast<OneEuroVelocityEstimator*>(&set.Active()), nullptr);
+    set.Configure(VelocityFilterMode::Boxcar, params);
+    EXPECT_NE(dynamic_cast<BoxcarVelocityEstimator*>(&set.Active()), nullptr);
+}
+
+// Replays the flick trace at each headset rate and prints lag/jitter per
+// filter. Both alternatives must respond faster than the default boxcar
+// while staying within a bounded amount of extra noise at rest.
+TEST_F(VelocityEstimatorTest, BenchmarkLagAndJitterAgainstBoxcar) {
+    for (double rate : {72.0, 90.0, 120.0}) {
+        auto trace = MakeFlickTrace(rate);
+        auto box = Replay(boxcar, trace);
+        auto euro = Replay(oneEuro, trace);
+        auto kal = Replay(kalman, trace);
+
+        std::printf("[ BENCH    ] %5.0f Hz  boxcar  lag %6.2f ms  jitter %.4f m/s\n", rate, box.lagMs, box.jitterRms);
+        std::printf("[ BENCH    ] %5.0f Hz  oneEuro lag %6.2f ms  jitter %.4f m/s\n", rate, euro.lagMs, euro.jitterRms);
+        std::printf("[ BENCH    ] %5.0f Hz  kalman  lag %6.2f ms  jitter %.4f m/s\n", rate, kal.lagMs, kal.jitterRms);
+
+        EXPECT_LT(euro.lagMs, box.lagMs) << rate;
+        EXPECT_LT(kal.lagMs, box.lagMs) << rate;
+        EXPECT_LT(euro.jitterRms, box.jitterRms * 1.5) << rate;
+        EXPECT_LT(kal.jitterRms, box.jitterRms * 2.0) << rate;
+    }
+
+    auto trace = MakeFlickTrace(90.0);
+    VelocityEstimator* estimators[] = {&boxcar, &oneEuro, &kalman};
+    const char* names[] = {"boxcar push", "oneEuro push", "kalman push"};
+    for (int e = 0; e < 3; ++e) {
+        auto* estimator = estimators[e];
+        double ns = MeasureNsPerOp([&](int i) {
+            estimator->Push(trace[i % trace.size()].rawVelocity, trace[(i + 3) % trace.size()].rawVelocity, 1.0f / 90.0f);
+            DoNotOptimize(estimator->Linear());
+        }, 200000);
+        ReportNs(names[e], ns);
+    }
+}
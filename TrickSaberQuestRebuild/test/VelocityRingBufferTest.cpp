@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "BenchmarkUtils.hpp"
+#include "TrickSaber/Native/VelocityRingBuffer.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace TrickSaber::Native;
+using namespace TrickSaber::Testing;
+
+namespace {
+    // Reference: the old std::vector buffer averaged by looping every frame
+    struct NaiveVelocityBuffer {
+        std::vector<Vec3> linear, angular;
+        size_t index = 0;
+
+        explicit NaiveVelocityBuffer(int size) : linear(size, Zero3()), angular(size, Zero3()) {}
+
+        void Push(const Vec3& v, const Vec3& w) {
+            if (index >= linear.size()) index = 0;
+            linear[index] = v;
+            angular[index] = w;
+            index++;
+        }
+
+        static Vec3 Average(const std::vector<Vec3>& buffer) {
+            Vec3 sum = Zero3();
+            for (const auto& v : buffer) sum += v;
+            return sum / static_cast<float>(buffer.size());
+        }
+    };
+
+    Vec3 Sample(int i) {
+        return {std::sin(i * 0.37f) * 3.0f, std::cos(i * 0.11f) * 2.0f, (i % 7) * 0.25f - 0.75f};
+    }
+}
+
+class VelocityRingBufferTest : public ::testing::Test {
+protected:
+    VelocityRingBuffer buffer;
+};
+
+TEST_F(VelocityRingBufferTest, StartsZeroed) {
+    Vec3 avg = buffer.AverageLinear();
+    EXPECT_EQ(avg.x, 0.0f);
+    EXPECT_EQ(avg.y, 0.0f);
+    EXPECT_EQ(avg.z, 0.0f);
+    EXPECT_EQ(buffer.Size(), TrickSaber::Constants::DEFAULT_VELOCITY_BUFFER_SIZE);
+}
+
+TEST_F(VelocityRingBufferTest, ResizeClampsToCapacity) {
+    buffer.Resize(0);
+    EXPECT_EQ(buffer.Size(), 1);
+    buffer.Resize(1000);
+    EXPECT_EQ(buffer.Size(), VelocityRingBuffer::Capacity);
+}
+
+TEST_F(VelocityRingBufferTest, MatchesNaiveAverageForEveryWindow) {
+    for (int size = 1; size <= VelocityRingBuffer::Capacity; ++size) {
+        buffer.Resize(size);
+        NaiveVelocityBuffer naive(size);
+
+        for (int i = 0; i < 3 * size + 1; ++i) {
+            Vec3 v = Sample(i);
+            Vec3 w = Sample(i + 1000) * 0.5f;
+            buffer.Push(v, w);
+            naive.Push(v, w);
+
+            Vec3 expected = NaiveVelocityBuffer::Average(naive.linear);
+            Vec3 actual = buffer.AverageLinear();
+            EXPECT_NEAR(actual.x, expected.x, 1e-5f) << "size " << size << " sample " << i;
+            EXPECT_NEAR(actual.y, expected.y, 1e-5f);
+            EXPECT_NEAR(actual.z, expected.z, 1e-5f);
+
+            Vec3 expectedAngular = NaiveVelocityBuffer::Average(naive.angular);
+            Vec3 actualAngular = buffer.AverageAngular();
+            EXPECT_NEAR(actualAngular.x, expectedAngular.x, 1e-5f);
+            EXPECT_NEAR(actualAngular.y, expectedAngular.y, 1e-5f);
+            EXPECT_NEAR(actualAngular.z, expectedAngular.z, 1e-5f);
+        }
+    }
+}
+
+TEST_F(VelocityRingBufferTest, RunningSumDoesNotDrift) {
+    buffer.Resize(7);
+    for (int i = 0; i < 1000000; ++i) {
+        buffer.Push(Sample(i) * 100.0f, Sample(i));
+    }
+    for (int i = 0; i < 7; ++i) {
+        buffer.Push({1.0f, 2.0f, 3.0f}, Zero3());
+    }
+    Vec3 avg = buffer.AverageLinear();
+    EXPECT_NEAR(avg.x, 1.0f, 1e-5f);
+    EXPECT_NEAR(avg.y, 2.0f, 1e-5f);
+    EXPECT_NEAR(avg.z, 3.0f, 1e-5f);
+}
+
+TEST_F(VelocityRingBufferTest, ClearResetsWindow) {
+    buffer.Push({5.0f, 5.0f, 5.0f}, {1.0f, 1.0f, 1.0f});
+    buffer.Clear();
+    EXPECT_EQ(buffer.AverageLinear().x, 0.0f);
+    EXPECT_EQ(buffer.AverageAngular().x, 0.0f);
+}
+
+// Push + both averages, as MovementController does per hand per tick.
+// The ring should stay flat from size 2 to MAX_VELOCITY_BUFFER_SIZE.
+TEST_F(VelocityRingBufferTest, BenchmarkCostIsFlatAcrossWindowSizes) {
+    constexpr int iterations = 200000;
+    Vec3 samples[64];
+    for (int i = 0; i < 64; ++i) samples[i] = Sample(i);
+
+    const int sizes[] = {2, 5, 10, VelocityRingBuffer::Capacity};
+    double ringNs[4] = {};
+
+    for (int s = 0; s < 4; ++s) {
+        int size = sizes[s];
+        buffer.Resize(size);
+        ringNs[s] = MeasureNsPerOp([&](int i) {
+            buffer.Push(samples[i & 63], samples[(i + 7) & 63]);
+            DoNotOptimize(buffer.AverageLinear());
+            DoNotOptimize(buffer.AverageAngular());
+        }, iterations);
+
+        NaiveVelocityBuffer naive(size);
+        double naiveNs = MeasureNsPerOp([&](int i) {
+            naive.Push(samples[i & 63], samples[(i + 7) & 63]);
+            DoNotOptimize(NaiveVelocityBuffer::Average(naive.linear));
+            DoNotOptimize(NaiveVelocityBuffer::Average(naive.angular));
+        }, iterations);
+
+        ReportNs(("VelocityRingBuffer size " + std::to_string(size)).c_str(), ringNs[s]);
+        ReportNs(("naive vector loop size " + std::to_string(size)).c_str(), naiveNs);
+    }
+
+    // Loose bound: the ring must not scale with the window like the loop does
+    EXPECT_LT(ringNs[3], ringNs[0] * 3.0);
+}